@@ -79,6 +79,7 @@ namespace framework
 		std::optional<size_t> m_latchedSceneIndex;
 		size_t m_activeSceneIndex { 0u };
 		size_t m_pendingSceneIndex{ static_cast<size_t>(-1) };
+		bool   m_bPipelineFrames  { true };
 		Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> m_imguiHeap;
 	};
 }
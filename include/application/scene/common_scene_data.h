@@ -41,6 +41,9 @@
 #include <d3d12.h>
 #include <cstdint>
 
+#include "utility/mesh_generator.h"
+#include "framework/render_manager/components/ocean_fft.h"
+
 inline DirectX::XMFLOAT3 Lerp(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b, float t)
 {
 	t = std::clamp(t, 0.0f, 1.0f);
@@ -179,6 +182,33 @@ inline std::string ToString(const ERenderType &type)
 	return "Unknown";
 }
 
+//~ gpu side of the river colouring, mirrors cbRiver in chapter_9/river_vertex_shader.hlsl
+struct RiverShadingConstants
+{
+	DirectX::XMFLOAT4 LeftColor;
+	DirectX::XMFLOAT4 RightColor;
+	DirectX::XMFLOAT4 DownLeftColor;
+	DirectX::XMFLOAT4 DownRightColor;
+	DirectX::XMFLOAT4 ShallowColor;
+	DirectX::XMFLOAT4 DeepColor;
+	DirectX::XMFLOAT4 FoamColor;
+
+	float HalfWidth;
+	float MinZ;
+	float MaxZ;
+	float MaxHeight;
+
+	float FoamStrength;
+	float ShimmerStrength;
+	float EdgeNoiseStrength;
+	float FoamHeightThreshold;
+
+	float FlowSpeed;
+	DirectX::XMFLOAT3 padding;
+};
+
+static_assert(sizeof(RiverShadingConstants) % 16 == 0);
+
 struct RiverUpdateParam
 {
 	float amp1 = 0.06f;
@@ -217,6 +247,16 @@ struct RiverUpdateParam
 	float foamHeightThreshold = 0.10f;
 
 	void ImguiView();
+	RiverShadingConstants GetShadingConstants() const;
 };
 
+//~ clamped wave height of the river surface at (x, z) and time t,
+//~ with an ocean tile the sine stack is replaced by a wrapped lookup into it
+float EvaluateRiverHeight(const RiverUpdateParam& p, float x, float z, float t,
+	const framework::OceanFFT* ocean = nullptr);
+
+//~ writes the animated river vertex at time t, out.Normal is left for the caller
+void EvaluateRiverVertex(const RiverUpdateParam& p, const MeshVertex& base, MeshVertex& out, float t,
+	const framework::OceanFFT* ocean = nullptr);
+
 #endif //DIRECTX12_COMMON_SCENE_DATA_H
\ No newline at end of file
@@ -39,6 +39,7 @@
 #include <cstdint>
 
 #include "framework/render_manager/render_manager.h"
+#include "framework/jobs/job_system.h"
 
 class IScene
 {
@@ -56,8 +57,20 @@ public:
 	virtual void FrameEnd  (float deltaTime) = 0;
 	virtual void ImguiView (float deltaTime) = 0;
 
+	//~ shared worker pool, set by the application before Initialize
+	void AttachJobSystem(framework::JobSystem* jobs) { Jobs = jobs; }
+
+	//~ frame pipelining, optional. Once IsSimulationReady the application calls Simulate for the
+	//~ next frame on a worker while FrameBegin records the current one, so Simulate must not touch
+	//~ Render or anything FrameBegin reads. PublishSimulation runs on the main thread after the join
+	//~ and hands the finished state over to the recorder.
+	virtual bool IsSimulationReady() const { return false; }
+	virtual void Simulate		  (float deltaTime) { (void)deltaTime; }
+	virtual void PublishSimulation() {}
+
 protected:
 	framework::DxRenderManager& Render;
+	framework::JobSystem*		Jobs{ nullptr };
 };
 
 #endif //DIRECTX12_INTERFACE_SCENE_H
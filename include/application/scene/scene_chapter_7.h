@@ -40,7 +40,10 @@
 #include "interface_scene.h"
 #include "utility/mesh_generator.h"
 #include "framework/render_manager/components/render_item.h"
+#include "framework/render_manager/components/upload_allocator.h"
+#include "framework/render_manager/components/frustum_culler.h"
 #include "framework/render_manager/components/decriptor_heap.h"
+#include "framework/render_manager/components/deferred_release_queue.h"
 #include "framework/render_manager/components/pipeline.h"
 
 enum class EShape
@@ -99,6 +102,8 @@ private:
 	void ImguiMountainConfig();
 
 	void UpdateConstantBuffer(float deltaTime);
+	void GatherVisibleItems	 ();
+	void BuildInstanceBatches();
 	void DrawRenderItems();
 
 private:
@@ -114,6 +119,7 @@ private:
 	//~ shader resources
 	bool m_bShadersInitialized{ false };
 	Microsoft::WRL::ComPtr<ID3DBlob> m_vertexShaderBlob;
+	Microsoft::WRL::ComPtr<ID3DBlob> m_instancedVertexShaderBlob;
 	Microsoft::WRL::ComPtr<ID3DBlob> m_pixelShaderBlob;
 
 	//~ Descriptor Heap for constant buffers
@@ -138,9 +144,35 @@ private:
 	Microsoft::WRL::ComPtr<ID3D12RootSignature> m_rootSignature	{};
 	bool m_bPipelineInitialized		{ false };
 	framework::Pipeline m_pipeline	{};
+	framework::Pipeline m_instancedPipeline{};
+
+	//~ instancing, visible items sharing mesh and topology go out as one draw
+	struct InstanceBatch
+	{
+		MeshGeometry*			  Mesh		   { nullptr };
+		EPrimitiveMode			  PrimitiveMode{ EPrimitiveMode::TriangleList };
+		std::uint32_t			  Count		   { 0u };
+		D3D12_GPU_VIRTUAL_ADDRESS Instances	   { 0u }; // world matrices, transposed
+	};
+	bool m_bInstancing{ true };
+	std::vector<InstanceBatch> m_instanceBatches{};
+	std::uint32_t m_lastDrawCalls{ 0u };
+
+	//~ both draw paths read the survivors, boxes come from each mesh and the store worlds
+	framework::FrustumCuller m_culler{};
+	std::vector<RenderItem*> m_visibleItems{};
+	bool m_bFrustumCulling{ true };
 
 	//~ configs
 	PassConstantsCPU m_globalPassConstant{};
+	framework::UploadAllocator m_uploadAllocator{};
+	framework::ObjectConstantTable m_objectConstants{};
+	framework::TransformStore	   m_transforms{};
+	D3D12_GPU_VIRTUAL_ADDRESS m_passAddress{ 0u };
+
+	//~ buffers and descriptors replaced while older frames may still read them
+	framework::DeferredReleaseQueue m_releases{};
+
 	DirectX::XMFLOAT4X4 m_view{};
 	DirectX::XMFLOAT4X4 m_proj{};
 	float m_lastPrinted{ 5.f };
@@ -40,8 +40,19 @@
 #include "framework/render_manager/components/decriptor_heap.h"
 #include "framework/render_manager/components/pipeline.h"
 #include "framework/render_manager/components/render_item.h"
+#include "framework/render_manager/components/render_item_registry.h"
+#include "framework/render_manager/components/upload_allocator.h"
+#include "framework/render_manager/components/material_table.h"
+#include "framework/render_manager/components/draw_list.h"
+#include "framework/render_manager/components/frustum_culler.h"
+#include "framework/render_manager/components/light_cluster_grid.h"
+#include "framework/render_manager/components/object_light_lists.h"
+#include "framework/render_manager/components/command_list_pool.h"
+#include "framework/render_manager/components/dynamic_mesh_scheduler.h"
 #include "common_scene_data.h"
+#include <atomic>
 #include <cstdint>
+#include <span>
 
 class SceneChapter8 final: public IScene
 {
@@ -73,8 +84,15 @@ private:
 	void CreateMaterials	 ();
 
 	void UpdateConstantBuffer(float deltaTime);
+	void AssignLightClusters ();
+	void BuildDrawList();
 	void DrawRenderItems();
 
+	//~ shared by the serial path and every parallel chunk
+	void BindFrameState(framework::CommandStateCache& cmd) const;
+	void RecordPackets (framework::CommandStateCache& cmd, std::span<const framework::DrawPacket> packets) const;
+	void TallyStateCalls(const framework::CommandStateCache& cmd);
+
 	//~ update river
 	void UpdateRiver(float deltaTime);
 
@@ -107,11 +125,18 @@ private:
 	MeshData m_riverBase;
 	MeshData m_riverFrame;
 	RiverUpdateParam m_riverParam{};
-	float m_riverUpdateAccum = 0.0f;
+	std::uint32_t m_riverColumns{ 0u };
+	framework::DynamicMeshScheduler m_riverScheduler{};
+	std::vector<float> m_riverRowDistances{};
+	std::vector<framework::DirtyRowRange> m_riverDirtyRanges{};
 
     //~ render items
     bool m_bRenderItemInitialized{ false };
-    std::unordered_map<ERenderType, std::vector<RenderItem>> m_renderItems;
+    //~ mesh and material ids are the ERenderType, the handles stay valid across removals
+    framework::RenderItemRegistry m_renderItems{};
+    framework::RenderItemHandle	  m_riverItem{};
+    framework::RenderItemHandle	  m_mountainItem{};
+    std::vector<MeshGeometry*>	  m_meshTable{}; // mesh id -> geometry
 
     //~ pipeline
 	bool m_bRootSignatureInitialized{ false };
@@ -122,9 +147,47 @@ private:
 	//~ config materials
 	bool m_bMaterialsInitialized{ false };
 	std::unordered_map<ERenderType, Material> m_materials{};
+	//~ every material lives in one structured buffer, draws only pass their entry
+	framework::MaterialTable	m_materialTable{};
+	std::vector<std::uint32_t>	m_materialSlots{}; // material id -> table entry
 
     //~ configs
 	PassConstantsCPU m_globalPassConstant{};
+	framework::UploadAllocator m_uploadAllocator{};
+	framework::ObjectConstantTable m_objectConstants{};
+	framework::TransformStore	   m_transforms{};
+
+	//~ sorted submission, packets index into m_drawItems which holds registry indices
+	framework::DrawList m_drawList{};
+	std::vector<std::uint32_t> m_drawItems{};
+
+	//~ drops items whose mesh box is outside the camera before they reach the draw list
+	framework::FrustumCuller m_culler{};
+	bool m_bFrustumCulling{ true };
+
+	//~ point and spot lights listed per froxel, shaders walk their cluster instead of every light
+	framework::LightClusterGrid m_lightClusters{};
+	std::vector<LightCPU> m_localLights{}; // points then spots, the order cluster and object ids refer to
+	D3D12_GPU_VIRTUAL_ADDRESS m_localLightsAddress   { 0u };
+	D3D12_GPU_VIRTUAL_ADDRESS m_clusterRangesAddress { 0u };
+	D3D12_GPU_VIRTUAL_ADDRESS m_clusterIndicesAddress{ 0u };
+
+	//~ or the brightest few lights per drawn object, written behind the world matrix in its slot
+	framework::ObjectLightLists m_objectLights{};
+	std::vector<std::uint32_t>	m_objectLightSlots{}; // object index -> constant slot
+	ELightingPath m_lightingPath{ ELightingPath::Clustered };
+
+	//~ state calls that reached the lists and the ones the cache dropped, summed over all chunks
+	std::atomic<std::uint32_t> m_lastIssuedCalls  { 0u };
+	std::atomic<std::uint32_t> m_lastFilteredCalls{ 0u };
+
+	//~ chunks of the sorted list are recorded on workers into pooled lists. ui and the present
+	//~ barrier still land in Render.GfxCmd, so a pool list stands in for it until FrameEnd
+	framework::ParallelRecorder m_recorder{};
+	framework::CommandListPool	m_commandLists{};
+	bool		  m_bParallelRecording{ true };
+	std::uint32_t m_recordedChunks{ 0u };
+	D3D12_GPU_VIRTUAL_ADDRESS m_passAddress{ 0u };
 	DirectX::XMFLOAT4X4 m_view{};
 	DirectX::XMFLOAT4X4 m_proj{};
 	float m_lastPrinted{ 5.f };
@@ -37,10 +37,23 @@
 
 #include "interface_scene.h"
 #include "framework/render_manager/components/decriptor_heap.h"
+#include "framework/render_manager/components/deferred_release_queue.h"
+#include "framework/render_manager/components/transient_descriptor_ring.h"
 #include "framework/render_manager/components/pipeline.h"
 #include "framework/render_manager/components/render_item.h"
+#include "framework/render_manager/components/render_item_registry.h"
+#include "framework/render_manager/components/upload_allocator.h"
+#include "framework/render_manager/components/material_table.h"
+#include "framework/render_manager/components/draw_list.h"
+#include "framework/render_manager/components/frustum_culler.h"
+#include "framework/render_manager/components/light_cluster_grid.h"
+#include "framework/render_manager/components/object_light_lists.h"
+#include "framework/render_manager/components/command_list_pool.h"
+#include "framework/render_manager/components/dynamic_mesh_scheduler.h"
 #include "common_scene_data.h"
+#include <atomic>
 #include <cstdint>
+#include <span>
 
 class SceneChapter9 final: public IScene
 {
@@ -55,6 +68,13 @@ public:
 	void FrameEnd	  (float deltaTime) override;
 	void ImguiView(float deltaTime) override;
 
+	bool IsSimulationReady() const override
+	{
+		return m_bGeometryInitialized && m_bRenderItemInitialized && m_bMaterialsInitialized;
+	}
+	void Simulate		  (float deltaTime) override;
+	void PublishSimulation() override;
+
 private:
 	void LoadData();
 	void SaveData() const;
@@ -71,12 +91,23 @@ private:
 	void CreateRenderItems	 ();
 	void CreateMaterials	 ();
 	void CreateTextures		 ();
+	void ReleaseTextures	 ();
 
 	void UpdateConstantBuffer(float deltaTime);
+	void AssignLightClusters ();
+	void BuildTextureTables();
+	void BuildDrawList();
 	void DrawRenderItems();
 
-	//~ update river
-	void UpdateRiver(float deltaTime);
+	//~ shared by the serial path and every parallel chunk
+	void BindFrameState(framework::CommandStateCache& cmd) const;
+	void RecordPackets (framework::CommandStateCache& cmd, std::span<const framework::DrawPacket> packets) const;
+	void TallyStateCalls(const framework::CommandStateCache& cmd);
+
+	//~ river: simulated into m_riverFrame, published into the geometry, uploaded while recording
+	void SimulateRiver();
+	void PublishRiver ();
+	void UploadRiver  ();
 
 private:
 	bool m_bInitialized{ false };
@@ -95,10 +126,16 @@ private:
 	bool m_bShadersInitialized{ false };
 	Microsoft::WRL::ComPtr<ID3DBlob> m_vertexShaderBlob;
 	Microsoft::WRL::ComPtr<ID3DBlob> m_pixelShaderBlob;
+	Microsoft::WRL::ComPtr<ID3DBlob> m_riverVertexShaderBlob;
 
 	//~ Descriptor Heap for constant buffers
 	bool m_bSRVHeapInitialized{ false };
 	framework::DescriptorHeap m_descriptorHeap{};
+	//~ texture views sit in a cpu only heap, the tables a frame binds are copied into the ring
+	framework::DescriptorHeap			m_stagingHeap{};
+	framework::TransientDescriptorRing	m_descriptorRing{};
+	//~ textures and their staging views replaced while older frames may still read them
+	framework::DeferredReleaseQueue		m_releases{};
 
 	//~ Geometry Resources
 	bool m_bGeometryInitialized{ false };
@@ -108,28 +145,96 @@ private:
 	MeshData m_riverBase;
 	MeshData m_riverFrame;
 	RiverUpdateParam m_riverParam{};
-	float m_riverUpdateAccum = 0.0f;
+	std::uint32_t m_riverColumns{ 0u };
+	framework::DynamicMeshScheduler m_riverScheduler{};
+
+	//~ fft water tile sampled by the river instead of the per vertex sine stack
+	bool m_bRiverUseFFT{ true };
+	framework::OceanFFT m_ocean{};
+	std::vector<float> m_riverRowDistances{};
+	std::vector<framework::DirtyRowRange> m_riverDirtyRanges{};	 // rows the recorder uploads
+	std::vector<framework::DirtyRowRange> m_riverSimulatedRanges{}; // rows the simulation refreshed
+
+	//~ simulation side inputs, copied from the render side when publishing
+	float				m_simTime{ 0.0f };
+	DirectX::XMFLOAT3	m_simEye { 0.0f, 0.0f, -10.0f };
+	DirectX::XMFLOAT4X4 m_simRiverWorld
+	{
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f,
+		0.f, 0.f, 0.f, 1.f
+	};
+
+	//~ split stream river: static xz/uv/tangent once, height + normal per tick
+	bool m_bRiverSplitStream{ true };
+	D3D12_GPU_VIRTUAL_ADDRESS m_riverShadingAddress{ 0u };
 
     //~ render items
     bool m_bRenderItemInitialized{ false };
-    std::unordered_map<ERenderType, std::vector<RenderItem>> m_renderItems;
+    //~ mesh and material ids are the ERenderType, the handles stay valid across removals
+    framework::RenderItemRegistry m_renderItems{};
+    framework::RenderItemHandle	  m_riverItem{};
+    framework::RenderItemHandle	  m_mountainItem{};
+    std::vector<MeshGeometry*>	  m_meshTable{}; // mesh id -> geometry
 
     //~ pipeline
 	bool m_bRootSignatureInitialized{ false };
 	Microsoft::WRL::ComPtr<ID3D12RootSignature> m_rootSignature	{};
 	bool m_bPipelineInitialized		{ false };
 	framework::Pipeline m_pipeline	{};
+	framework::Pipeline m_riverPipeline{};
 
 	//~ config materials
 	bool m_bMaterialsInitialized{ false };
 	std::unordered_map<ERenderType, Material> m_materials{};
+	//~ every material lives in one structured buffer, draws only pass their entry
+	framework::MaterialTable	m_materialTable{};
+	std::vector<std::uint32_t>	m_materialSlots{}; // material id -> table entry
 
 	//¬ create textures
 	bool m_bTexturesInitialized{ false };
+	bool m_bCompactStaging{ false }; // once the replaced views are back, the new ones slide into their place
 	std::unordered_map<ERenderType, Texture> m_textures{};
+	std::unordered_map<ERenderType, D3D12_GPU_DESCRIPTOR_HANDLE> m_textureTables{}; // this frame's copies
 
     //~ configs
 	PassConstantsCPU	m_globalPassConstant{};
+	framework::UploadAllocator m_uploadAllocator{};
+	framework::ObjectConstantTable m_objectConstants{};
+	framework::TransformStore	   m_transforms{};
+
+	//~ sorted submission, packets index into m_drawItems which holds registry indices
+	framework::DrawList m_drawList{};
+	std::vector<std::uint32_t> m_drawItems{};
+
+	//~ drops items whose mesh box is outside the camera before they reach the draw list
+	framework::FrustumCuller m_culler{};
+	bool m_bFrustumCulling{ true };
+
+	//~ point and spot lights listed per froxel, shaders walk their cluster instead of every light
+	framework::LightClusterGrid m_lightClusters{};
+	std::vector<LightCPU> m_localLights{}; // points then spots, the order cluster and object ids refer to
+	D3D12_GPU_VIRTUAL_ADDRESS m_localLightsAddress   { 0u };
+	D3D12_GPU_VIRTUAL_ADDRESS m_clusterRangesAddress { 0u };
+	D3D12_GPU_VIRTUAL_ADDRESS m_clusterIndicesAddress{ 0u };
+
+	//~ or the brightest few lights per drawn object, written behind the world matrix in its slot
+	framework::ObjectLightLists m_objectLights{};
+	std::vector<std::uint32_t>	m_objectLightSlots{}; // object index -> constant slot
+	ELightingPath m_lightingPath{ ELightingPath::Clustered };
+
+	//~ state calls that reached the lists and the ones the cache dropped, summed over all chunks
+	std::atomic<std::uint32_t> m_lastIssuedCalls  { 0u };
+	std::atomic<std::uint32_t> m_lastFilteredCalls{ 0u };
+
+	//~ chunks of the sorted list are recorded on workers into pooled lists. ui and the present
+	//~ barrier still land in Render.GfxCmd, so a pool list stands in for it until FrameEnd
+	framework::ParallelRecorder m_recorder{};
+	framework::CommandListPool	m_commandLists{};
+	bool		  m_bParallelRecording{ true };
+	std::uint32_t m_recordedChunks{ 0u };
+	D3D12_GPU_VIRTUAL_ADDRESS  m_passAddress{ 0u };
 	DirectX::XMFLOAT4X4 m_view{};
 	DirectX::XMFLOAT4X4 m_proj{};
 	float m_lastPrinted{ 5.f };
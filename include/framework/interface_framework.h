@@ -38,6 +38,7 @@
 
 #include "windows_manager/windows_manager.h"
 #include "render_manager/render_manager.h"
+#include "jobs/job_system.h"
 #include "utility/timer.h"
 #include "types.h"
 #include <memory>
@@ -80,6 +81,7 @@ namespace framework
 		GameTimer m_timer{};
 		std::unique_ptr<DxWindowsManager> m_pWindowsManager{ nullptr };
 		DxRenderManager m_renderManager {};
+		JobSystem		m_jobSystem		{};
 
 	private:
 		bool m_bEnginePaused{ false };
@@ -0,0 +1,166 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/12/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_JOB_SYSTEM_H
+#define DIRECTX12_JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace framework
+{
+	class JobSystem;
+
+	using Job = std::function<void()>;
+
+	//~ Tracks outstanding jobs of a group, reaches zero when all of them finished.
+	//~ Jobs queued with RunAfter wait on a counter and are released by the last finisher.
+	//~ The first exception thrown by one of its jobs is kept and rethrown by Wait.
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool		  IsDone	() const { return m_pending.load(std::memory_order_acquire) == 0u; }
+		std::uint32_t GetPending() const { return m_pending.load(std::memory_order_acquire); }
+
+	private:
+		friend class JobSystem;
+
+		struct Continuation
+		{
+			Job		    Work;
+			JobCounter* Counter;
+		};
+
+		std::atomic<std::uint32_t> m_pending{ 0u };
+		std::mutex				   m_lock;
+		std::vector<Continuation>  m_continuations;
+		std::exception_ptr		   m_error;
+	};
+
+	//~ Fixed pool of workers, each with its own deque. Owners push and pop at the back (lifo, warm caches),
+	//~ idle workers steal from the front of the others. Threads that wait on a counter help out
+	//~ instead of blocking, so nested ParallelFor calls cannot dead lock the pool.
+	class JobSystem
+	{
+	public:
+		 JobSystem() = default;
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		//~ 0 picks hardware threads - 1, the calling thread counts as the extra one
+		void Initialize(std::uint32_t workerCount = 0u);
+		void Shutdown  ();
+
+		void Run	 (Job job, JobCounter* counter = nullptr);
+		void RunAfter(JobCounter& dependency, Job job, JobCounter* counter = nullptr);
+		//~ never picked up by the thread that called Initialize, not even while it helps out in Wait,
+		//~ so a long job really overlaps whatever that thread does next
+		void RunOnWorker(Job job, JobCounter* counter = nullptr);
+		//~ rethrows the first error of the counter's jobs, nothing else
+		void Wait	 (JobCounter& counter);
+		//~ rethrows the first error of a job that had no counter, the owner polls it once a frame
+		void RethrowDetached();
+
+		//~ splits [0, count) into chunks of `grain` and blocks until all of them ran
+		void ParallelFor(std::uint32_t count, std::uint32_t grain,
+			const std::function<void(std::uint32_t begin, std::uint32_t end)>& body);
+
+		bool		  IsInitialized () const { return m_bInitialized; }
+		std::uint32_t GetWorkerCount() const { return static_cast<std::uint32_t>(m_workers.size()); }
+
+		void ImguiView();
+
+	private:
+		struct Task
+		{
+			Job		    Work;
+			JobCounter* Counter{ nullptr };
+		};
+
+		struct WorkQueue
+		{
+			std::mutex		 Lock;
+			std::deque<Task> Tasks;
+		};
+
+		void Push	   (Task&& task);
+		bool TryPop	   (std::uint32_t queue, Task& out);
+		bool TrySteal  (std::uint32_t thief, Task& out);
+		bool TryPopWorkerOnly(Task& out);
+		bool TryRunOne ();
+		void Execute   (Task& task);
+		void KeepError (JobCounter* counter, std::exception_ptr error);
+		void WorkerLoop(std::uint32_t queue);
+
+		std::uint32_t CurrentQueue() const;
+
+	private:
+		//~ queue 0 belongs to the thread that called Initialize
+		std::vector<std::unique_ptr<WorkQueue>> m_queues;
+		std::vector<std::jthread>				m_workers;
+		WorkQueue								m_workerOnly; // fifo, workers only
+
+		std::mutex				   m_wakeLock;
+		std::condition_variable	   m_wake;
+		std::atomic<std::uint32_t> m_queued{ 0u };
+		std::atomic<std::uint32_t> m_submitCursor{ 0u };
+		std::atomic<bool>		   m_bStop{ false };
+		bool					   m_bInitialized{ false };
+
+		std::mutex		   m_errorLock;
+		std::exception_ptr m_detachedError; // first throw of a job without a counter
+
+		//~ stats
+		std::atomic<std::uint64_t> m_executed{ 0u };
+		std::atomic<std::uint64_t> m_stolen	 { 0u };
+		std::uint64_t			   m_lastExecuted{ 0u };
+		std::uint64_t			   m_lastStolen	 { 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_JOB_SYSTEM_H
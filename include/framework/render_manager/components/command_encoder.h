@@ -0,0 +1,106 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_COMMAND_ENCODER_H
+#define DIRECTX12_COMMAND_ENCODER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <span>
+
+#include "framework/render_manager/components/draw_list.h"
+
+namespace framework
+{
+	class JobSystem;
+
+	//~ One recording target, a command list on the device or a mock on the host.
+	//~ Begin opens it and binds the shared frame state, Record turns packets into draws.
+	class ICommandEncoder
+	{
+	public:
+		virtual ~ICommandEncoder() = default;
+
+		virtual void Begin () = 0;
+		virtual void Record(std::span<const DrawPacket> packets) = 0;
+		virtual void End   () = 0;
+	};
+
+	//~ Splits a sorted packet range into contiguous chunks and records each chunk on a worker
+	//~ into its own encoder. Chunk i always covers packets before chunk i + 1, so submitting
+	//~ encoders 0..n-1 in order keeps the sort.
+	class ParallelRecorder
+	{
+	public:
+		using AcquireEncoder = std::function<ICommandEncoder&(std::uint32_t chunk)>;
+
+		//~ upper bound for SetMaxChunks, pools size themselves from it
+		static constexpr std::uint32_t ChunkLimit{ 16u };
+
+		 ParallelRecorder() = default;
+		~ParallelRecorder() = default;
+
+		void SetJobSystem(JobSystem* jobs) noexcept { m_jobs = jobs; }
+
+		//~ chunks never get smaller than this, small lists stay on one encoder
+		void SetMinPacketsPerChunk(std::uint32_t count) noexcept { m_minPackets = count ? count : 1u; }
+		void SetMaxChunks		  (std::uint32_t count) noexcept { m_maxChunks	= std::clamp(count, 1u, ChunkLimit); }
+		std::uint32_t GetMaxChunks() const noexcept { return m_maxChunks; }
+
+		//~ chunk count a list of `packetCount` will be cut into
+		std::uint32_t GetChunkCount(std::uint32_t packetCount) const noexcept;
+
+		//~ [begin, end) of packets recorded by `chunk`
+		void GetChunkRange(std::uint32_t packetCount, std::uint32_t chunk,
+						   std::uint32_t& begin, std::uint32_t& end) const noexcept;
+
+		//~ blocks until every chunk is closed, returns how many encoders were used
+		std::uint32_t Record(std::span<const DrawPacket> packets, const AcquireEncoder& acquire);
+
+		void ImguiView();
+
+	private:
+		JobSystem* m_jobs{ nullptr };
+		std::uint32_t m_minPackets{ 64u };
+		std::uint32_t m_maxChunks { 4u };
+
+		//~ stats
+		std::uint32_t m_lastChunks{ 0u };
+		std::uint32_t m_lastPackets{ 0u };
+		float		  m_lastMicro { 0.0f };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_COMMAND_ENCODER_H
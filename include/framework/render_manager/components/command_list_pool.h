@@ -0,0 +1,122 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_COMMAND_LIST_POOL_H
+#define DIRECTX12_COMMAND_LIST_POOL_H
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+#include <d3d12.h>
+#include <wrl/client.h>
+
+#include "command_encoder.h"
+#include "command_state_cache.h"
+
+namespace framework
+{
+	//~ Direct command lists with one allocator each, a full set per frame in flight.
+	//~ A list only touches its own allocator, so every index can be recorded on a different thread.
+	//~ The frame's set is reused once the caller waited on that frame's fence.
+	class CommandListPool
+	{
+	public:
+		//~ both record through the encoder's state cache, which starts empty for every chunk
+		using BindState	  = std::function<void(CommandStateCache&)>;
+		using RecordDraws = std::function<void(CommandStateCache&, std::span<const DrawPacket>)>;
+
+		 CommandListPool() = default;
+		~CommandListPool() = default;
+
+		void Initialize(ID3D12Device* device, std::uint32_t frameCount, std::uint32_t listCount);
+
+		//~ selects the allocator set of `frameIndex`
+		void BeginFrame(std::uint32_t frameIndex);
+
+		//~ resets allocator and list `index` of the current frame, the list comes back open
+		ID3D12GraphicsCommandList* Open (std::uint32_t index, ID3D12PipelineState* initialState = nullptr);
+		void					   Close(std::uint32_t index);
+
+		//~ trades list `index` of the current frame with `other`, for code that always records into one fixed list
+		void Swap(std::uint32_t index, Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>& other);
+
+		//~ one ExecuteCommandLists: `head` first, then lists [0, count) of the current frame
+		void Execute(ID3D12CommandQueue* queue, ID3D12CommandList* head, std::uint32_t count);
+
+		//~ encoders open list `index`, bind the frame state and record their packets
+		void SetRecorder(BindState bind, RecordDraws record);
+		ICommandEncoder& GetEncoder(std::uint32_t index);
+
+		bool		  IsInitialized() const noexcept { return !m_frames.empty(); }
+		std::uint32_t GetListCount () const noexcept { return m_listCount; }
+
+		void ImguiView();
+
+	private:
+		class Encoder final : public ICommandEncoder
+		{
+		public:
+			Encoder(CommandListPool* pool, const std::uint32_t index) : m_pool(pool), m_index(index) {}
+
+			void Begin () override;
+			void Record(std::span<const DrawPacket> packets) override;
+			void End   () override;
+
+		private:
+			CommandListPool*  m_pool { nullptr };
+			std::uint32_t	  m_index{ 0u };
+			CommandStateCache m_cache{};
+		};
+
+		struct FrameLists
+		{
+			std::vector<Microsoft::WRL::ComPtr<ID3D12CommandAllocator>>	   Allocators;
+			std::vector<Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>> Lists;
+		};
+
+		std::vector<FrameLists> m_frames{};
+		std::vector<Encoder>	m_encoders{};
+		std::uint32_t m_listCount{ 0u };
+		std::uint32_t m_frameIndex{ 0u };
+
+		BindState	m_bind{};
+		RecordDraws m_record{};
+
+		//~ stats
+		std::uint32_t m_lastExecuted{ 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_COMMAND_LIST_POOL_H
@@ -0,0 +1,320 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_COMMAND_STATE_CACHE_H
+#define DIRECTX12_COMMAND_STATE_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <d3d12.h>
+
+namespace framework
+{
+	//~ Sits in front of a graphics command list and remembers what was bound last: heaps,
+	//~ root signature, pso, root arguments, topology and ib/vb views. Calls that would set
+	//~ the same value again are dropped and counted. Everything else goes straight through.
+	//~ List is the command list type, anything with the same calls works, the tests use a
+	//~ recording fake. The engine's one is instantiated once in command_state_cache.cpp.
+	template<typename List>
+	class BasicCommandStateCache
+	{
+	public:
+		static constexpr std::uint32_t MaxRootParameters{ 64u };
+		static constexpr std::uint32_t MaxVertexBuffers { D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT };
+		static constexpr std::uint32_t MaxHeaps			{ 2u }; // cbv/srv/uav + sampler
+
+		 BasicCommandStateCache() = default;
+		~BasicCommandStateCache() = default;
+		explicit BasicCommandStateCache(List* list) { Reset(list); }
+
+		//~ new list or a freshly reset one, nothing is bound
+		void Reset(List* list);
+
+		//~ after recording into the native list directly
+		void Invalidate();
+
+		void SetDescriptorHeaps		  (UINT count, ID3D12DescriptorHeap* const* heaps);
+		void SetGraphicsRootSignature (ID3D12RootSignature* signature);
+		void SetPipelineState		  (ID3D12PipelineState* pipeline);
+
+		void SetGraphicsRootConstantBufferView(UINT parameter, D3D12_GPU_VIRTUAL_ADDRESS address);
+		void SetGraphicsRootShaderResourceView(UINT parameter, D3D12_GPU_VIRTUAL_ADDRESS address);
+		void SetGraphicsRootDescriptorTable	  (UINT parameter, D3D12_GPU_DESCRIPTOR_HANDLE handle);
+		//~ only the first constant of a parameter is tracked, other offsets always go through
+		void SetGraphicsRoot32BitConstant	  (UINT parameter, UINT value, UINT offset);
+
+		void IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY topology);
+		void IASetIndexBuffer	   (const D3D12_INDEX_BUFFER_VIEW* view);
+		void IASetVertexBuffers	   (UINT startSlot, UINT count, const D3D12_VERTEX_BUFFER_VIEW* views);
+
+		void DrawIndexedInstanced(UINT indexCount, UINT instanceCount,
+								  UINT startIndex, INT baseVertex, UINT startInstance);
+
+		List* GetNative() const noexcept { return m_list; }
+
+		//~ since the last Reset
+		std::uint32_t GetIssued	 () const noexcept { return m_issued; }
+		std::uint32_t GetFiltered() const noexcept { return m_filtered; }
+		std::uint32_t GetDraws	 () const noexcept { return m_draws; }
+
+	private:
+		enum class ERootKind : std::uint8_t
+		{
+			None,
+			ConstantBuffer,
+			ShaderResource,
+			Table,
+			Constant
+		};
+
+		//~ true when the call has to reach the list
+		bool SetRootArgument(UINT parameter, ERootKind kind, std::uint64_t value);
+		bool Filter(bool redundant);
+
+	private:
+		List* m_list{ nullptr };
+
+		std::array<ID3D12DescriptorHeap*, MaxHeaps> m_heaps{};
+		UINT					 m_heapCount{ 0u };
+		ID3D12RootSignature*	 m_signature{ nullptr };
+		ID3D12PipelineState*	 m_pipeline { nullptr };
+		D3D_PRIMITIVE_TOPOLOGY	 m_topology { D3D_PRIMITIVE_TOPOLOGY_UNDEFINED };
+
+		bool					 m_bIndexValid{ false };
+		D3D12_INDEX_BUFFER_VIEW	 m_index{};
+
+		std::array<D3D12_VERTEX_BUFFER_VIEW, MaxVertexBuffers> m_vertices{};
+		std::uint64_t m_vertexValid{ 0u }; // bit per slot
+
+		std::array<std::uint64_t, MaxRootParameters> m_rootValues{};
+		std::array<ERootKind,	  MaxRootParameters> m_rootKinds {};
+
+		//~ stats
+		std::uint32_t m_issued	{ 0u };
+		std::uint32_t m_filtered{ 0u };
+		std::uint32_t m_draws	{ 0u };
+	};
+
+	template<typename List>
+	void BasicCommandStateCache<List>::Reset(List* list)
+	{
+		m_list = list;
+		Invalidate();
+
+		m_issued   = 0u;
+		m_filtered = 0u;
+		m_draws	   = 0u;
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::Invalidate()
+	{
+		m_heaps.fill(nullptr);
+		m_heapCount	  = 0u;
+		m_signature	  = nullptr;
+		m_pipeline	  = nullptr;
+		m_topology	  = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		m_bIndexValid = false;
+		m_vertexValid = 0u;
+		m_rootKinds.fill(ERootKind::None);
+	}
+
+	template<typename List>
+	bool BasicCommandStateCache<List>::Filter(const bool redundant)
+	{
+		if (redundant)
+		{
+			++m_filtered;
+			return false;
+		}
+
+		++m_issued;
+		return true;
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetDescriptorHeaps(const UINT count, ID3D12DescriptorHeap* const* heaps)
+	{
+		bool same = count == m_heapCount && count <= MaxHeaps;
+		for (UINT i = 0; same && i < count; ++i)
+			same = heaps[i] == m_heaps[i];
+
+		if (!Filter(same)) return;
+
+		m_list->SetDescriptorHeaps(count, heaps);
+
+		m_heapCount = count;
+		for (UINT i = 0; i < MaxHeaps; ++i)
+			m_heaps[i] = i < count ? heaps[i] : nullptr;
+
+		//~ tables point into the old heaps
+		for (auto& kind : m_rootKinds)
+			if (kind == ERootKind::Table) kind = ERootKind::None;
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetGraphicsRootSignature(ID3D12RootSignature* signature)
+	{
+		if (!Filter(signature == m_signature)) return;
+
+		m_list->SetGraphicsRootSignature(signature);
+		m_signature = signature;
+
+		//~ a new signature drops every root argument
+		m_rootKinds.fill(ERootKind::None);
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetPipelineState(ID3D12PipelineState* pipeline)
+	{
+		if (!Filter(pipeline == m_pipeline)) return;
+
+		m_list->SetPipelineState(pipeline);
+		m_pipeline = pipeline;
+	}
+
+	template<typename List>
+	bool BasicCommandStateCache<List>::SetRootArgument(const UINT parameter, const ERootKind kind, const std::uint64_t value)
+	{
+		//~ out of range parameters are not tracked, the list validates them
+		if (parameter >= MaxRootParameters) return Filter(false);
+
+		const bool same = m_rootKinds[parameter] == kind && m_rootValues[parameter] == value;
+		if (!Filter(same)) return false;
+
+		m_rootKinds [parameter] = kind;
+		m_rootValues[parameter] = value;
+		return true;
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetGraphicsRootConstantBufferView(const UINT parameter, const D3D12_GPU_VIRTUAL_ADDRESS address)
+	{
+		if (SetRootArgument(parameter, ERootKind::ConstantBuffer, address))
+			m_list->SetGraphicsRootConstantBufferView(parameter, address);
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetGraphicsRootShaderResourceView(const UINT parameter, const D3D12_GPU_VIRTUAL_ADDRESS address)
+	{
+		if (SetRootArgument(parameter, ERootKind::ShaderResource, address))
+			m_list->SetGraphicsRootShaderResourceView(parameter, address);
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetGraphicsRootDescriptorTable(const UINT parameter, const D3D12_GPU_DESCRIPTOR_HANDLE handle)
+	{
+		if (SetRootArgument(parameter, ERootKind::Table, handle.ptr))
+			m_list->SetGraphicsRootDescriptorTable(parameter, handle);
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::SetGraphicsRoot32BitConstant(const UINT parameter, const UINT value, const UINT offset)
+	{
+		if (offset != 0u)
+		{
+			Filter(false);
+			if (parameter < MaxRootParameters) m_rootKinds[parameter] = ERootKind::None;
+			m_list->SetGraphicsRoot32BitConstant(parameter, value, offset);
+			return;
+		}
+
+		if (SetRootArgument(parameter, ERootKind::Constant, value))
+			m_list->SetGraphicsRoot32BitConstant(parameter, value, offset);
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::IASetPrimitiveTopology(const D3D_PRIMITIVE_TOPOLOGY topology)
+	{
+		if (!Filter(topology == m_topology)) return;
+
+		m_list->IASetPrimitiveTopology(topology);
+		m_topology = topology;
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* view)
+	{
+		const bool same = view && m_bIndexValid &&
+			std::memcmp(view, &m_index, sizeof(D3D12_INDEX_BUFFER_VIEW)) == 0;
+		if (!Filter(same)) return;
+
+		m_list->IASetIndexBuffer(view);
+		m_bIndexValid = view != nullptr;
+		if (view) m_index = *view;
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::IASetVertexBuffers(const UINT startSlot, const UINT count, const D3D12_VERTEX_BUFFER_VIEW* views)
+	{
+		const bool tracked = views && startSlot + count <= MaxVertexBuffers;
+
+		bool same = tracked;
+		for (UINT i = 0; same && i < count; ++i)
+		{
+			const UINT slot = startSlot + i;
+			same = (m_vertexValid >> slot & 1ull) &&
+				std::memcmp(&views[i], &m_vertices[slot], sizeof(D3D12_VERTEX_BUFFER_VIEW)) == 0;
+		}
+		if (!Filter(same)) return;
+
+		m_list->IASetVertexBuffers(startSlot, count, views);
+
+		for (UINT i = 0; i < count && startSlot + i < MaxVertexBuffers; ++i)
+		{
+			const UINT slot = startSlot + i;
+			if (tracked)
+			{
+				m_vertices[slot] = views[i];
+				m_vertexValid |= 1ull << slot;
+			}
+			else m_vertexValid &= ~(1ull << slot);
+		}
+	}
+
+	template<typename List>
+	void BasicCommandStateCache<List>::DrawIndexedInstanced(
+		const UINT indexCount, const UINT instanceCount,
+		const UINT startIndex, const INT baseVertex, const UINT startInstance)
+	{
+		m_list->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+		++m_draws;
+	}
+
+	using CommandStateCache = BasicCommandStateCache<ID3D12GraphicsCommandList>;
+	extern template class BasicCommandStateCache<ID3D12GraphicsCommandList>;
+} // namespace framework
+
+#endif //DIRECTX12_COMMAND_STATE_CACHE_H
@@ -0,0 +1,116 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_CONCURRENT_DESCRIPTOR_ALLOCATOR_H
+#define DIRECTX12_CONCURRENT_DESCRIPTOR_ALLOCATOR_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace framework
+{
+	//~ Lock free descriptor allocation for any thread, no device involved. The range is cut into
+	//~ fixed blocks kept on a tagged (ABA safe) lock free stack. Every thread bump allocates from
+	//~ a block it took off the stack and only touches the stack again once that block runs out.
+	//~ A block counts the slots still alive plus an owner bit, whichever of the owning thread
+	//~ letting go and the last Free brings it to zero pushes it back. A thread's unused tail stays
+	//~ with the block until every slot of it was freed. Requests are capped at one block.
+	class ConcurrentDescriptorAllocator
+	{
+	public:
+		static constexpr std::uint32_t InvalidIndex{ 0xFFFFFFFFu };
+		static constexpr std::uint32_t MaxThreads  { 64u }; // threads past this take a block per call
+
+		 ConcurrentDescriptorAllocator() = default;
+		~ConcurrentDescriptorAllocator() = default;
+
+		ConcurrentDescriptorAllocator(const ConcurrentDescriptorAllocator&)			   = delete;
+		ConcurrentDescriptorAllocator& operator=(const ConcurrentDescriptorAllocator&) = delete;
+
+		//~ not thread safe, drops every allocation and every thread's block
+		void Initialize(std::uint32_t base, std::uint32_t count, std::uint32_t blockSize);
+
+		//~ any thread, InvalidIndex when count is past a block or no block is free
+		std::uint32_t Allocate(std::uint32_t count);
+		//~ any thread, the range has to come from one Allocate
+		void		  Free	  (std::uint32_t index, std::uint32_t count);
+
+		//~ the calling thread lets go of its block, e.g. before it exits
+		void ReleaseThreadCache();
+
+		bool Owns(const std::uint32_t index) const noexcept
+		{
+			return index >= m_base && index - m_base < m_blockCount * m_blockSize;
+		}
+
+		bool		  IsInitialized () const noexcept { return m_blockCount != 0u; }
+		std::uint32_t GetBlockSize	() const noexcept { return m_blockSize; }
+		std::uint32_t GetBlockCount () const noexcept { return m_blockCount; }
+		std::uint32_t GetFreeBlocks () const noexcept { return m_freeBlocks.load(std::memory_order_relaxed); }
+		std::uint32_t GetAllocated	() const noexcept { return m_allocated.load(std::memory_order_relaxed); }
+
+	private:
+		static constexpr std::uint32_t OwnedBit{ 1u << 31u };
+
+		struct ThreadCache
+		{
+			std::uint32_t Block{ InvalidIndex };
+			std::uint32_t Next { 0u };
+		};
+
+		std::uint32_t PopBlock ();
+		void		  PushBlock(std::uint32_t block);
+		//~ drops count from the block's state, recycles it on zero
+		void		  Release  (std::uint32_t block, std::uint32_t count);
+
+	private:
+		std::uint32_t m_base	  { 0u };
+		std::uint32_t m_blockSize { 1u };
+		std::uint32_t m_blockCount{ 0u };
+
+		//~ low half index of the top block, high half a tag bumped on every change
+		std::atomic<std::uint64_t> m_head{ InvalidIndex };
+		std::unique_ptr<std::atomic<std::uint32_t>[]> m_next;
+		std::unique_ptr<std::atomic<std::uint32_t>[]> m_state; // live slots | OwnedBit
+
+		std::array<ThreadCache, MaxThreads> m_caches{};
+
+		std::atomic<std::uint32_t> m_freeBlocks{ 0u };
+		std::atomic<std::uint32_t> m_allocated { 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_CONCURRENT_DESCRIPTOR_ALLOCATOR_H
@@ -35,14 +35,23 @@
 #ifndef DIRECTX12_DESCRIPTOR_HEAP_H
 #define DIRECTX12_DESCRIPTOR_HEAP_H
 
+#include <atomic>
 #include <cstdint>
 #include <d3d12.h>
-#include <vector>
 #include <wrl/client.h>
+#include <mutex>
 #include <string>
+#include <vector>
+
+#include "concurrent_descriptor_allocator.h"
+#include "descriptor_range_allocator.h"
+#include "slot_map.h"
 
 namespace framework
 {
+	//~ owner side of a relocatable range, resolved through the heap every time it is used
+	using DescriptorHandle = SlotHandle;
+
 	struct InitDescriptorHeap
 	{
 		std::uint32_t				AllocationSize;
@@ -53,6 +62,12 @@ namespace framework
 		std::string szDebugName{ "Default" };
 	};
 
+	//~ contiguous descriptor ranges come from a DescriptorRangeAllocator, allocate and free
+	//~ cost the same no matter how big or fragmented the heap is. Once concurrent allocation is
+	//~ enabled, Allocate and Deallocate are safe from any thread: requests up to a block go through
+	//~ the lock free per thread blocks, anything bigger (or left over when those run dry) takes a lock.
+	//~ Ranges handed out as handles may be moved by Compact, owners look the index up when they use it.
+	//~ Handles always come from the range allocator, the concurrent range never moves
 	class DescriptorHeap
 	{
 	public:
@@ -64,24 +79,69 @@ namespace framework
 		std::uint32_t Allocate(const std::uint32_t& allocCounts = 1u);
 		void Deallocate(const std::uint32_t index, const std::uint32_t count = 1u);
 
+		//~ carves count descriptors out for the lock free path, call once before other threads allocate
+		void EnableConcurrentAllocation(std::uint32_t count, std::uint32_t blockSize = 32u);
+		bool IsConcurrent() const noexcept { return m_concurrent.IsInitialized(); }
+
+		DescriptorHandle AllocateHandle(std::uint32_t count = 1u);
+		void			 Deallocate	   (DescriptorHandle handle);
+		std::uint32_t	 GetIndex	   (DescriptorHandle handle) const; // InvalidIndex when stale
+
+		//~ slides handle ranges down into the first hole that fits, views are copied on the CPU so
+		//~ only heaps the shaders can't see qualify. Returns how many ranges moved
+		std::uint32_t Compact();
+
 		ID3D12DescriptorHeap* GetNative() const;
 
 		D3D12_CPU_DESCRIPTOR_HANDLE GetCPUHandle(std::uint32_t index) const;
+		D3D12_CPU_DESCRIPTOR_HANDLE GetCPUHandle(DescriptorHandle handle) const;
+		//~ zero handle for heaps the shaders can't see
 		D3D12_GPU_DESCRIPTOR_HANDLE GetGPUHandle(std::uint32_t index) const;
 
+		D3D12_DESCRIPTOR_HEAP_TYPE GetType() const noexcept { return m_type; }
+		bool IsShaderVisible() const noexcept { return m_bShaderVisible; }
+
 		bool IsValid  () const;
-		void ImguiView() const;
+		void ImguiView();
 
 		std::uint32_t GetAllocatedCounts() const;
 		std::uint32_t GetAllocationSize () const;
 
+	private:
+		//~ bConcurrent lets small requests take the lock free path
+		std::uint32_t Allocate(std::uint32_t count, bool bConcurrent);
+
 	private:
 		bool m_bInitialized{ false };
-		std::vector<bool> m_allocatedMap{};
+		DescriptorRangeAllocator m_ranges{};
 		std::uint32_t m_heapIncrement	{};
+		D3D12_DESCRIPTOR_HEAP_TYPE m_type{ D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV };
+		bool m_bShaderVisible{ false };
 
 		std::uint32_t m_allocationMaxSize{ 1u };
-		std::uint32_t m_allocationCount	 { 0u };
+		std::atomic<std::uint32_t> m_allocationCount{ 0u };
+
+		ConcurrentDescriptorAllocator m_concurrent{};
+		std::uint32_t m_concurrentBase{ 0u };
+		mutable std::mutex m_rangeLock; // range allocator and handle table
+
+		struct HandleRange
+		{
+			std::uint32_t Index;
+			std::uint32_t Count;
+		};
+
+		SlotMapCore				 m_handles{};
+		std::vector<HandleRange> m_handleRanges; // dense, mirrors m_handles
+
+		//~ churn counters, the view shows their totals and what changed since it last ran
+		std::atomic<std::uint64_t> m_allocateCalls{ 0u };
+		std::atomic<std::uint64_t> m_freeCalls	  { 0u };
+		std::uint64_t m_seenAllocateCalls{ 0u };
+		std::uint64_t m_seenFreeCalls	 { 0u };
+		std::uint32_t m_lastMoved		 { 0u };
+
+		std::vector<DescriptorRangeAllocator::Run> m_runs; // reused by the view
 
 		std::string m_szDescriptorHeapName{ "Default" };
 
@@ -0,0 +1,121 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_DEFERRED_RELEASE_QUEUE_H
+#define DIRECTX12_DEFERRED_RELEASE_QUEUE_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace framework
+{
+	//~ Holds on to whatever the gpu may still read until the fence value of the frame that last
+	//~ used it has completed. Callers pass the value the current frame will signal, Retire gets
+	//~ the fence's completed value, so the queue never touches a device and a plain counter can
+	//~ stand in for the fence. Entries retire in the order they came in, a value smaller than
+	//~ one queued before it simply waits for that one as well.
+	class DeferredReleaseQueue
+	{
+	public:
+		 DeferredReleaseQueue() = default;
+		~DeferredReleaseQueue() = default;
+
+		DeferredReleaseQueue(const DeferredReleaseQueue&)			 = delete;
+		DeferredReleaseQueue& operator=(const DeferredReleaseQueue&) = delete;
+
+		//~ keeps a ComPtr or anything else movable alive until the fence passes
+		template<typename T>
+		void Keep(const std::uint64_t fenceValue, T&& object)
+		{
+			Push(fenceValue, std::make_shared<std::decay_t<T>>(std::forward<T>(object)), {}, 0u);
+		}
+
+		//~ heap is anything with Deallocate(index, count), e.g. DescriptorHeap
+		template<typename Heap>
+		void FreeDescriptors(const std::uint64_t fenceValue, Heap& heap, const std::uint32_t index, const std::uint32_t count)
+		{
+			Push(fenceValue, nullptr, [&heap, index, count] { heap.Deallocate(index, count); }, count);
+		}
+
+		//~ same for a range owned through a handle, it is looked up when it retires so a Compact in between is fine
+		template<typename Heap, typename Handle>
+		void FreeHandle(const std::uint64_t fenceValue, Heap& heap, const Handle handle, const std::uint32_t count)
+		{
+			Push(fenceValue, nullptr, [&heap, handle] { heap.Deallocate(handle); }, count);
+		}
+
+		//~ runs release once the fence passes
+		void Defer(std::uint64_t fenceValue, std::function<void()> release);
+
+		//~ retires every entry whose fence value completed, returns how many went
+		std::uint32_t Retire(std::uint64_t completedFenceValue);
+
+		//~ everything at once, only when the gpu is known to be idle
+		void Flush();
+
+		std::uint32_t GetPendingCount	   () const noexcept { return static_cast<std::uint32_t>(m_pending.size()); }
+		std::uint32_t GetPendingDescriptors() const noexcept { return m_pendingDescriptors; }
+		std::uint64_t GetRetiredCount	   () const noexcept { return m_retired; }
+		std::uint32_t GetPeakPending	   () const noexcept { return m_peakPending; }
+
+		void ImguiView();
+
+	private:
+		struct Entry
+		{
+			std::uint64_t		  FenceValue{ 0u };
+			std::shared_ptr<void> Object;
+			std::function<void()> Release;
+			std::uint32_t		  Descriptors{ 0u };
+		};
+
+		void Push(std::uint64_t fenceValue, std::shared_ptr<void> object,
+				  std::function<void()> release, std::uint32_t descriptors);
+
+		void RetireFront();
+
+	private:
+		std::deque<Entry> m_pending;
+		std::uint32_t	  m_pendingDescriptors{ 0u };
+		std::uint32_t	  m_peakPending		  { 0u };
+		std::uint64_t	  m_retired			  { 0u };
+		std::uint64_t	  m_lastCompleted	  { 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_DEFERRED_RELEASE_QUEUE_H
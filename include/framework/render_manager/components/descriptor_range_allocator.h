@@ -0,0 +1,154 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_DESCRIPTOR_RANGE_ALLOCATOR_H
+#define DIRECTX12_DESCRIPTOR_RANGE_ALLOCATOR_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	//~ Two level segregated fit (TLSF) over index ranges, no device involved. Free runs sit in
+	//~ lists by size class, a power of two split sixteen ways, and two bitmaps tell which lists
+	//~ are non empty so allocate finds a big enough run with a couple of bit scans. Free runs keep
+	//~ their size at the first index and their start at the last one, freeing looks at both
+	//~ neighbours and merges with whichever is free. A used bit per index lets Free skip slots
+	//~ that were never handed out, like the old bit map did.
+	class DescriptorRangeAllocator
+	{
+	public:
+		static constexpr std::uint32_t InvalidIndex{ 0xFFFFFFFFu };
+
+		static constexpr std::uint32_t SecondLevelBits { 4u };
+		static constexpr std::uint32_t SecondLevelCount{ 1u << SecondLevelBits };
+		static constexpr std::uint32_t FirstLevelCount { 32u - SecondLevelBits + 1u };
+
+		 DescriptorRangeAllocator() = default;
+		~DescriptorRangeAllocator() = default;
+
+		//~ drops every allocation, the whole range becomes one free run
+		void Reset(std::uint32_t capacity);
+
+		//~ first index of count contiguous slots, InvalidIndex when no free run is long enough
+		std::uint32_t Allocate(std::uint32_t count);
+
+		//~ returns how many of the slots were in use, the rest are ignored
+		std::uint32_t Free(std::uint32_t index, std::uint32_t count);
+
+		//~ claims exactly [index, index + count), false when any slot of it is taken
+		bool AllocateAt(std::uint32_t index, std::uint32_t count);
+		//~ lowest index at or below limit where count free slots start, InvalidIndex if there is none
+		std::uint32_t FindFirstFit(std::uint32_t count, std::uint32_t limit) const;
+		//~ moves a fully used range to the lowest start that fits, its own slots count as free.
+		//~ returns the new start, index itself when nothing lower fits
+		std::uint32_t Relocate(std::uint32_t index, std::uint32_t count);
+
+		bool IsAllocated(std::uint32_t index) const
+		{
+			return (m_used[index >> 6u] >> (index & 63u)) & 1u;
+		}
+
+		std::uint32_t GetCapacity	   () const noexcept { return m_capacity; }
+		std::uint32_t GetAllocatedCount() const noexcept { return m_allocated; }
+		std::uint32_t GetFreeRunCount  () const noexcept { return m_freeRuns; }
+		std::uint32_t GetLargestFreeRun() const;
+
+		//~ first used / free index at or after from, capacity when there is none
+		std::uint32_t NextUsed(std::uint32_t from) const;
+		std::uint32_t NextFree(std::uint32_t from) const;
+
+		//~ used and free stretches in index order, alternating, together they cover the capacity
+		struct Run
+		{
+			std::uint32_t Start{ 0u };
+			std::uint32_t Count{ 0u };
+			bool		  bUsed{ false };
+		};
+
+		void CollectRuns(std::vector<Run>& runs) const;
+
+		//~ free runs bucketed by length: 1, 2-3, 4-7 ... the last bucket takes everything longer
+		static constexpr std::uint32_t HistogramBuckets{ 12u };
+
+		struct FragmentationStats
+		{
+			std::uint32_t FreeSlots		{ 0u };
+			std::uint32_t FreeRuns		{ 0u };
+			std::uint32_t LargestFreeRun{ 0u };
+			float		  Fragmentation { 0.0f }; // 1 - largest / free, zero while all free space is one run
+			std::array<std::uint32_t, HistogramBuckets> Histogram{};
+		};
+
+		//~ walks the free lists, costs one step per free run
+		FragmentationStats GetFragmentation() const;
+
+	private:
+		struct Mapping
+		{
+			std::uint32_t First;
+			std::uint32_t Second;
+		};
+
+		static Mapping MapInsert(std::uint32_t size);
+		static Mapping MapSearch(std::uint32_t size);
+
+		void InsertFree(std::uint32_t start, std::uint32_t size);
+		void RemoveFree(std::uint32_t start);
+		std::uint32_t FindFree(std::uint32_t size) const;
+
+		void MarkUsed(std::uint32_t index, std::uint32_t count, bool bUsed);
+
+	private:
+		std::uint32_t m_capacity { 0u };
+		std::uint32_t m_allocated{ 0u };
+		std::uint32_t m_freeRuns { 0u };
+
+		std::uint32_t m_firstBitmap{ 0u };
+		std::array<std::uint32_t, FirstLevelCount> m_secondBitmap{};
+		std::array<std::uint32_t, FirstLevelCount * SecondLevelCount> m_heads{};
+
+		//~ only meaningful at the edges of free runs: size and list links at the first index,
+		//~ run start at the last one, zero size / InvalidIndex everywhere else
+		std::vector<std::uint32_t> m_runSize;
+		std::vector<std::uint32_t> m_runStart;
+		std::vector<std::uint32_t> m_next;
+		std::vector<std::uint32_t> m_prev;
+
+		std::vector<std::uint64_t> m_used;
+	};
+} // namespace framework
+
+#endif //DIRECTX12_DESCRIPTOR_RANGE_ALLOCATOR_H
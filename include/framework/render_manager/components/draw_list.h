@@ -0,0 +1,118 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/15/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_DRAW_LIST_H
+#define DIRECTX12_DRAW_LIST_H
+
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	//~ 64 bit sort key, most significant field first:
+	//~ [ layer 4 | pipeline 8 | material 12 | mesh 16 | depth 24 ]
+	namespace DrawKey
+	{
+		constexpr std::uint32_t LayerBits	 { 4u };
+		constexpr std::uint32_t PipelineBits { 8u };
+		constexpr std::uint32_t MaterialBits { 12u };
+		constexpr std::uint32_t MeshBits	 { 16u };
+		constexpr std::uint32_t DepthBits	 { 24u };
+
+		constexpr std::uint32_t DepthShift	 { 0u };
+		constexpr std::uint32_t MeshShift	 { DepthShift + DepthBits };
+		constexpr std::uint32_t MaterialShift{ MeshShift + MeshBits };
+		constexpr std::uint32_t PipelineShift{ MaterialShift + MaterialBits };
+		constexpr std::uint32_t LayerShift	 { PipelineShift + PipelineBits };
+
+		static_assert(LayerShift + LayerBits == 64u);
+
+		constexpr std::uint64_t Field(const std::uint64_t value, const std::uint32_t bits, const std::uint32_t shift)
+		{
+			return (value & ((1ull << bits) - 1ull)) << shift;
+		}
+
+		constexpr std::uint64_t Make(
+			const std::uint32_t layer, const std::uint32_t pipeline,
+			const std::uint32_t material, const std::uint32_t mesh,
+			const std::uint32_t depth)
+		{
+			return Field(layer,	   LayerBits,	 LayerShift)
+				 | Field(pipeline, PipelineBits, PipelineShift)
+				 | Field(material, MaterialBits, MaterialShift)
+				 | Field(mesh,	   MeshBits,	 MeshShift)
+				 | Field(depth,	   DepthBits,	 DepthShift);
+		}
+
+		//~ distance mapped to [0, 2^24), near first. flip it for back to front layers
+		std::uint32_t QuantizeDepth(float distance, float farZ);
+	}
+
+	struct DrawPacket
+	{
+		std::uint64_t Key;
+		std::uint32_t Item; // index into the caller's own item table
+		std::uint32_t Pad;
+	};
+
+	//~ Visible items are pushed as packets every frame, sorted once by key so the submit
+	//~ loop sees equal pipelines, materials and meshes next to each other.
+	class DrawList
+	{
+	public:
+		 DrawList() = default;
+		~DrawList() = default;
+
+		void Clear  () { m_packets.clear(); }
+		void Reserve(std::uint32_t count);
+		void Add	(std::uint64_t key, std::uint32_t item) { m_packets.push_back({ key, item, 0u }); }
+		void Sort	();
+
+		const std::vector<DrawPacket>& GetPackets() const { return m_packets; }
+
+		//~ lsd radix sort on 8 bit digits, stable. digits that are equal in every key are skipped
+		static void RadixSort(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch);
+
+		void ImguiView();
+
+	private:
+		std::vector<DrawPacket> m_packets{};
+		std::vector<DrawPacket> m_scratch{};
+
+		//~ stats
+		float m_lastSortMicro{ 0.0f };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_DRAW_LIST_H
@@ -0,0 +1,118 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/10/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_DYNAMIC_MESH_SCHEDULER_H
+#define DIRECTX12_DYNAMIC_MESH_SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace framework
+{
+	class JobSystem;
+
+	struct DynamicMeshSchedulerConfig
+	{
+		std::uint32_t RowCount			{ 0u };
+		float		  RowFraction		{ 0.25f };	 // share of rows refreshed per frame (0..1]
+		float		  BudgetMicroseconds{ 2000.0f }; // hard cpu cap per frame
+		float		  DistanceFalloff	{ 0.15f };	 // how strongly camera distance lowers priority
+		std::uint32_t ParallelGrain		{ 4u };		 // rows per job when a job system is attached
+	};
+
+	struct DirtyRowRange
+	{
+		std::uint32_t FirstRow;
+		std::uint32_t RowCount;
+	};
+
+	//~ Amortizes updates of a row based dynamic mesh (grid, river, ocean) over several frames.
+	//~ Every frame the stalest rows nearest to the camera are refreshed until either the row
+	//~ quota or the time budget runs out; refreshed rows are remembered as dirty so only
+	//~ those ranges have to be copied to the gpu.
+	class DynamicMeshScheduler
+	{
+	public:
+		 DynamicMeshScheduler() = default;
+		~DynamicMeshScheduler() = default;
+
+		void Initialize(const DynamicMeshSchedulerConfig& config);
+
+		void SetRowFraction		  (float fraction);
+		void SetBudgetMicroseconds(float micro);
+
+		//~ rows are then refreshed in parallel, updateRow must only touch its own row
+		void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+		//~ rowDistances[i] is the camera distance of row i, updateRow is called for every picked row.
+		//~ returns number of rows refreshed this frame
+		std::uint32_t Update(
+			const std::vector<float>& rowDistances,
+			const std::function<void(std::uint32_t row)>& updateRow);
+
+		void MarkDirty	  (std::uint32_t firstRow, std::uint32_t rowCount = 1u);
+		void MarkAllStale ();
+
+		//~ coalesces dirty rows into contiguous ranges and clears the dirty state
+		void CollectDirtyRanges(std::vector<DirtyRowRange>& out);
+
+		const std::vector<std::uint32_t>& GetUpdatedRows() const { return m_updatedRows; }
+
+		bool		  IsInitialized() const { return m_config.RowCount > 0u; }
+		std::uint32_t GetRowCount  () const { return m_config.RowCount; }
+
+		void ImguiView();
+
+	private:
+		DynamicMeshSchedulerConfig m_config{};
+		JobSystem*				   m_jobs  { nullptr };
+
+		std::vector<std::uint32_t> m_age;		  // frames since last refresh
+		std::vector<std::uint8_t>  m_dirty;		  // waiting for upload
+		std::vector<std::uint32_t> m_order;		  // scratch, candidate rows
+		std::vector<float>		   m_score;		  // scratch, priority per row
+		std::vector<std::uint32_t> m_updatedRows; // refreshed in last Update
+
+		//~ stats
+		std::uint32_t m_lastRowsUpdated	   { 0u };
+		std::uint32_t m_lastRangesUploaded { 0u };
+		std::uint32_t m_lastRowsUploaded   { 0u };
+		std::uint32_t m_maxAge			   { 0u };
+		float		  m_lastElapsedMicro   { 0.0f };
+		bool		  m_bLastBudgetHit	   { false };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_DYNAMIC_MESH_SCHEDULER_H
@@ -0,0 +1,96 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/15/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_FRUSTUM_CULLER_H
+#define DIRECTX12_FRUSTUM_CULLER_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	//~ Boxes are collected as world space center / extents arrays and tested against the six
+	//~ frustum planes four at a time, one box per simd lane. Survivors land in a compacted
+	//~ list of the ids they were added with. No device involved.
+	class FrustumCuller
+	{
+	public:
+		 FrustumCuller() = default;
+		~FrustumCuller() = default;
+
+		//~ view * projection in the usual row vector layout, not transposed
+		void SetViewProjection(const DirectX::XMFLOAT4X4& viewProjection);
+
+		void Clear  ();
+		void Reserve(std::uint32_t count);
+
+		//~ local box moved into world by a transposed world matrix, the layout the transform store keeps
+		void Add(std::uint32_t id,
+				 const DirectX::XMFLOAT3& center,
+				 const DirectX::XMFLOAT3& extents,
+				 const DirectX::XMFLOAT4X4& worldTransposed);
+
+		void AddWorld(std::uint32_t id,
+					  const DirectX::XMFLOAT3& center,
+					  const DirectX::XMFLOAT3& extents);
+
+		//~ returns number of visible boxes. leaves the boxes alone, more can be added and culled again
+		std::uint32_t Cull();
+
+		const std::vector<std::uint32_t>& GetVisible() const { return m_visible; }
+		std::uint32_t GetCount() const noexcept { return static_cast<std::uint32_t>(m_ids.size()); }
+
+		//~ world box of the index-th entry in add order
+		void GetWorldBounds(std::uint32_t index, DirectX::XMFLOAT3& center, DirectX::XMFLOAT3& extents) const;
+
+		void ImguiView();
+
+	private:
+		DirectX::XMFLOAT4 m_planes[6]{}; // xyz inward normal, w distance
+
+		//~ always padded to whole groups of four, m_ids holds the real count
+		std::vector<float> m_centerX, m_centerY, m_centerZ;
+		std::vector<float> m_extentX, m_extentY, m_extentZ;
+		std::vector<std::uint32_t> m_ids;
+		std::vector<std::uint32_t> m_visible;
+
+		//~ stats
+		std::uint32_t m_lastTested { 0u };
+		std::uint32_t m_lastVisible{ 0u };
+		float		  m_lastMicro  { 0.0f };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_FRUSTUM_CULLER_H
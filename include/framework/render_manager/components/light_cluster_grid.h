@@ -0,0 +1,180 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_LIGHT_CLUSTER_GRID_H
+#define DIRECTX12_LIGHT_CLUSTER_GRID_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	class JobSystem;
+
+	//~ where a cluster's lights start in the index list and how many there are
+	struct ClusterRange
+	{
+		std::uint32_t Offset{ 0u };
+		std::uint32_t Count { 0u };
+	};
+
+	//~ Splits the view frustum into screen tiles and exponential depth slices and lists the point
+	//~ and spot lights reaching each cluster. Lights are kept as view space float arrays and tested
+	//~ four per simd lane set: sphere against the cluster box, spots also cone against the box's
+	//~ bounding sphere. Every slice first narrows the lights down to itself, then to a tile row,
+	//~ and slices run on the job pool. Output is one compact index list plus an offset / count
+	//~ pair per cluster, light ids follow the order the lights were added in. No device involved.
+	class LightClusterGrid
+	{
+	public:
+		static constexpr std::uint32_t DefaultCountX	  { 16u };
+		static constexpr std::uint32_t DefaultCountY	  { 9u };
+		static constexpr std::uint32_t DefaultCountZ	  { 24u };
+		static constexpr std::uint32_t MaxLightsPerCluster{ 256u };
+		static constexpr std::uint32_t ParallelThreshold  { 64u };			  // lights before the job pool is used
+		static constexpr float		   SpotCutoff		  { 1.0f / 256.0f }; // spot factor below this is dark
+
+		 LightClusterGrid() = default;
+		~LightClusterGrid() = default;
+
+		void SetGridSize (std::uint32_t countX, std::uint32_t countY, std::uint32_t countZ);
+		void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+		//~ view in the usual row vector layout, projection has to be a symmetric perspective one
+		void SetView(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& projection,
+					 float nearZ, float farZ);
+
+		void Clear  ();
+		void Reserve(std::uint32_t count);
+
+		//~ world space, both return the light id
+		std::uint32_t AddPoint(const DirectX::XMFLOAT3& position, float range);
+		std::uint32_t AddSpot (const DirectX::XMFLOAT3& position,
+							   const DirectX::XMFLOAT3& direction,
+							   float range, float spotPower);
+
+		//~ rebuilds ranges and indices, returns the index count
+		std::uint32_t Assign();
+
+		const std::vector<ClusterRange>&  GetRanges () const { return m_ranges; }
+		const std::vector<std::uint32_t>& GetIndices() const { return m_indices; }
+
+		std::uint32_t GetCountX		 () const noexcept { return m_countX; }
+		std::uint32_t GetCountY		 () const noexcept { return m_countY; }
+		std::uint32_t GetCountZ		 () const noexcept { return m_countZ; }
+		std::uint32_t GetClusterCount() const noexcept { return m_countX * m_countY * m_countZ; }
+		std::uint32_t GetLightCount	 () const noexcept { return static_cast<std::uint32_t>(m_worldX.size()); }
+
+		//~ slice = log(viewZ) * scale + bias, what the shader needs to find its cluster
+		float GetDepthScale() const noexcept { return m_depthScale; }
+		float GetDepthBias () const noexcept { return m_depthBias; }
+
+		void ImguiView();
+
+	private:
+		struct Box
+		{
+			float MinX, MinY, MinZ;
+			float MaxX, MaxY, MaxZ;
+		};
+
+		//~ view space lights, points carry a zero direction and cos -1 so the cone test lets them by
+		struct LightSet
+		{
+			std::vector<float> X, Y, Z, Radius;
+			std::vector<float> DirX, DirY, DirZ, Cos, Sin;
+			std::vector<std::uint32_t> Ids;
+
+			void Clear();
+			void Push (const LightSet& from, std::uint32_t index);
+			//~ tail lanes read zeros, callers only look at the first Ids.size() results
+			void Pad  ();
+		};
+
+		struct SliceScratch
+		{
+			LightSet Slice;
+			LightSet Row;
+			std::vector<std::uint32_t> Hits;
+			std::vector<std::uint32_t> Indices;
+			std::uint32_t Dropped{ 0u };
+		};
+
+		void RebuildBoxes	();
+		void TransformLights();
+		void AssignSlice	(std::uint32_t slice);
+		Box	 MakeBox		(float ndcX0, float ndcX1, float ndcY0, float ndcY1, float z0, float z1) const;
+
+		//~ positions in `lights` touching the box, simd over four lights at a time
+		static void Filter(const LightSet& lights, const Box& box, std::vector<std::uint32_t>& hits);
+
+	private:
+		JobSystem* m_jobs{ nullptr };
+
+		std::uint32_t m_countX{ DefaultCountX };
+		std::uint32_t m_countY{ DefaultCountY };
+		std::uint32_t m_countZ{ DefaultCountZ };
+
+		DirectX::XMFLOAT4X4 m_view{};
+		float m_projX	 { 1.0f }; // projection _11
+		float m_projY	 { 1.0f }; // projection _22
+		float m_nearZ	 { 0.1f };
+		float m_farZ	 { 1000.0f };
+		float m_depthScale{ 0.0f };
+		float m_depthBias { 0.0f };
+
+		//~ slice, row (slice * y + row) and cluster ((slice * y + row) * x + column) boxes
+		std::vector<Box> m_sliceBoxes;
+		std::vector<Box> m_rowBoxes;
+		std::vector<Box> m_clusterBoxes;
+
+		//~ world space input
+		std::vector<float> m_worldX, m_worldY, m_worldZ, m_range;
+		std::vector<float> m_worldDirX, m_worldDirY, m_worldDirZ, m_spotPower;
+
+		LightSet				  m_lights;
+		std::vector<SliceScratch> m_scratch;
+		std::vector<ClusterRange>  m_ranges;
+		std::vector<std::uint32_t> m_indices;
+
+		//~ stats
+		std::uint32_t m_lastMaxPerCluster{ 0u };
+		std::uint32_t m_lastDropped		 { 0u };
+		bool		  m_bLastParallel	 { false };
+		float		  m_lastMicro		 { 0.0f };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_LIGHT_CLUSTER_GRID_H
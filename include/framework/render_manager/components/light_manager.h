@@ -0,0 +1,214 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_LIGHT_MANAGER_H
+#define DIRECTX12_LIGHT_MANAGER_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "utility/json_loader.h"
+
+enum class ELightType : std::uint8_t
+{
+	Directional,
+	Point,
+	Spotlight
+};
+
+inline std::string ToString(const ELightType type)
+{
+	switch (type)
+	{
+		case ELightType::Directional: return "Directional";
+		case ELightType::Point:       return "Point";
+		case ELightType::Spotlight:   return "Spotlight";
+	}
+	return "Unknown";
+}
+
+//~ how the pixel shader finds the point and spot lights
+enum class ELightingPath : std::uint32_t
+{
+	Global,	   // the pass's capped light slots
+	Clustered, // the view cluster lists, see framework::LightClusterGrid
+	PerObject  // the object's own short list, see framework::ObjectLightLists
+};
+
+inline std::string ToString(const ELightingPath path)
+{
+	switch (path)
+	{
+		case ELightingPath::Global:    return "Global";
+		case ELightingPath::Clustered: return "Clustered";
+		case ELightingPath::PerObject: return "Per Object";
+	}
+	return "Unknown";
+}
+
+struct LightCPU
+{
+	DirectX::XMFLOAT3 Strength;
+	float FalloffStart = 0.0f;  // point/spot
+	DirectX::XMFLOAT3 Direction;
+	float FalloffEnd   = 0.0f;  // dir/spot + range
+	DirectX::XMFLOAT3 Position;
+	float SpotPower    = 0.0f;  // point/spot
+};
+
+struct PassConstantsCPU;
+
+//~ Every light in one pool of parallel arrays tagged with its type. Any change bumps a version
+//~ counter, FillPassConstants leaves the pass alone when nothing moved since the last fill and
+//~ otherwise rewrites only the slots whose light changed. Past the slot cap the lights that look
+//~ brightest from the eye win.
+struct LightManager
+{
+	static constexpr std::uint32_t MaxLights	= 16;
+	static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+	// Creation, every add returns the light index
+	std::uint32_t AddDirectional(const DirectX::XMFLOAT3& direction,
+								 const DirectX::XMFLOAT3& strength);
+
+	std::uint32_t AddPoint(const DirectX::XMFLOAT3& position,
+						   const DirectX::XMFLOAT3& strength,
+						   float falloffStart,
+						   float falloffEnd);
+
+	std::uint32_t AddSpot(const DirectX::XMFLOAT3& position,
+						  const DirectX::XMFLOAT3& direction,
+						  const DirectX::XMFLOAT3& strength,
+						  float falloffStart,
+						  float falloffEnd,
+						  float spotPower);
+
+	// Management, removal moves the last light into the freed index
+	void Remove(std::uint32_t index);
+	void Clear();
+	std::uint32_t TotalLightCount() const;
+
+	ELightType	  GetType(std::uint32_t index) const { return m_types[index]; }
+	LightCPU	  Get	 (std::uint32_t index) const;
+	void		  Set	 (std::uint32_t index, const LightCPU& light);
+	std::uint64_t GetVersion() const noexcept { return m_version; }
+
+	//~ every point light followed by every spot light, returns how many are points
+	std::uint32_t GatherLocal(std::vector<LightCPU>& out) const;
+
+	// GPU packing, out is expected to keep what the previous call wrote
+	void FillPassConstants(PassConstantsCPU& out);
+
+	void ImguiView();
+
+	JsonLoader GetJsonData() const;
+	void LoadJsonData(const JsonLoader& data);
+
+private:
+	std::uint32_t Push(ELightType type, const LightCPU& light);
+	void		  Touch(std::uint32_t index);
+
+	//~ rough brightness near the eye, directionals always rank above local lights
+	float Importance(std::uint32_t index, const DirectX::XMFLOAT3& eye) const;
+
+private:
+	std::vector<ELightType>		   m_types;
+	std::vector<DirectX::XMFLOAT3> m_strengths;
+	std::vector<DirectX::XMFLOAT3> m_directions;
+	std::vector<DirectX::XMFLOAT3> m_positions;
+	std::vector<float>			   m_falloffStarts;
+	std::vector<float>			   m_falloffEnds;
+	std::vector<float>			   m_spotPowers;
+	std::vector<std::uint64_t>	   m_versions; // version of the last change per light
+
+	std::uint64_t m_version{ 1u };
+
+	//~ what the pass holds right now
+	const PassConstantsCPU* m_filledTarget{ nullptr };
+	std::uint64_t			m_filledVersion{ 0u };
+	DirectX::XMFLOAT3		m_filledEye{ 0.f, 0.f, 0.f };
+	std::uint32_t			m_slotIds	  [MaxLights]{};
+	std::uint64_t			m_slotVersions[MaxLights]{};
+
+	//~ ranking scratch
+	std::vector<std::uint32_t> m_ranked;
+	std::vector<float>		   m_scores;
+
+	//~ stats
+	std::uint32_t m_lastPatched{ 0u };
+	std::uint32_t m_skippedFills{ 0u };
+};
+
+struct PassConstantsCPU
+{
+	DirectX::XMFLOAT4X4 View;
+	DirectX::XMFLOAT4X4 InvView;
+	DirectX::XMFLOAT4X4 Projection;
+	DirectX::XMFLOAT4X4 InvProjection;
+	DirectX::XMFLOAT4X4 ViewProjection;
+	DirectX::XMFLOAT4X4 InvViewProjection;
+	DirectX::XMFLOAT3	EyePositionW;
+	float padding;
+	DirectX::XMFLOAT2 RenderTargetSize;
+	DirectX::XMFLOAT2 InvRenderTargetSize;
+	float NearZ;
+	float FarZ;
+	float TotalTime;
+	float DeltaTime;
+
+	// lights
+	DirectX::XMFLOAT4 AmbientLight{ 0.10f, 0.10f, 0.10f, 1.0f };
+
+	std::uint32_t NumDirLights   = 1;
+	std::uint32_t NumPointLights = 0;
+	std::uint32_t NumSpotLights  = 0;
+	std::uint32_t cbPassPad2     = 0;
+
+	static constexpr std::uint32_t MaxLights = 16;
+	LightCPU Lights[MaxLights]{};
+
+	// clustered and per object point / spot lights, see framework::LightClusterGrid
+	std::uint32_t ClusterCountX		= 0;
+	std::uint32_t ClusterCountY		= 0;
+	std::uint32_t ClusterCountZ		= 0;
+	std::uint32_t LocalPointLights	= 0; // local light ids below this are points
+	float		  ClusterDepthScale = 0.0f;
+	float		  ClusterDepthBias	= 0.0f;
+	ELightingPath LightingPath		= ELightingPath::Global;
+	std::uint32_t cbPassPad3		= 0;
+};
+
+#endif //DIRECTX12_LIGHT_MANAGER_H
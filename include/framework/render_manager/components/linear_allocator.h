@@ -0,0 +1,91 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/13/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_LINEAR_ALLOCATOR_H
+#define DIRECTX12_LINEAR_ALLOCATOR_H
+
+#include <cstdint>
+#include <deque>
+
+namespace framework
+{
+	//~ Device free bookkeeping of a ring of bytes that is consumed linearly each frame.
+	//~ Everything allocated between two FinishFrame calls retires together with the fence value
+	//~ passed in and comes back once Reclaim sees that value completed, so the gpu side only
+	//~ needs one persistently mapped buffer and the core can be driven by a fake fence.
+	class LinearAllocatorCore
+	{
+	public:
+		static constexpr std::uint64_t InvalidOffset = ~0ull;
+
+		 LinearAllocatorCore() = default;
+		~LinearAllocatorCore() = default;
+
+		void Initialize(std::uint64_t capacity);
+
+		//~ returns InvalidOffset when the live frames leave no room
+		std::uint64_t Allocate(std::uint64_t size, std::uint64_t alignment = 256u);
+
+		void FinishFrame(std::uint64_t fenceValue);
+		void Reclaim	(std::uint64_t completedFenceValue);
+
+		std::uint64_t GetCapacity	  () const { return m_capacity; }
+		std::uint64_t GetUsed		  () const { return m_used; }
+		std::uint64_t GetPeak		  () const { return m_peak; }
+		std::uint64_t GetFrameBytes	  () const { return m_frameBytes; }
+		std::uint32_t GetFramesInFlight() const { return static_cast<std::uint32_t>(m_frames.size()); }
+		//~ times the head went past the end of the ring while older data was still alive
+		std::uint64_t GetWraps		  () const { return m_wraps; }
+
+	private:
+		struct RetiredFrame
+		{
+			std::uint64_t FenceValue;
+			std::uint64_t End;	 // head after the frame, the tail moves here once it completed
+			std::uint64_t Bytes; // including alignment and wrap padding
+		};
+
+		std::uint64_t m_capacity  { 0u };
+		std::uint64_t m_head	  { 0u };
+		std::uint64_t m_tail	  { 0u };
+		std::uint64_t m_used	  { 0u };
+		std::uint64_t m_frameBytes{ 0u };
+		std::uint64_t m_peak	  { 0u };
+		std::uint64_t m_wraps	  { 0u };
+
+		std::deque<RetiredFrame> m_frames;
+	};
+} // namespace framework
+
+#endif //DIRECTX12_LINEAR_ALLOCATOR_H
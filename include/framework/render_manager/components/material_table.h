@@ -0,0 +1,100 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_MATERIAL_TABLE_H
+#define DIRECTX12_MATERIAL_TABLE_H
+
+#include "framework/render_manager/components/render_item.h"
+
+#include <cstdint>
+#include <vector>
+#include <d3d12.h>
+#include <wrl/client.h>
+
+namespace framework
+{
+	//~ Every material constant block packed into one structured buffer, one region per frame in
+	//~ flight. Draws bind the region once as a root srv and pick their entry with a 32 bit root
+	//~ constant. A material is only written again after its Config changed, and then once into
+	//~ each region so every frame in flight ends up with the new copy.
+	class MaterialTable
+	{
+	public:
+		using Constants = Material::MaterialConstants;
+
+		static constexpr std::uint32_t InvalidIndex{ 0xFFFFFFFFu };
+		static constexpr std::uint32_t Stride	   { sizeof(Constants) };
+
+		 MaterialTable() = default;
+		~MaterialTable();
+
+		void Initialize(ID3D12Device* device, std::uint32_t frameCount, std::uint32_t capacity);
+
+		//~ the material has to outlive the table, its TableIndex is set to the new entry
+		std::uint32_t Add(Material& material);
+		void		  Clear();
+
+		//~ selects the region of the frame being recorded
+		void BeginFrame(std::uint32_t frameIndex);
+
+		//~ picks up changed materials and writes the stale entries of this frame's region
+		void Flush();
+
+		//~ this frame's region, bound as the structured buffer
+		D3D12_GPU_VIRTUAL_ADDRESS GetAddress() const;
+
+		std::uint32_t GetCount	   () const noexcept { return static_cast<std::uint32_t>(m_sources.size()); }
+		std::uint32_t GetCapacity  () const noexcept { return m_capacity; }
+		std::uint32_t GetUploaded  () const noexcept { return m_uploaded; }
+		bool		  IsInitialized() const noexcept { return m_mapped != nullptr; }
+
+		void ImguiView();
+
+	private:
+		Microsoft::WRL::ComPtr<ID3D12Resource> m_buffer{};
+		BYTE*					  m_mapped { nullptr };
+		D3D12_GPU_VIRTUAL_ADDRESS m_gpuBase{ 0u };
+
+		std::vector<const Constants*> m_sources{};
+		std::vector<Constants>		  m_shadow {}; // last copy that went out
+		std::vector<std::uint8_t>	  m_pending{}; // regions still holding an older copy
+
+		std::uint32_t m_frameCount{ 0u };
+		std::uint32_t m_capacity  { 0u };
+		std::uint32_t m_frameIndex{ 0u };
+		std::uint32_t m_uploaded  { 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_MATERIAL_TABLE_H
@@ -0,0 +1,111 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/14/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_OBJECT_CONSTANT_TABLE_H
+#define DIRECTX12_OBJECT_CONSTANT_TABLE_H
+
+#include <cstdint>
+#include <cstring>
+#include <d3d12.h>
+#include <wrl/client.h>
+
+namespace framework
+{
+	//~ Persistent per object constants. Every object owns one 256 byte slot in each frame in
+	//~ flight region, so an object whose data did not change keeps the copy it already has.
+	class ObjectConstantTable
+	{
+	public:
+		static constexpr std::uint32_t InvalidSlot{ 0xFFFFFFFFu };
+		static constexpr std::uint32_t SlotSize	  { D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT };
+
+		 ObjectConstantTable() = default;
+		~ObjectConstantTable();
+
+		void Initialize(ID3D12Device* device, std::uint32_t frameCount, std::uint32_t capacity);
+
+		//~ selects the region of the frame being recorded
+		void BeginFrame(std::uint32_t frameIndex);
+
+		//~ this frame's region, throws if slotCount slots do not fit
+		BYTE* GetFrameData(std::uint32_t slotCount);
+
+		template<typename T>
+		void Write(const std::uint32_t slot, const T& data)
+		{
+			static_assert(sizeof(T) <= SlotSize);
+			std::memcpy(GetMapped(slot), &data, sizeof(T));
+		}
+
+		//~ part of a slot, for data that changes apart from the world matrix
+		template<std::uint32_t Offset, typename T>
+		void Write(const std::uint32_t slot, const T& data)
+		{
+			static_assert(Offset + sizeof(T) <= SlotSize, "write runs past the end of the slot");
+			std::memcpy(GetMapped(slot) + Offset, &data, sizeof(T));
+		}
+
+		//~ same for offsets only known at run time, throws when the write would reach the next slot
+		template<typename T>
+		void Write(const std::uint32_t slot, const std::uint32_t offset, const T& data)
+		{
+			static_assert(sizeof(T) <= SlotSize);
+			CheckRange(offset, sizeof(T));
+			std::memcpy(GetMapped(slot) + offset, &data, sizeof(T));
+		}
+
+		D3D12_GPU_VIRTUAL_ADDRESS GetAddress(std::uint32_t slot) const;
+
+		std::uint32_t GetCapacity  () const noexcept { return m_capacity; }
+		bool		  IsInitialized() const noexcept { return m_mapped != nullptr; }
+
+		void ImguiView();
+
+	private:
+		BYTE* GetMapped(std::uint32_t slot) const;
+		void  CheckRange(std::uint32_t offset, std::size_t size) const;
+
+	private:
+		Microsoft::WRL::ComPtr<ID3D12Resource> m_buffer{};
+		BYTE*					  m_mapped { nullptr };
+		D3D12_GPU_VIRTUAL_ADDRESS m_gpuBase{ 0u };
+
+		std::uint32_t m_frameCount{ 0u };
+		std::uint32_t m_capacity  { 0u };
+		std::uint32_t m_slotCount { 0u };
+		std::uint32_t m_frameIndex{ 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_OBJECT_CONSTANT_TABLE_H
@@ -0,0 +1,136 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_OBJECT_LIGHT_LISTS_H
+#define DIRECTX12_OBJECT_LIGHT_LISTS_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct LightCPU;
+
+namespace framework
+{
+	class JobSystem;
+
+	//~ what lands behind the world matrix in an object's constant slot, matches cbPerObject
+	struct ObjectLightList
+	{
+		static constexpr std::uint32_t MaxLights{ 8u };
+
+		std::uint32_t Count{ 0u };
+		std::uint32_t Pad[3]{};
+		std::uint32_t Indices[MaxLights]{};
+	};
+
+	static_assert(sizeof(ObjectLightList) == 48u);
+
+	//~ Picks the few local lights that matter most for every drawn object. Each object's world box
+	//~ is tested against every light's range sphere and, for spots, the cone, four lights per simd
+	//~ pass, then the survivors are scored by roughly how much light reaches the box center and the
+	//~ brightest MaxLights are kept. Light ids are positions in the list given to SetLights, which
+	//~ is expected to hold every point light before the first spot like LightManager::GatherLocal.
+	//~ Objects are split over the job pool once there are enough of them. No device involved.
+	class ObjectLightLists
+	{
+	public:
+		static constexpr std::uint32_t ParallelThreshold{ 256u }; // objects before the job pool is used
+		static constexpr std::uint32_t ParallelGrain	{ 64u };
+
+		 ObjectLightLists() = default;
+		~ObjectLightLists() = default;
+
+		void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+		//~ world space point lights followed by spot lights
+		void SetLights(std::span<const LightCPU> lights, std::uint32_t pointCount);
+
+		void ClearObjects();
+
+		//~ world box, returns the object index Build writes the list for
+		std::uint32_t AddObject(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents);
+
+		//~ rebuilds every object's list, returns the total number of picked lights
+		std::uint32_t Build();
+
+		const ObjectLightList& Get(std::uint32_t index) const { return m_lists[index]; }
+
+		std::uint32_t GetObjectCount() const noexcept { return static_cast<std::uint32_t>(m_lists.size()); }
+		std::uint32_t GetLightCount () const noexcept { return static_cast<std::uint32_t>(m_lightIds.size()); }
+
+		void ImguiView();
+
+	private:
+		struct Scratch
+		{
+			std::vector<std::uint32_t> Hits;
+			std::uint32_t Candidates{ 0u };
+		};
+
+		void BuildRange(std::uint32_t begin, std::uint32_t end, Scratch& scratch);
+		void BuildOne  (std::uint32_t index, Scratch& scratch);
+
+		//~ light positions touching the box, simd over four lights at a time
+		void Filter(std::uint32_t index, std::vector<std::uint32_t>& hits) const;
+
+		//~ rough irradiance over the box: luminance, distance falloff to the nearest point, spot factor
+		float Score(std::uint32_t light, std::uint32_t index) const;
+
+	private:
+		JobSystem* m_jobs{ nullptr };
+
+		//~ lights, padded to four with zero radius lanes that never hit
+		std::vector<float> m_x, m_y, m_z, m_radius;
+		std::vector<float> m_dirX, m_dirY, m_dirZ, m_cos, m_sin;
+		std::vector<float> m_luminance, m_falloffStart, m_spotPower;
+		std::vector<std::uint32_t> m_lightIds;
+
+		//~ objects
+		std::vector<DirectX::XMFLOAT3> m_centers;
+		std::vector<DirectX::XMFLOAT3> m_extents;
+		std::vector<ObjectLightList>   m_lists;
+		std::vector<Scratch>		   m_scratch;
+
+		//~ stats
+		std::uint32_t m_lastPicked	  { 0u };
+		std::uint32_t m_lastCandidates{ 0u };
+		std::uint32_t m_lastFull	  { 0u };
+		bool		  m_bLastParallel { false };
+		float		  m_lastMicro	  { 0.0f };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_OBJECT_LIGHT_LISTS_H
@@ -0,0 +1,139 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/11/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_OCEAN_FFT_H
+#define DIRECTX12_OCEAN_FFT_H
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	class JobSystem;
+
+	enum class EOceanSpectrum : std::uint32_t
+	{
+		Phillips,
+		Jonswap,
+	};
+
+	struct OceanFFTConfig
+	{
+		std::uint32_t  Size			  { 64u };	 // N, power of two
+		float		   PatchLength	  { 16.0f }; // world size of one tile
+		float		   WindSpeed	  { 6.0f };
+		float		   WindDirectionX { 0.0f };
+		float		   WindDirectionZ { 1.0f };
+		float		   Amplitude	  { 0.05f }; // rms height of the tile
+		float		   Choppiness	  { 0.6f };
+		float		   JonswapGamma	  { 3.3f };
+		float		   SmallWaveCutoff{ 0.001f }; // fraction of the wind wave length
+		EOceanSpectrum Spectrum		  { EOceanSpectrum::Phillips };
+		std::uint32_t  Seed			  { 1337u };
+	};
+
+	//~ Tileable N x N water heightfield synthesised with an inverse FFT (Tessendorf).
+	//~ The initial spectrum is built once, Update(t) animates it and transforms height and
+	//~ choppy xz displacement back to the spatial domain in O(N^2 log N), independent of
+	//~ how many wave octaves the spectrum holds. Samples wrap so any plane can reuse the tile.
+	class OceanFFT
+	{
+	public:
+		using Complex = std::complex<float>;
+
+		 OceanFFT() = default;
+		~OceanFFT() = default;
+
+		void Initialize(const OceanFFTConfig& config);
+		void Update	   (float totalTime);
+
+		//~ rows and columns of the transform are then spread over the pool
+		void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+		//~ bilinear, wrap-around lookups in world units
+		float SampleHeight		(float x, float z) const;
+		void  SampleDisplacement(float x, float z, float& dx, float& dz) const;
+
+		bool				   IsInitialized() const { return !m_height.empty(); }
+		const OceanFFTConfig&  GetConfig	() const { return m_config; }
+		const std::vector<float>& GetHeights() const { return m_height; }
+		const std::vector<float>& GetDisplacementX() const { return m_dispX; }
+		const std::vector<float>& GetDisplacementZ() const { return m_dispZ; }
+
+		//~ h(k, t) of cell m * N + i before the transform, k = (i - N/2, m - N/2) * 2pi / L
+		Complex GetSpectrum(size_t index, float totalTime) const;
+
+		//~ in place 1d inverse transform of `count` values spaced `stride` apart
+		static void InverseFFT(Complex* data, std::uint32_t count, std::uint32_t stride,
+			const std::vector<std::uint32_t>& bitReverse, const std::vector<Complex>& twiddles,
+			std::vector<Complex>& scratch);
+
+		void ImguiView();
+
+	private:
+		float EvaluateSpectrum(float kx, float kz) const;
+		void  Inverse2D		  (std::vector<Complex>& grid);
+		float Sample		  (const std::vector<float>& field, float x, float z) const;
+
+	private:
+		OceanFFTConfig m_config{};
+		JobSystem*	   m_jobs  { nullptr };
+		std::uint32_t  m_log2N { 0u };
+
+		std::vector<Complex> m_h0;		// h0(k)
+		std::vector<Complex> m_h0Conj;	// conj(h0(-k))
+		std::vector<float>	 m_omega;	// dispersion per k
+		std::vector<float>	 m_kx;		// normalised direction, 0 at k = 0
+		std::vector<float>	 m_kz;
+
+		std::vector<Complex> m_spectrumH;
+		std::vector<Complex> m_spectrumDx;
+		std::vector<Complex> m_spectrumDz;
+
+		std::vector<std::uint32_t> m_bitReverse;
+		std::vector<Complex>	   m_twiddles;
+
+		std::vector<float> m_height;
+		std::vector<float> m_dispX;
+		std::vector<float> m_dispZ;
+
+		//~ stats
+		float m_lastUpdateMicro{ 0.0f };
+		float m_minHeight	   { 0.0f };
+		float m_maxHeight	   { 0.0f };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_OCEAN_FFT_H
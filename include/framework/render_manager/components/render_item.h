@@ -43,6 +43,11 @@
 #include <vector>
 
 #include "decriptor_heap.h"
+#include "deferred_release_queue.h"
+#include "dynamic_mesh_scheduler.h"
+#include "light_manager.h"
+#include "object_constant_table.h"
+#include "transform_store.h"
 #include "utility/json_loader.h"
 #include "utility/mesh_generator.h"
 
@@ -91,20 +96,21 @@ private:
 	mutable DirectX::XMMATRIX m_cached{ DirectX::XMMatrixIdentity() };
 	mutable bool m_dirty{ true };
 
+	framework::TransformStore* m_store{ nullptr };
+	std::uint32_t			   m_storeIndex{ framework::TransformStore::InvalidIndex };
+
 public:
-	void MarkDirty() const noexcept { m_dirty = true; }
+	//~ also pushes the new values into the bound store, if any
+	void MarkDirty() const noexcept;
+
+	//~ the store owns the hot copy and builds the gpu matrix, this one stays for editing
+	void BindStore(framework::TransformStore* store, std::uint32_t index);
+	std::uint32_t GetStoreIndex() const noexcept { return m_storeIndex; }
+
 	DirectX::XMFLOAT4X4 GetTransform() const;
 	void				ImguiView	();
 };
 
-struct ConstantData
-{
-	std::uint32_t Size;
-	std::vector<D3D12_CONSTANT_BUFFER_VIEW_DESC> Views;
-	std::vector<BYTE*> Mapped;
-	std::vector<D3D12_GPU_DESCRIPTOR_HANDLE> GPUHandle;
-};
-
 struct MeshGeometry
 {
 	Microsoft::WRL::ComPtr<ID3D12Resource> GeometryBuffer; // both index and vertex
@@ -121,113 +127,45 @@ struct MeshGeometry
 	UINT StartIndexLocation	{ 0u };
 	UINT BaseVertexLocation	{ 0u };
 
+	//~ split stream: [static stream | dynamic stream | indices]
+	bool		  bSplitStream { false };
+	std::uint32_t DynamicStride{ 0u };
+	std::uint32_t DynamicOffset{ 0u };
+
+	//~ local space box around Data.vertices, filled on init
+	DirectX::XMFLOAT3 BoundsCenter { 0.0f, 0.0f, 0.0f };
+	DirectX::XMFLOAT3 BoundsExtents{ 0.0f, 0.0f, 0.0f };
+
+	void ComputeBounds();
+	//~ grows the box for meshes whose vertices move after init
+	void InflateBounds(const DirectX::XMFLOAT3& margin);
+
 	void InitGeometryBuffer(
 		ID3D12Device* device,
 		ID3D12GraphicsCommandList* cmdList,
 		const MeshData& mesh,
 		bool keepMapping=false);
-};
-
-struct PerObjectConstantsCPU
-{
-	DirectX::XMFLOAT4X4 World;
-};
-
-enum class ELightType : std::uint8_t
-{
-	Directional,
-	Point,
-	Spotlight
-};
 
-inline std::string ToString(const ELightType type)
-{
-	switch (type)
-	{
-		case ELightType::Directional: return "Directional";
-		case ELightType::Point:       return "Point";
-		case ELightType::Spotlight:   return "Spotlight";
-	}
-	return "Unknown";
-}
+	//~ always keeps the uploader mapped, only the dynamic stream is meant to change
+	void InitSplitStreamBuffer(
+		ID3D12Device* device,
+		ID3D12GraphicsCommandList* cmdList,
+		const MeshData& mesh);
 
-struct LightCPU
-{
-	DirectX::XMFLOAT3 Strength;
-	float FalloffStart = 0.0f;  // point/spot
-	DirectX::XMFLOAT3 Direction;
-	float FalloffEnd   = 0.0f;  // dir/spot + range
-	DirectX::XMFLOAT3 Position;
-	float SpotPower    = 0.0f;  // point/spot
+	//~ pushes rows of Data (grid with `columns` vertices per row) to the gpu buffer
+	void UploadRows(
+		ID3D12GraphicsCommandList* cmdList,
+		std::uint32_t columns,
+		const std::vector<framework::DirtyRowRange>& ranges);
 };
 
-struct PassConstantsCPU;
-
-struct LightManager
+struct PerObjectConstantsCPU
 {
-	static constexpr std::uint32_t MaxLights = 16;
-
-	std::vector<LightCPU> DirectionalLights;
-	std::vector<LightCPU> PointLights;
-	std::vector<LightCPU> SpotLights;
-
-	// Creation
-	LightCPU& AddDirectional(const DirectX::XMFLOAT3& direction,
-							 const DirectX::XMFLOAT3& strength);
-
-	LightCPU& AddPoint(const DirectX::XMFLOAT3& position,
-					   const DirectX::XMFLOAT3& strength,
-					   float falloffStart,
-					   float falloffEnd);
-
-	LightCPU& AddSpot(const DirectX::XMFLOAT3& position,
-					  const DirectX::XMFLOAT3& direction,
-					  const DirectX::XMFLOAT3& strength,
-					  float falloffStart,
-					  float falloffEnd,
-					  float spotPower);
-
-	// Management
-	void Clear();
-	std::uint32_t TotalLightCount() const;
-
-	// GPU packing
-	void FillPassConstants(PassConstantsCPU& out) const;
-
-	void ImguiView();
-
-	JsonLoader GetJsonData() const;
-	void LoadJsonData(const JsonLoader& data);
+	DirectX::XMFLOAT4X4 World;
 };
 
-struct PassConstantsCPU
-{
-	DirectX::XMFLOAT4X4 View;
-	DirectX::XMFLOAT4X4 InvView;
-	DirectX::XMFLOAT4X4 Projection;
-	DirectX::XMFLOAT4X4 InvProjection;
-	DirectX::XMFLOAT4X4 ViewProjection;
-	DirectX::XMFLOAT4X4 InvViewProjection;
-	DirectX::XMFLOAT3	EyePositionW;
-	float padding;
-	DirectX::XMFLOAT2 RenderTargetSize;
-	DirectX::XMFLOAT2 InvRenderTargetSize;
-	float NearZ;
-	float FarZ;
-	float TotalTime;
-	float DeltaTime;
-
-	// lights
-	DirectX::XMFLOAT4 AmbientLight{ 0.10f, 0.10f, 0.10f, 1.0f };
-
-	std::uint32_t NumDirLights   = 1;
-	std::uint32_t NumPointLights = 0;
-	std::uint32_t NumSpotLights  = 0;
-	std::uint32_t cbPassPad2     = 0;
-
-	static constexpr std::uint32_t MaxLights = 16;
-	LightCPU Lights[MaxLights]{};
-};
+//~ the transform store writes the transposed world straight into the slot
+static_assert(sizeof(PerObjectConstantsCPU) == sizeof(DirectX::XMFLOAT4X4));
 
 enum class ETextureType: uint16_t
 {
@@ -261,14 +199,21 @@ struct Texture
 	};
 	std::unordered_map<ETextureType, ResourcesPack> Resources;
 
+	//~ base handles and index are taken at Init, heapHandle keeps resolving after a Compact
 	D3D12_GPU_DESCRIPTOR_HANDLE baseGpuHandle{};
 	D3D12_CPU_DESCRIPTOR_HANDLE baseCpuHandle{};
 	std::uint32_t			    heapIndex{};
+	framework::DescriptorHandle heapHandle{};
 
 	void Init(ID3D12Device*				 device,
 			  ID3D12CommandQueue*		 commandQueue,
 			  framework::DescriptorHeap& heap);
 
+	//~ views and resources go back once the frame that last used them completed, Init may run again after
+	void Release(std::uint64_t					 fenceValue,
+				 framework::DescriptorHeap&		 heap,
+				 framework::DeferredReleaseQueue& releases);
+
 	[[nodiscard]] bool IsValid() const noexcept;
 };
 
@@ -279,14 +224,10 @@ struct RenderItem
 	EPrimitiveMode PrimitiveMode{ EPrimitiveMode::TriangleList };
 	MeshGeometry*  Mesh;
 	Transformation Transform;
-	std::uint32_t  FrameIndex{ 0 };
-	std::uint32_t  FrameCount{ 1u };
 
-	//~ Constants
-	Microsoft::WRL::ComPtr<ID3D12Resource>	 ConstantBuffer;
-	std::vector<D3D12_GPU_DESCRIPTOR_HANDLE> BaseCBHandle;
-	ConstantData PerObject	 {};
-	ConstantData PassConstant{};
+	//~ transform store index, doubles as the slot in the scene object constant table
+	std::uint32_t			  ObjectSlot{ framework::ObjectConstantTable::InvalidSlot };
+	D3D12_GPU_VIRTUAL_ADDRESS ObjectConstants{ 0u };
 
 	std::unordered_map<ETextureType, Texture> Textures;
 
@@ -294,11 +235,6 @@ struct RenderItem
 					  ID3D12CommandQueue*		 commandQueue,
 					  framework::DescriptorHeap& heap);
 
-	void InitConstantBuffer(
-		const std::uint32_t frameCount,
-		ID3D12Device* device,
-		framework::DescriptorHeap& heap);
-
 	void ImguiView();
 };
 
@@ -306,8 +242,6 @@ struct Material
 {
 	std::string   Name{ "NoName" };
 	std::uint32_t SrvHeapIndex{ 0u };
-	std::uint32_t FrameIndex{ 0u };
-	std::uint32_t FrameCount{ 1u };
 
 	bool m_UVDirty{ true };
 	DirectX::XMFLOAT2 m_UVTiling{ 1.f, 1.f };
@@ -357,13 +291,8 @@ struct Material
 	void TickUV(float deltaTime);
 	void RebuildUVTransformIfDirty();
 
-	Microsoft::WRL::ComPtr<ID3D12Resource>     PixelConstantBuffer;
-	std::vector<D3D12_GPU_DESCRIPTOR_HANDLE>  BasePCBHandle;
-	ConstantData                               PixelConstantMap{};
-
-	void InitPixelConstantBuffer(std::uint32_t frameCount,
-		ID3D12Device* device,
-		framework::DescriptorHeap& heap);
+	//~ entry in the scene material table, draws pass it as a root constant
+	std::uint32_t TableIndex{ 0xFFFFFFFFu };
 };
 
 static_assert(sizeof(Material::MaterialConstants) % 16 == 0);
@@ -0,0 +1,120 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_RENDER_ITEM_REGISTRY_H
+#define DIRECTX12_RENDER_ITEM_REGISTRY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "render_item.h"
+#include "slot_map.h"
+
+namespace framework
+{
+	using RenderItemHandle = SlotHandle;
+
+	//~ [ primitive mode 8 | reserved 16 | flag bits 8 ]
+	namespace RenderItemFlags
+	{
+		constexpr std::uint32_t Visible		  { 1u << 0u };
+		constexpr std::uint32_t PrimitiveShift{ 24u };
+
+		constexpr std::uint32_t Make(const bool visible, const EPrimitiveMode mode)
+		{
+			return (visible ? Visible : 0u) | static_cast<std::uint32_t>(mode) << PrimitiveShift;
+		}
+
+		constexpr EPrimitiveMode GetPrimitiveMode(const std::uint32_t flags)
+		{
+			return static_cast<EPrimitiveMode>(flags >> PrimitiveShift);
+		}
+	}
+
+	//~ Render items behind stable handles. What every draw reads (mesh id, material id,
+	//~ world index, flags) lives in dense arrays of its own, the fat RenderItem (name,
+	//~ transform, textures) sits in a parallel dense array that only editors and loaders touch.
+	//~ Add and Remove are O(1), removal moves the last item into the hole.
+	class RenderItemRegistry
+	{
+	public:
+		 RenderItemRegistry() = default;
+		~RenderItemRegistry() = default;
+
+		RenderItemHandle Add(RenderItem&& item, std::uint32_t meshId, std::uint32_t materialId);
+		bool			 Remove(RenderItemHandle handle);
+		void			 Clear ();
+
+		bool			 IsAlive  (const RenderItemHandle handle) const noexcept { return m_slots.IsAlive(handle); }
+		std::uint32_t	 GetIndex (const RenderItemHandle handle) const noexcept { return m_slots.GetDense(handle); }
+		RenderItemHandle GetHandle(const std::uint32_t index) const noexcept { return m_slots.GetHandle(index); }
+		std::uint32_t	 GetCount () const noexcept { return m_slots.GetCount(); }
+
+		//~ cold side, nullptr for stale handles
+		RenderItem*		  Get(RenderItemHandle handle);
+		const RenderItem* Get(RenderItemHandle handle) const;
+
+		//~ dense views, hot and cold share the index until the next Remove
+		const std::vector<std::uint32_t>& GetMeshIds	 () const noexcept { return m_meshIds; }
+		const std::vector<std::uint32_t>& GetMaterialIds () const noexcept { return m_materialIds; }
+		const std::vector<std::uint32_t>& GetWorldIndices() const noexcept { return m_worldIndices; }
+		const std::vector<std::uint32_t>& GetFlags		 () const noexcept { return m_flags; }
+		std::vector<RenderItem>&		  GetItems		 () noexcept { return m_items; }
+		const std::vector<RenderItem>&	  GetItems		 () const noexcept { return m_items; }
+
+		//~ dense indices of every item with `materialId`, in dense order. editor and save paths
+		void GatherByMaterial(std::uint32_t materialId, std::vector<std::uint32_t>& out) const;
+
+		void SetWorldIndex(std::uint32_t index, std::uint32_t worldIndex);
+
+		//~ copies Visible and PrimitiveMode of the cold item into its flags, after editing it
+		void Refresh(std::uint32_t index);
+
+		void ImguiView();
+
+	private:
+		SlotMapCore m_slots{};
+
+		//~ hot
+		std::vector<std::uint32_t> m_meshIds{};
+		std::vector<std::uint32_t> m_materialIds{};
+		std::vector<std::uint32_t> m_worldIndices{};
+		std::vector<std::uint32_t> m_flags{};
+
+		//~ cold
+		std::vector<RenderItem> m_items{};
+	};
+} // namespace framework
+
+#endif //DIRECTX12_RENDER_ITEM_REGISTRY_H
@@ -0,0 +1,87 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_SLOT_MAP_H
+#define DIRECTX12_SLOT_MAP_H
+
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	//~ Index into the slot table plus the generation it was issued with. A removed slot bumps
+	//~ its generation, so old handles stop resolving instead of pointing at a newcomer.
+	struct SlotHandle
+	{
+		static constexpr std::uint32_t InvalidIndex{ 0xFFFFFFFFu };
+
+		std::uint32_t Index		{ InvalidIndex };
+		std::uint32_t Generation{ 0u };
+
+		bool IsValid() const noexcept { return Index != InvalidIndex; }
+		bool operator==(const SlotHandle&) const = default;
+	};
+
+	//~ Handle bookkeeping of a slot map. Owners keep their data in dense arrays and mirror the
+	//~ moves reported here: Add appends at GetCount() - 1, Remove swaps the last entry into the hole.
+	//~ Handles stay valid across those moves, dense indices do not.
+	class SlotMapCore
+	{
+	public:
+		 SlotMapCore() = default;
+		~SlotMapCore() = default;
+
+		SlotHandle Add();
+
+		//~ `removed` is the dense index that was freed, `moved` the one that now fills it.
+		//~ both are equal when the last entry went away
+		bool Remove(SlotHandle handle, std::uint32_t& removed, std::uint32_t& moved);
+		void Clear ();
+
+		bool		  IsAlive  (SlotHandle handle) const noexcept;
+		std::uint32_t GetDense (SlotHandle handle) const noexcept; // InvalidIndex when stale
+		SlotHandle	  GetHandle(std::uint32_t dense) const noexcept;
+
+		std::uint32_t GetCount	  () const noexcept { return static_cast<std::uint32_t>(m_denseSlot.size()); }
+		std::uint32_t GetSlotCount() const noexcept { return static_cast<std::uint32_t>(m_slotDense.size()); }
+
+	private:
+		std::vector<std::uint32_t> m_slotDense;		 // live: dense index, free: next free slot
+		std::vector<std::uint32_t> m_slotGeneration;
+		std::vector<std::uint32_t> m_denseSlot;
+		std::uint32_t m_freeHead{ SlotHandle::InvalidIndex };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_SLOT_MAP_H
@@ -0,0 +1,145 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/14/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_TRANSFORM_STORE_H
+#define DIRECTX12_TRANSFORM_STORE_H
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+namespace framework
+{
+	class JobSystem;
+
+	//~ Positions, rotations and scales of every object as separate float arrays. Dirty local
+	//~ matrices are rebuilt four objects per simd lane set and kept already transposed for hlsl.
+	//~ Objects can hang under a parent, worlds are then propagated over an order where every
+	//~ parent precedes its children, one depth level after the other. Finished worlds are copied
+	//~ straight into constant memory while a frame in flight copy is stale.
+	class TransformStore
+	{
+	public:
+		static constexpr std::uint32_t InvalidIndex		{ 0xFFFFFFFFu };
+		static constexpr std::uint32_t ParallelThreshold{ 2048u }; // objects before the job pool is used
+		static constexpr std::uint32_t ParallelGrain	{ 8u };	   // 64 bit dirty words per job
+
+		 TransformStore() = default;
+		~TransformStore() = default;
+
+		//~ frameCount is the number of frame in flight copies every change has to reach
+		void Initialize(std::uint32_t frameCount);
+		void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+		//~ new identity root, returns its index. reuses removed indices first
+		std::uint32_t Add();
+		//~ frees index for the next Add, its children become roots
+		void		  Remove(std::uint32_t index);
+
+		//~ values are local to the parent, world for roots
+		void Set(std::uint32_t index,
+				 const DirectX::XMFLOAT3& position,
+				 const DirectX::XMFLOAT3& rotation,
+				 const DirectX::XMFLOAT3& scale);
+
+		//~ InvalidIndex detaches, returns false for unknown indices or when it would close a loop
+		bool		  SetParent(std::uint32_t index, std::uint32_t parent);
+		std::uint32_t GetParent(std::uint32_t index) const { return m_parent[index]; }
+
+		const DirectX::XMFLOAT4X4& GetWorldTransposed(std::uint32_t index) const { return m_world[index]; }
+
+		//~ rebuilds dirty locals, propagates changed worlds and writes every stale one to
+		//~ dst + index * stride. dst is this frame's region, returns number of matrices written
+		std::uint32_t Flush(void* dst, std::uint32_t stride);
+
+		std::uint32_t GetCount			() const noexcept { return m_count; }
+		std::uint32_t GetLevelCount		() const noexcept { return static_cast<std::uint32_t>(m_levelStart.size()) - 1u; }
+		std::uint32_t GetRebuiltCount	() const noexcept { return m_lastRebuilt; }
+		std::uint32_t GetPropagatedCount() const noexcept { return m_lastPropagated; }
+		std::uint32_t GetWrittenCount	() const noexcept { return m_lastWritten; }
+		std::uint32_t GetSkippedCount	() const noexcept { return m_count - m_lastWritten; }
+
+		void ImguiView();
+
+	private:
+		bool UseJobs(std::uint32_t count) const;
+
+		//~ rebuilds the locals covered by dirty words [beginWord, endWord), flags them changed
+		std::uint32_t RebuildLocals(std::uint32_t beginWord, std::uint32_t endWord);
+		void		  RebuildGroup (std::uint32_t first);
+
+		//~ worlds of m_order[begin, end), every parent in there is already final
+		std::uint32_t Propagate(std::uint32_t begin, std::uint32_t end);
+
+		//~ copies stale worlds of objects covered by words [beginWord, endWord), clears changed flags
+		std::uint32_t WriteWorlds(std::uint32_t beginWord, std::uint32_t endWord,
+								  std::uint8_t* dst, std::uint32_t stride);
+
+		//~ counting sort by depth, parents always land before their children
+		void RebuildOrder();
+
+	private:
+		JobSystem*	  m_jobs	  { nullptr };
+		std::uint32_t m_frameCount{ 1u };
+		std::uint32_t m_count	  { 0u };
+
+		//~ soa, padded to whole dirty words so a group of four never reads past the end
+		std::vector<float> m_positionX, m_positionY, m_positionZ;
+		std::vector<float> m_rotationX, m_rotationY, m_rotationZ; // pitch, yaw, roll
+		std::vector<float> m_scaleX,	m_scaleY,	 m_scaleZ;
+
+		std::vector<std::uint64_t>		  m_dirty;		 // local needs a rebuild
+		std::vector<std::uint8_t>		  m_changed;	 // world changes this flush
+		std::vector<std::uint8_t>		  m_framesDirty; // frame copies still holding an old world
+		std::vector<DirectX::XMFLOAT4X4A> m_local;		 // transposed
+		std::vector<DirectX::XMFLOAT4X4A> m_world;		 // transposed
+
+		//~ hierarchy
+		std::vector<std::uint32_t> m_parent;
+		std::vector<std::uint32_t> m_depth;
+		std::vector<std::uint32_t> m_order;		 // by depth
+		std::vector<std::uint32_t> m_levelStart; // m_order offset of every depth, plus the end
+		bool					   m_bOrderDirty{ true };
+
+		std::vector<std::uint32_t> m_free; // removed indices, handed out again by Add
+
+		//~ stats
+		std::uint32_t m_lastRebuilt	  { 0u };
+		std::uint32_t m_lastPropagated{ 0u };
+		std::uint32_t m_lastWritten	  { 0u };
+		bool		  m_bLastParallel { false };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_TRANSFORM_STORE_H
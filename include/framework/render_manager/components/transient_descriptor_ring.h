@@ -0,0 +1,90 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_TRANSIENT_DESCRIPTOR_RING_H
+#define DIRECTX12_TRANSIENT_DESCRIPTOR_RING_H
+
+#include <cstdint>
+#include <d3d12.h>
+
+#include "linear_allocator.h"
+
+namespace framework
+{
+	class DescriptorHeap;
+
+	//~ One range of a shader visible heap handed out linearly to the frame being recorded.
+	//~ Tables are built by copying from cpu only staging heaps, so resources keep their views in
+	//~ a heap the shaders never see and only what a frame binds takes shader visible space.
+	//~ BeginFrame gives back the frames the gpu finished, EndFrame tags the current one with its
+	//~ fence value, the bookkeeping is the same LinearAllocatorCore the upload allocator runs on.
+	class TransientDescriptorRing
+	{
+	public:
+		 TransientDescriptorRing() = default;
+		~TransientDescriptorRing() = default;
+
+		//~ carves count descriptors out of heap, which has to be shader visible
+		void Initialize(ID3D12Device* device, DescriptorHeap& heap, std::uint32_t count);
+
+		void BeginFrame(std::uint64_t completedFenceValue);
+		void EndFrame  (std::uint64_t fenceValue);
+
+		//~ heap index of count contiguous descriptors, throws when live frames hold the ring
+		std::uint32_t Allocate(std::uint32_t count);
+
+		//~ copies count descriptors starting at source into this frame's part of the ring
+		D3D12_GPU_DESCRIPTOR_HANDLE CopyTable(D3D12_CPU_DESCRIPTOR_HANDLE source, std::uint32_t count);
+
+		bool		  IsInitialized() const noexcept { return m_heap != nullptr; }
+		std::uint32_t GetCapacity  () const noexcept { return m_count; }
+
+		void ImguiView();
+
+	private:
+		ID3D12Device*			   m_device{ nullptr };
+		DescriptorHeap*			   m_heap  { nullptr };
+		D3D12_DESCRIPTOR_HEAP_TYPE m_type  { D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV };
+		std::uint32_t			   m_base  { 0u };
+		std::uint32_t			   m_count { 0u };
+		LinearAllocatorCore		   m_core  {};
+
+		//~ stats
+		std::uint32_t m_frameTables	   { 0u };
+		std::uint32_t m_lastFrameTables{ 0u };
+		std::uint64_t m_lastFrameCount { 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_TRANSIENT_DESCRIPTOR_RING_H
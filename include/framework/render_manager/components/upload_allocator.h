@@ -0,0 +1,95 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/13/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_UPLOAD_ALLOCATOR_H
+#define DIRECTX12_UPLOAD_ALLOCATOR_H
+
+#include <cstdint>
+#include <cstring>
+#include <d3d12.h>
+#include <wrl/client.h>
+
+#include "linear_allocator.h"
+
+namespace framework
+{
+	struct UploadAllocation
+	{
+		BYTE*					  CPU { nullptr };
+		D3D12_GPU_VIRTUAL_ADDRESS GPU { 0u };
+		std::uint32_t			  Size{ 0u };
+	};
+
+	//~ One persistently mapped upload buffer, handed out in 256 byte aligned pieces for the
+	//~ current frame. BeginFrame gives back whatever the gpu finished with, EndFrame tags the
+	//~ frame with the fence value it was submitted with.
+	class UploadAllocator
+	{
+	public:
+		 UploadAllocator() = default;
+		~UploadAllocator();
+
+		void Initialize(ID3D12Device* device, std::uint64_t capacity);
+
+		void BeginFrame(std::uint64_t completedFenceValue);
+		void EndFrame  (std::uint64_t fenceValue);
+
+		UploadAllocation Allocate(std::uint32_t size,
+			std::uint32_t alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+
+		template<typename T>
+		UploadAllocation Push(const T& data)
+		{
+			const UploadAllocation allocation = Allocate(static_cast<std::uint32_t>(sizeof(T)));
+			std::memcpy(allocation.CPU, &data, sizeof(T));
+			return allocation;
+		}
+
+		bool IsInitialized() const { return m_mapped != nullptr; }
+		void ImguiView	  ();
+
+	private:
+		Microsoft::WRL::ComPtr<ID3D12Resource> m_buffer{};
+		BYTE*					  m_mapped { nullptr };
+		D3D12_GPU_VIRTUAL_ADDRESS m_gpuBase{ 0u };
+		LinearAllocatorCore		  m_core   {};
+
+		//~ stats
+		std::uint64_t m_lastFrameBytes{ 0u };
+		std::uint32_t m_frameAllocations{ 0u };
+		std::uint32_t m_lastFrameAllocations{ 0u };
+	};
+} // namespace framework
+
+#endif //DIRECTX12_UPLOAD_ALLOCATOR_H
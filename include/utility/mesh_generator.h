@@ -37,6 +37,9 @@
 #define DIRECTX12_MESH_GENERATOR_H
 
 #include <DirectXMath.h>
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <d3d12.h>
 #include <vector>
@@ -74,6 +77,79 @@ struct MeshVertex
 };
 
 
+//~ Split stream layout for dynamic surfaces, slot 0 is uploaded once and
+//~ slot 1 carries only what changes per tick (height + octahedral normal).
+struct MeshStaticStreamVertex
+{
+	DirectX::XMFLOAT2 PositionXZ;
+	DirectX::XMFLOAT2 UV;
+	DirectX::XMFLOAT3 Tangent;
+
+	static MeshStaticStreamVertex Pack(const MeshVertex& v)
+	{
+		return { { v.Position.x, v.Position.z }, v.UV, v.Tangent };
+	}
+};
+
+struct MeshDynamicStreamVertex
+{
+	DirectX::PackedVector::HALF Height;
+	std::int8_t					OctNormal[2];
+
+	//~ octahedral map around +Y so flat water sits in the middle of the encoding
+	static MeshDynamicStreamVertex Pack(const MeshVertex& v)
+	{
+		const DirectX::XMFLOAT3& n = v.Normal;
+		const float l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+
+		float ex = l1 > 0.0f ? n.x / l1 : 0.0f;
+		float ey = l1 > 0.0f ? n.z / l1 : 0.0f;
+		if (n.y < 0.0f)
+		{
+			const float px = ex;
+			ex = (1.0f - std::abs(ey)) * (px >= 0.0f ? 1.0f : -1.0f);
+			ey = (1.0f - std::abs(px)) * (ey >= 0.0f ? 1.0f : -1.0f);
+		}
+
+		auto snorm8 = [](const float f)
+		{
+			return static_cast<std::int8_t>(std::lround(std::clamp(f, -1.0f, 1.0f) * 127.0f));
+		};
+
+		MeshDynamicStreamVertex out{};
+		out.Height		 = DirectX::PackedVector::XMConvertFloatToHalf(v.Position.y);
+		out.OctNormal[0] = snorm8(ex);
+		out.OctNormal[1] = snorm8(ey);
+		return out;
+	}
+
+	static const std::vector<D3D12_INPUT_ELEMENT_DESC>& GetSplitInputLayout()
+	{
+		static const std::vector<D3D12_INPUT_ELEMENT_DESC> layout =
+		{
+			{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,	  0, 0,
+			  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+
+			{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,	  0, 8,
+			  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+
+			{ "TANGENT",  0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 16,
+			  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+
+			{ "HEIGHT",	  0, DXGI_FORMAT_R16_FLOAT,		  1, 0,
+			  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+
+			{ "NORMAL",	  0, DXGI_FORMAT_R8G8_SNORM,	  1, 2,
+			  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+		};
+
+		return layout;
+	}
+};
+
+static_assert(sizeof(MeshDynamicStreamVertex) == 4);
+static_assert(sizeof(MeshStaticStreamVertex) == 28);
+
 struct MeshData
 {
 	std::vector<MeshVertex> vertices;
@@ -184,6 +260,8 @@ public:
 	static MeshData GenerateGrid	(const GenerateGridConfig&		config);
 	//~ Utilities
 	static void ComputeNormals	(MeshData& mesh, bool flip = false);
+	//~ up facing height field normals for rows [firstRow, firstRow + rowCount) of a grid mesh
+	static void ComputeGridNormals(MeshData& mesh, uint32_t columns, uint32_t firstRow, uint32_t rowCount);
 	static void ComputeTangents	(MeshData& mesh, bool flip = false);
 	static void Transform		(MeshData& mesh, DirectX::CXMMATRIX M);
 	static void Append			(MeshData& dst,  const MeshData& src);
@@ -0,0 +1,68 @@
+// ============================================================
+// Instanced variant of vertex_shader.hlsl, every draw of a
+// batch reads its world matrix from the instance buffer.
+// ============================================================
+
+struct InstanceData
+{
+    float4x4 World;
+};
+
+StructuredBuffer<InstanceData> gInstances : register(t0);
+
+cbuffer cbPass : register(b1)
+{
+float4x4 gView;
+float4x4 gInvView;
+float4x4 gProj;
+float4x4 gInvProj;
+float4x4 gViewProj;
+float4x4 gInvViewProj;
+float3 gEyePosW;
+float cbPerObjectPad1;
+float2 gRenderTargetSize;
+float2 gInvRenderTargetSize;
+float gNearZ;
+float gFarZ;
+float gTotalTime;
+float gDeltaTime;
+};
+
+struct VSInput
+{
+	float3 position	: POSITION;
+	float3 normal	: NORMAL;
+	float3 tangent	: TANGENT;
+	float2 uv		: TEXCOORD;
+	float3 color	: COLOR;
+};
+
+struct VSOutput
+{
+    float4 position     : SV_POSITION;
+    float3 worldPos     : POSITION;
+    float3 normal       : NORMAL;
+    float3 tangent      : TANGENT;
+    float2 uv           : TEXCOORD;
+    float3 color        : COLOR;
+};
+
+VSOutput main(VSInput input, uint instanceID : SV_InstanceID)
+{
+ VSOutput output;
+
+    const float4x4 world = gInstances[instanceID].World;
+
+    float4 posW = mul(float4(input.position, 1.0f), world);
+    output.worldPos = posW.xyz;
+
+    output.position = mul(posW, gViewProj);
+
+    output.normal  = mul(input.normal,  (float3x3)world);
+    output.tangent = mul(input.tangent, (float3x3)world);
+
+    output.uv    = input.uv;
+    output.color = input.color;
+
+    return output;
+}
@@ -8,6 +8,13 @@
 #define MAX_LIGHTS 16
 #endif
 
+#define MAX_OBJECT_LIGHTS 8
+
+// gLightingPath values, see ELightingPath
+#define LIGHTING_PATH_GLOBAL     0
+#define LIGHTING_PATH_CLUSTERED  1
+#define LIGHTING_PATH_PER_OBJECT 2
+
 // ============================================================
 // Per-object / Pass / Material
 // ============================================================
@@ -15,6 +22,11 @@
 cbuffer cbPerObject : register(b0)
 {
     float4x4 gWorld;
+
+    // the object's brightest local lights, ids into gLocalLights
+    uint     gObjectLightCount;
+    uint3    cbPerObjectPad;
+    uint4    gObjectLights[MAX_OBJECT_LIGHTS / 4];
 };
 
 struct Light
@@ -55,8 +67,24 @@ cbuffer cbPass : register(b1)
     uint     cbPassPad2;
 
     Light    gLights[MAX_LIGHTS];
+
+    uint     gClusterCountX;
+    uint     gClusterCountY;
+    uint     gClusterCountZ;
+    uint     gLocalPointLights; // local light ids below this are points
+    float    gClusterDepthScale;
+    float    gClusterDepthBias;
+    uint     gLightingPath;
+    uint     cbPassPad3;
 };
 
+// ============================================================
+// Local lights (point / spot), listed per froxel or per object on the cpu
+// ============================================================
+StructuredBuffer<Light> gLocalLights    : register(t1, space1);
+StructuredBuffer<uint2> gClusterRanges  : register(t2, space1); // offset, count
+StructuredBuffer<uint>  gClusterIndices : register(t3, space1);
+
 struct MaterialConstants
 {
     float4   DiffuseAlbedo;
@@ -77,9 +105,12 @@ struct MaterialConstants
     float3 padding;
 };
 
+// every material of the scene, the draw picks its entry with a root constant
+StructuredBuffer<MaterialConstants> gMaterials : register(t0, space1);
+
 cbuffer cbMaterial : register(b2)
 {
-    MaterialConstants gMat;
+    uint gMaterialIndex;
 };
 
 // ============================================================
@@ -225,4 +256,88 @@ float4 ComputeLighting(Material mat, float3 pos, float3 normal, float3 toEye, fl
     return float4(result, 0.0f);
 }
 
+uint ComputeClusterIndex(float2 pixel, float viewZ)
+{
+    uint x = min((uint)(pixel.x * gInvRenderTargetSize.x * gClusterCountX), gClusterCountX - 1);
+    uint y = min((uint)(pixel.y * gInvRenderTargetSize.y * gClusterCountY), gClusterCountY - 1);
+
+    // slices are exponential in view depth
+    float slice = floor(log(max(viewZ, gNearZ)) * gClusterDepthScale + gClusterDepthBias);
+    uint  z = (uint)clamp(slice, 0.0f, (float)(gClusterCountZ - 1));
+
+    return (z * gClusterCountY + y) * gClusterCountX + x;
+}
+
+// Directionals from the pass, points and spots only from the pixel's cluster
+float4 ComputeClusteredLighting(Material mat, float3 pos, float3 normal, float3 toEye, float3 shadowFactor, float2 pixel)
+{
+    float3 result = 0.0f;
+
+    uint i = 0;
+
+    [loop]
+    for (i = 0; i < gNumDirLights && i < MAX_LIGHTS; ++i)
+    {
+        result += shadowFactor[i] * ComputeDirectionalLight(gLights[i], mat, normal, toEye);
+    }
+
+    float viewZ = mul(float4(pos, 1.0f), gView).z;
+    uint2 range = gClusterRanges[ComputeClusterIndex(pixel, viewZ)];
+
+    [loop]
+    for (i = 0; i < range.y; ++i)
+    {
+        uint  id = gClusterIndices[range.x + i];
+        Light L  = gLocalLights[id];
+
+        if (id < gLocalPointLights)
+            result += ComputePointLight(L, mat, pos, normal, toEye);
+        else
+            result += ComputeSpotLight(L, mat, pos, normal, toEye);
+    }
+
+    return float4(result, 0.0f);
+}
+
+// Directionals from the pass, points and spots only from the object's list
+float4 ComputeObjectLighting(Material mat, float3 pos, float3 normal, float3 toEye, float3 shadowFactor)
+{
+    float3 result = 0.0f;
+
+    uint i = 0;
+
+    [loop]
+    for (i = 0; i < gNumDirLights && i < MAX_LIGHTS; ++i)
+    {
+        result += shadowFactor[i] * ComputeDirectionalLight(gLights[i], mat, normal, toEye);
+    }
+
+    uint count = min(gObjectLightCount, (uint)MAX_OBJECT_LIGHTS);
+
+    [loop]
+    for (i = 0; i < count; ++i)
+    {
+        uint  id = gObjectLights[i >> 2][i & 3];
+        Light L  = gLocalLights[id];
+
+        if (id < gLocalPointLights)
+            result += ComputePointLight(L, mat, pos, normal, toEye);
+        else
+            result += ComputeSpotLight(L, mat, pos, normal, toEye);
+    }
+
+    return float4(result, 0.0f);
+}
+
+float4 ComputeSceneLighting(Material mat, float3 pos, float3 normal, float3 toEye, float3 shadowFactor, float2 pixel)
+{
+    if (gLightingPath == LIGHTING_PATH_CLUSTERED)
+        return ComputeClusteredLighting(mat, pos, normal, toEye, shadowFactor, pixel);
+
+    if (gLightingPath == LIGHTING_PATH_PER_OBJECT)
+        return ComputeObjectLighting(mat, pos, normal, toEye, shadowFactor);
+
+    return ComputeLighting(mat, pos, normal, toEye, shadowFactor);
+}
+
 #endif // FOX_COMMON_HLSL
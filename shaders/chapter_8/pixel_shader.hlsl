@@ -12,26 +12,28 @@ struct PSInput
 
 float4 main(PSInput input) : SV_TARGET
 {
+    MaterialConstants matData = gMaterials[gMaterialIndex];
+
     float3 N = normalize(input.normal);
     float3 toEyeW = normalize(gEyePosW - input.worldPos);
 
     float3 base = saturate(input.color);
 
-    float4 matAlbedo = float4(base, 1.0f) * gMat.DiffuseAlbedo;
+    float4 matAlbedo = float4(base, 1.0f) * matData.DiffuseAlbedo;
 
     float4 ambient = gAmbientLight * matAlbedo;
 
     // Direct
-    float shininess = 1.0f - saturate(gMat.Roughness);
+    float shininess = 1.0f - saturate(matData.Roughness);
 
     Material mat;
     mat.DiffuseAlbedo = matAlbedo;
-    mat.FresnelR0     = gMat.FresnelR0;
+    mat.FresnelR0     = matData.FresnelR0;
     mat.Shininess     = shininess;
 
     float3 shadowFactor = 1.0f;
 
-    float4 directLight = ComputeLighting(mat, input.worldPos, N, toEyeW, shadowFactor);
+    float4 directLight = ComputeSceneLighting(mat, input.worldPos, N, toEyeW, shadowFactor, input.position.xy);
 
     float4 litColor = ambient + directLight;
     litColor.a = matAlbedo.a;
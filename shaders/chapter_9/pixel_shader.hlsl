@@ -25,51 +25,53 @@ float3 UnpackNormal(float4 n)
     return normalize(n.xyz * 2.0f - 1.0f);
 }
 
-float4 SampleTex(Texture2D tex, float2 uv)
+float4 SampleTex(MaterialConstants matData, Texture2D tex, float2 uv)
 {
-    if (gMat.UseLinearWrap  >= 0.5f) return tex.Sample(gStaticSampler_LinearWrap,  uv);
-    if (gMat.UseLinearClamp >= 0.5f) return tex.Sample(gStaticSampler_LinearClamp, uv);
-    if (gMat.UsePointClamp  >= 0.5f) return tex.Sample(gStaticSampler_PointClamp,  uv);
-    if (gMat.UseAnisoWrap   >= 0.5f) return tex.Sample(gStaticSampler_AnisoWrap,   uv);
-    if (gMat.UseEnvMap      >= 0.5f) return tex.Sample(gStaticSampler_EnvMap,      uv);
+    if (matData.UseLinearWrap  >= 0.5f) return tex.Sample(gStaticSampler_LinearWrap,  uv);
+    if (matData.UseLinearClamp >= 0.5f) return tex.Sample(gStaticSampler_LinearClamp, uv);
+    if (matData.UsePointClamp  >= 0.5f) return tex.Sample(gStaticSampler_PointClamp,  uv);
+    if (matData.UseAnisoWrap   >= 0.5f) return tex.Sample(gStaticSampler_AnisoWrap,   uv);
+    if (matData.UseEnvMap      >= 0.5f) return tex.Sample(gStaticSampler_EnvMap,      uv);
     return tex.Sample(gStaticSampler_LinearWrap, uv);
 }
 
-float2 TransformUV(float2 uv)
+float2 TransformUV(MaterialConstants matData, float2 uv)
 {
-    float4 t = mul(gMat.MatTransform, float4(uv, 0.0f, 1.0f));
+    float4 t = mul(matData.MatTransform, float4(uv, 0.0f, 1.0f));
     return t.xy;
 }
 
 float4 main(PSInput input) : SV_TARGET
 {
+    MaterialConstants matData = gMaterials[gMaterialIndex];
+
     float3 N = normalize(input.normal);
     float3 T = normalize(input.tangent);
     float3 B = normalize(cross(N, T));
     float3 toEyeW = normalize(gEyePosW - input.worldPos);
 
-    float2 uv = TransformUV(input.uv);
+    float2 uv = TransformUV(matData, input.uv);
 
     float3 baseRgb = float3(1.0f, 1.0f, 1.0f);
-    if (gMat.IsAlbedoAttached >= 0.5f)
-        baseRgb = SampleTex(gTex0, uv).rgb;
+    if (matData.IsAlbedoAttached >= 0.5f)
+        baseRgb = SampleTex(matData, gTex0, uv).rgb;
 
-    float4 matAlbedo = float4(baseRgb, 1.0f) * gMat.DiffuseAlbedo;
+    float4 matAlbedo = float4(baseRgb, 1.0f) * matData.DiffuseAlbedo;
 
-    if (gMat.IsNormalAttached >= 0.5f)
+    if (matData.IsNormalAttached >= 0.5f)
     {
-        float3 nTS = UnpackNormal(SampleTex(gNormal, uv));
+        float3 nTS = UnpackNormal(SampleTex(matData, gNormal, uv));
         float3x3 TBN = float3x3(T, B, N);
         N = normalize(mul(nTS, TBN));
     }
 
     float ao = 1.0f;
-    float rough = gMat.Roughness;
+    float rough = matData.Roughness;
     float metal = 0.0f;
 
-    if (gMat.IsARMAttached >= 0.5f)
+    if (matData.IsARMAttached >= 0.5f)
     {
-        float3 arm = SampleTex(gARM, uv).rgb;
+        float3 arm = SampleTex(matData, gARM, uv).rgb;
         ao = arm.r;
         rough = arm.g;
         metal = arm.b;
@@ -81,11 +83,11 @@ float4 main(PSInput input) : SV_TARGET
 
     Material mat;
     mat.DiffuseAlbedo = matAlbedo;
-    mat.FresnelR0 = lerp(gMat.FresnelR0, matAlbedo.rgb, saturate(metal));
+    mat.FresnelR0 = lerp(matData.FresnelR0, matAlbedo.rgb, saturate(metal));
     mat.Shininess = shininess;
 
     float3 shadowFactor = 1.0f;
-    float4 directLight = ComputeLighting(mat, input.worldPos, N, toEyeW, shadowFactor);
+    float4 directLight = ComputeSceneLighting(mat, input.worldPos, N, toEyeW, shadowFactor, input.position.xy);
 
     float4 litColor = ambient + directLight;
     litColor.a = matAlbedo.a;
@@ -0,0 +1,121 @@
+#include "../chapter_8/common.hlsl"
+
+// ============================================================
+// Split stream river, colour is rebuilt here from the river
+// parameters instead of being streamed per vertex.
+// ============================================================
+
+cbuffer cbRiver : register(b3)
+{
+    float4 gLeftColor;
+    float4 gRightColor;
+    float4 gDownLeftColor;
+    float4 gDownRightColor;
+    float4 gShallowColor;
+    float4 gDeepColor;
+    float4 gFoamColor;
+
+    float  gHalfWidth;
+    float  gMinZ;
+    float  gMaxZ;
+    float  gMaxHeight;
+
+    float  gFoamStrength;
+    float  gShimmerStrength;
+    float  gEdgeNoiseStrength;
+    float  gFoamHeightThreshold;
+
+    float  gFlowSpeed;
+    float3 cbRiverPad;
+};
+
+struct VSInput
+{
+    // slot 0, uploaded once
+    float2 positionXZ : POSITION;
+    float2 uv         : TEXCOORD;
+    float3 tangent    : TANGENT;
+
+    // slot 1, rewritten every river tick
+    float  height     : HEIGHT;
+    float2 octNormal  : NORMAL;
+};
+
+struct VSOutput
+{
+    float4 position     : SV_POSITION;
+    float3 worldPos     : POSITION;
+    float3 normal       : NORMAL;
+    float3 tangent      : TANGENT;
+    float2 uv           : TEXCOORD;
+    float3 color        : COLOR;
+};
+
+// octahedral map around +Y, matches MeshDynamicStreamVertex::Pack
+float3 DecodeOctahedralY(float2 e)
+{
+    float3 n = float3(e.x, 1.0f - abs(e.x) - abs(e.y), e.y);
+    float t = saturate(-n.y);
+    n.x += (n.x >= 0.0f) ? -t : t;
+    n.z += (n.z >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+float3 RiverColor(float x, float z, float height)
+{
+    float bank = 1.0f;
+    if (gHalfWidth > 0.0001f)
+    {
+        bank = saturate(1.0f - abs(x) / gHalfWidth);
+        bank *= bank;
+    }
+
+    float mask = bank;
+    if (gEdgeNoiseStrength > 0.0f)
+        mask = bank + (1.0f - bank) * gEdgeNoiseStrength;
+
+    float x01 = (gHalfWidth > 0.0001f) ? saturate(x / (gHalfWidth * 2.0f) + 0.5f) : 0.5f;
+    float zDen = gMaxZ - gMinZ;
+    float z01 = (abs(zDen) > 0.0001f) ? saturate((z - gMinZ) / zDen) : 0.5f;
+
+    float3 top  = lerp(gLeftColor.rgb,     gRightColor.rgb,     x01);
+    float3 bot  = lerp(gDownLeftColor.rgb, gDownRightColor.rgb, x01);
+    float3 quad = lerp(bot, top, z01);
+
+    float h01 = saturate((height / max(gMaxHeight, 0.0001f)) * 0.5f + 0.5f);
+    float3 depthTint = lerp(gDeepColor.rgb, gShallowColor.rgb, h01);
+
+    float crest = saturate((height - gFoamHeightThreshold) / (gMaxHeight - gFoamHeightThreshold + 0.0001f));
+    float foam  = saturate(crest * crest * gFoamStrength);
+    float3 foamed = lerp(depthTint, gFoamColor.rgb, foam);
+
+    float shimmer = gShimmerStrength * sin(z * 0.8f + gTotalTime * gFlowSpeed) * mask;
+
+    return saturate(quad * foamed + shimmer);
+}
+
+VSOutput main(VSInput input)
+{
+    VSOutput output;
+
+    float x = input.positionXZ.x;
+    float z = input.positionXZ.y;
+
+    float bank = (gHalfWidth > 0.0001f) ? saturate(1.0f - abs(x) / gHalfWidth) : 1.0f;
+    bank *= bank;
+
+    float3 posL = float3(x + 0.01f * bank * sin(z * 0.6f + gTotalTime * 1.2f), input.height, z);
+
+    float4 posW = mul(float4(posL, 1.0f), gWorld);
+    output.worldPos = posW.xyz;
+    output.position = mul(posW, gViewProj);
+
+    float3 normalL = DecodeOctahedralY(input.octNormal);
+    output.normal  = mul(normalL,       (float3x3)gWorld);
+    output.tangent = mul(input.tangent, (float3x3)gWorld);
+
+    output.uv    = input.uv;
+    output.color = RiverColor(x, z, input.height);
+
+    return output;
+}
@@ -81,7 +81,11 @@ bool framework::Application::InitApplication()
 		m_scenes.emplace_back(std::move(RegistryScene::CreateScene(name, m_renderManager)));
 	}
 
-	for (const auto& scene: m_scenes) scene->Initialize();
+	for (const auto& scene: m_scenes)
+	{
+		scene->AttachJobSystem(&m_jobSystem);
+		scene->Initialize();
+	}
 
 	if (m_scenes.empty())
 	{
@@ -102,10 +106,18 @@ void framework::Application::BeginPlay()
 
 void framework::Application::Release()
 {
+	//~ scenes wait for the gpu before letting go of what it may still read
+	for (const auto& scene : m_scenes)
+	{
+		scene->Shutdown();
+	}
 }
 
 void framework::Application::Tick(float deltaTime)
 {
+	//~ fire and forget jobs have no Wait to report through, last frame's failure surfaces here
+	m_jobSystem.RethrowDetached();
+
 	if (m_latchedSceneIndex.has_value() && IsSceneIndexValid(*m_latchedSceneIndex))
 	{
 		m_activeSceneIndex = *m_latchedSceneIndex;
@@ -123,8 +135,33 @@ void framework::Application::Tick(float deltaTime)
 
 	auto& scene = m_scenes[m_activeSceneIndex];
 
+	//~ simulate the next frame on a worker while this one is recorded
+	const bool simulate = scene->IsSimulationReady();
+	const bool async	= simulate && m_bPipelineFrames && m_jobSystem.GetWorkerCount() > 0u;
+
+	if (simulate && !async)
+	{
+		scene->Simulate(deltaTime);
+		scene->PublishSimulation();
+	}
+
+	JobCounter simulation;
+	if (async)
+	{
+		//~ a plain Run lands on this thread's own queue, where any Wait inside FrameBegin could pop it
+		IScene* pScene = scene.get();
+		m_jobSystem.RunOnWorker([pScene, deltaTime] { pScene->Simulate(deltaTime); }, &simulation);
+	}
+
 	scene->FrameBegin(deltaTime);
 
+	//~ ui may edit simulation inputs, so the join happens before it
+	if (async)
+	{
+		m_jobSystem.Wait(simulation);
+		scene->PublishSimulation();
+	}
+
 	ImguiView(deltaTime);
 
 	scene->FrameEnd(deltaTime);
@@ -170,6 +207,9 @@ void framework::Application::ImguiView(float deltaTime)
 
 	ImGui::Separator();
 
+	m_jobSystem.ImguiView();
+	ImGui::Checkbox("Pipeline Frames", &m_bPipelineFrames);
+
 	if (!m_scenes.empty() && IsSceneIndexValid(m_activeSceneIndex))
 	{
 		const auto& scene = m_scenes[m_activeSceneIndex];
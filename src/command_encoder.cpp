@@ -0,0 +1,130 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/command_encoder.h"
+#include "framework/jobs/job_system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "imgui.h"
+
+using namespace framework;
+
+std::uint32_t ParallelRecorder::GetChunkCount(const std::uint32_t packetCount) const noexcept
+{
+	if (packetCount == 0u) return 0u;
+
+	const std::uint32_t wanted = (packetCount + m_minPackets - 1u) / m_minPackets;
+	return std::clamp(wanted, 1u, m_maxChunks);
+}
+
+void ParallelRecorder::GetChunkRange(
+	const std::uint32_t packetCount,
+	const std::uint32_t chunk,
+	std::uint32_t& begin,
+	std::uint32_t& end) const noexcept
+{
+	//~ even split, the first `remainder` chunks take one extra packet
+	const std::uint32_t chunks	  = GetChunkCount(packetCount);
+	const std::uint32_t base	  = chunks ? packetCount / chunks : 0u;
+	const std::uint32_t remainder = chunks ? packetCount % chunks : 0u;
+
+	begin = chunk * base + std::min(chunk, remainder);
+	end	  = begin + base + (chunk < remainder ? 1u : 0u);
+}
+
+std::uint32_t ParallelRecorder::Record(const std::span<const DrawPacket> packets, const AcquireEncoder& acquire)
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	const auto count  = static_cast<std::uint32_t>(packets.size());
+	const auto chunks = std::max(GetChunkCount(count), 1u);
+
+	//~ encoders are picked up front on the calling thread, workers only record
+	std::vector<ICommandEncoder*> encoders(chunks);
+	for (std::uint32_t chunk = 0; chunk < chunks; ++chunk)
+		encoders[chunk] = &acquire(chunk);
+
+	const auto recordChunk = [&](const std::uint32_t chunk)
+	{
+		std::uint32_t begin, end;
+		GetChunkRange(count, chunk, begin, end);
+
+		ICommandEncoder& encoder = *encoders[chunk];
+		encoder.Begin();
+		encoder.Record(packets.subspan(begin, end - begin));
+		encoder.End();
+	};
+
+	if (m_jobs && m_jobs->IsInitialized() && chunks > 1u)
+	{
+		m_jobs->ParallelFor(chunks, 1u, [&](const std::uint32_t begin, const std::uint32_t end)
+		{
+			for (std::uint32_t chunk = begin; chunk < end; ++chunk) recordChunk(chunk);
+		});
+	}
+	else
+	{
+		for (std::uint32_t chunk = 0; chunk < chunks; ++chunk) recordChunk(chunk);
+	}
+
+	m_lastChunks  = chunks;
+	m_lastPackets = count;
+	m_lastMicro	  = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+	return chunks;
+}
+
+void ParallelRecorder::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Parallel Recording"))
+	{
+		int maxChunks  = static_cast<int>(m_maxChunks);
+		int minPackets = static_cast<int>(m_minPackets);
+		if (ImGui::SliderInt("Max Chunks", &maxChunks, 1, static_cast<int>(ChunkLimit)))
+			SetMaxChunks(static_cast<std::uint32_t>(maxChunks));
+		if (ImGui::InputInt("Min Packets / Chunk", &minPackets))
+			SetMinPacketsPerChunk(static_cast<std::uint32_t>(std::max(minPackets, 1)));
+
+		ImGui::BulletText("Chunks: %u", m_lastChunks);
+		ImGui::BulletText("Packets: %u", m_lastPackets);
+		ImGui::BulletText("Record: %.1f us", m_lastMicro);
+	}
+
+	ImGui::PopID();
+}
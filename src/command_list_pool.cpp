@@ -0,0 +1,162 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/command_list_pool.h"
+
+#include "framework/exception/base_exception.h"
+#include "framework/exception/dx_exception.h"
+
+#include <string>
+
+#include "imgui.h"
+
+using namespace framework;
+
+void CommandListPool::Initialize(ID3D12Device* device, const std::uint32_t frameCount, const std::uint32_t listCount)
+{
+	m_frames.assign(frameCount, {});
+	m_listCount = listCount;
+
+	for (auto& frame : m_frames)
+	{
+		frame.Allocators.resize(listCount);
+		frame.Lists		.resize(listCount);
+
+		for (std::uint32_t i = 0; i < listCount; ++i)
+		{
+			THROW_DX_IF_FAILS(device->CreateCommandAllocator(
+				D3D12_COMMAND_LIST_TYPE_DIRECT,
+				IID_PPV_ARGS(&frame.Allocators[i])));
+
+			THROW_DX_IF_FAILS(device->CreateCommandList(
+				0u, D3D12_COMMAND_LIST_TYPE_DIRECT,
+				frame.Allocators[i].Get(), nullptr,
+				IID_PPV_ARGS(&frame.Lists[i])));
+
+			//~ created open, kept closed until a frame opens it
+			THROW_DX_IF_FAILS(frame.Lists[i]->Close());
+		}
+	}
+
+	m_encoders.clear();
+	m_encoders.reserve(listCount);
+	for (std::uint32_t i = 0; i < listCount; ++i)
+		m_encoders.emplace_back(this, i);
+}
+
+void CommandListPool::BeginFrame(const std::uint32_t frameIndex)
+{
+	if (frameIndex >= m_frames.size())
+		THROW_MSG("CommandListPool frame index out of range");
+
+	m_frameIndex = frameIndex;
+}
+
+ID3D12GraphicsCommandList* CommandListPool::Open(const std::uint32_t index, ID3D12PipelineState* initialState)
+{
+	if (index >= m_listCount)
+		THROW_MSG("CommandListPool has no list " + std::to_string(index));
+
+	auto& frame = m_frames[m_frameIndex];
+	THROW_DX_IF_FAILS(frame.Allocators[index]->Reset());
+	THROW_DX_IF_FAILS(frame.Lists[index]->Reset(frame.Allocators[index].Get(), initialState));
+	return frame.Lists[index].Get();
+}
+
+void CommandListPool::Close(const std::uint32_t index)
+{
+	THROW_DX_IF_FAILS(m_frames[m_frameIndex].Lists[index]->Close());
+}
+
+void CommandListPool::Swap(const std::uint32_t index, Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>& other)
+{
+	m_frames[m_frameIndex].Lists[index].Swap(other);
+}
+
+void CommandListPool::Execute(ID3D12CommandQueue* queue, ID3D12CommandList* head, const std::uint32_t count)
+{
+	std::vector<ID3D12CommandList*> lists;
+	lists.reserve(count + 1u);
+
+	if (head) lists.push_back(head);
+	for (std::uint32_t i = 0; i < count; ++i)
+		lists.push_back(m_frames[m_frameIndex].Lists[i].Get());
+
+	queue->ExecuteCommandLists(static_cast<UINT>(lists.size()), lists.data());
+	m_lastExecuted = static_cast<std::uint32_t>(lists.size());
+}
+
+void CommandListPool::SetRecorder(BindState bind, RecordDraws record)
+{
+	m_bind	 = std::move(bind);
+	m_record = std::move(record);
+}
+
+ICommandEncoder& CommandListPool::GetEncoder(const std::uint32_t index)
+{
+	if (index >= m_encoders.size())
+		THROW_MSG("CommandListPool has no encoder " + std::to_string(index));
+
+	return m_encoders[index];
+}
+
+void CommandListPool::Encoder::Begin()
+{
+	m_cache.Reset(m_pool->Open(m_index));
+	if (m_pool->m_bind) m_pool->m_bind(m_cache);
+}
+
+void CommandListPool::Encoder::Record(const std::span<const DrawPacket> packets)
+{
+	if (m_pool->m_record) m_pool->m_record(m_cache, packets);
+}
+
+void CommandListPool::Encoder::End()
+{
+	m_pool->Close(m_index);
+}
+
+void CommandListPool::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Command List Pool"))
+	{
+		ImGui::BulletText("Frames: %u", static_cast<std::uint32_t>(m_frames.size()));
+		ImGui::BulletText("Lists / Frame: %u", m_listCount);
+		ImGui::BulletText("Last Submit: %u lists", m_lastExecuted);
+	}
+
+	ImGui::PopID();
+}
@@ -34,6 +34,7 @@
 // -----------------------------------------------------------------------------
 #include "application/scene/common_scene_data.h"
 #include <imgui.h>
+#include <cmath>
 
 void RiverUpdateParam::ImguiView()
 {
@@ -100,4 +101,150 @@ void RiverUpdateParam::ImguiView()
 		ImGui::SliderFloat("Foam Strength", &foamStrength, 0.0f, 4.0f);
 		ImGui::SliderFloat("Shimmer Strength", &shimmerStrength, 0.0f, 1.0f);
 	}
-}
\ No newline at end of file
+}
+RiverShadingConstants RiverUpdateParam::GetShadingConstants() const
+{
+	auto To4 = [](const DirectX::XMFLOAT3& c)
+	{
+		return DirectX::XMFLOAT4(c.x, c.y, c.z, 1.0f);
+	};
+
+	RiverShadingConstants out{};
+	out.LeftColor		= To4(leftColor);
+	out.RightColor		= To4(rightColor);
+	out.DownLeftColor	= To4(downLeftColor);
+	out.DownRightColor	= To4(downRightColor);
+	out.ShallowColor	= To4(shallowColor);
+	out.DeepColor		= To4(deepColor);
+	out.FoamColor		= To4(foamColor);
+
+	out.HalfWidth			= halfWidth;
+	out.MinZ				= minZ;
+	out.MaxZ				= maxZ;
+	out.MaxHeight			= maxHeight;
+	out.FoamStrength		= foamStrength;
+	out.ShimmerStrength		= shimmerStrength;
+	out.EdgeNoiseStrength	= edgeNoiseStrength;
+	out.FoamHeightThreshold = foamHeightThreshold;
+	out.FlowSpeed			= flowSpeed;
+	return out;
+}
+
+static void RiverBankMask(const RiverUpdateParam& p, const float x, float& bank, float& mask)
+{
+	bank = 1.0f;
+	if (p.halfWidth > 0.0001f)
+	{
+		const float ax = std::abs(x);
+		bank = 1.0f - (ax / p.halfWidth);
+		bank = (bank < 0.0f) ? 0.0f : bank;
+		bank *= bank;
+	}
+
+	mask = bank;
+	if (p.edgeNoiseStrength > 0.0f)
+	{
+		const float edge = 1.0f - bank;
+		mask = bank + edge * p.edgeNoiseStrength;
+	}
+}
+
+float EvaluateRiverHeight(const RiverUpdateParam& p, const float x, const float z, const float t,
+	const framework::OceanFFT* ocean)
+{
+	float bank, mask;
+	RiverBankMask(p, x, bank, mask);
+
+	if (ocean && ocean->IsInitialized())
+	{
+		//~ one wrapped lookup replaces the whole sine stack
+		const float height = ocean->SampleHeight(x, z) * mask * p.heightScale + p.heightBias;
+		return std::clamp(height, -p.maxHeight, p.maxHeight);
+	}
+
+	float height = 0.0f;
+
+	{
+		const float w1 = std::sinf((z * p.waveLen1) + (t * p.freq1) + (x * 0.15f));
+		const float w2 = std::sinf((z * p.waveLen2) - (t * p.freq2) + (x * 0.40f));
+		const float flow = std::sinf((z * 0.55f) + (t * p.flowSpeed));
+		height += (p.amp1 * w1 + p.amp2 * w2) * bank + (0.015f * flow * bank);
+	}
+
+	{
+		float a  = p.octaveBaseAmp;
+		float f  = p.octaveBaseFreq;
+		float wl = p.octaveBaseWaveLen;
+
+		for (int o = 0; o < p.octaves; ++o)
+		{
+			const float phase = float(o) * 13.37f;
+			const float r1 = std::sinf((z * wl * f) + (t * f) + (x * 0.31f) + phase);
+			const float r2 = std::sinf((x * wl * 0.75f * f) - (t * 1.35f * f) + (z * 0.17f) + phase * 0.7f);
+			height += (r1 * 0.65f + r2 * 0.35f) * a * mask;
+
+			a *= 0.55f;
+			f *= 1.85f;
+			wl *= 1.15f;
+		}
+	}
+
+	height = (height * p.heightScale) + p.heightBias;
+	return std::clamp(height, -p.maxHeight, p.maxHeight);
+}
+
+void EvaluateRiverVertex(const RiverUpdateParam& p, const MeshVertex& base, MeshVertex& out, const float t,
+	const framework::OceanFFT* ocean)
+{
+	out = base;
+
+	const float x = base.Position.x;
+	const float z = base.Position.z;
+
+	float bank, mask;
+	RiverBankMask(p, x, bank, mask);
+
+	const float height = EvaluateRiverHeight(p, x, z, t, ocean);
+
+	out.Position.y = base.Position.y + height;
+	out.Position.x = base.Position.x + (0.01f * bank * std::sinf((z * 0.6f) + t * 1.2f));
+
+	if (ocean && ocean->IsInitialized())
+	{
+		//~ choppy crests, fades out towards the banks like the height
+		float dx, dz;
+		ocean->SampleDisplacement(x, z, dx, dz);
+		out.Position.x += dx * bank;
+		out.Position.z += dz * bank;
+	}
+
+	const float x01 = (p.halfWidth > 0.0001f)
+		? std::clamp((x / (p.halfWidth * 2.0f)) + 0.5f, 0.0f, 1.0f)
+		: 0.5f;
+
+	const float zDen = (p.maxZ - p.minZ);
+	const float z01 = (std::abs(zDen) > 0.0001f)
+		? std::clamp((z - p.minZ) / zDen, 0.0f, 1.0f)
+		: 0.5f;
+
+	const auto top  = Lerp(p.leftColor,     p.rightColor,     x01);
+	const auto bot  = Lerp(p.downLeftColor, p.downRightColor, x01);
+	const auto quad = Lerp(bot, top, z01);
+
+	const float denom = (p.maxHeight > 0.0001f) ? p.maxHeight : 0.0001f;
+	float h01 = height / denom;
+	h01 = std::clamp(h01 * 0.5f + 0.5f, 0.0f, 1.0f);
+
+	const auto depthTint = Lerp(p.deepColor, p.shallowColor, h01);
+
+	float crest = (height - p.foamHeightThreshold) / (p.maxHeight - p.foamHeightThreshold + 0.0001f);
+	crest = std::clamp(crest, 0.0f, 1.0f);
+	float foam = std::clamp((crest * crest) * p.foamStrength, 0.0f, 1.0f);
+
+	const auto foamed = Lerp(depthTint, p.foamColor, foam);
+
+	const float shimmer = p.shimmerStrength * std::sinf((z * 0.8f) + t * p.flowSpeed) * mask;
+	const DirectX::XMFLOAT3 shimmer3{ shimmer, shimmer, shimmer };
+
+	out.Color = Clamp01(Add3(Mul3(quad, foamed), shimmer3));
+}
@@ -0,0 +1,214 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/concurrent_descriptor_allocator.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace framework;
+
+namespace
+{
+	//~ one bit per cache slot, a thread holds its slot until it exits so ids stay dense.
+	//~ a block left in a dead thread's cache simply carries on with the next thread given the slot
+	std::atomic<std::uint64_t> g_threadSlots{ 0u };
+
+	struct ThreadSlot
+	{
+		std::uint32_t Id{ ConcurrentDescriptorAllocator::MaxThreads };
+
+		ThreadSlot()
+		{
+			std::uint64_t used = g_threadSlots.load(std::memory_order_relaxed);
+			while (~used != 0u)
+			{
+				const auto bit = static_cast<std::uint32_t>(std::countr_one(used));
+				if (g_threadSlots.compare_exchange_weak(used, used | (1ull << bit),
+														std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					Id = bit;
+					return;
+				}
+			}
+		}
+
+		~ThreadSlot()
+		{
+			if (Id < ConcurrentDescriptorAllocator::MaxThreads)
+				g_threadSlots.fetch_and(~(1ull << Id), std::memory_order_release);
+		}
+	};
+
+	thread_local const ThreadSlot t_threadSlot{};
+
+	constexpr std::uint64_t Pack(const std::uint64_t tag, const std::uint32_t index) noexcept
+	{
+		return (tag << 32u) | index;
+	}
+
+	constexpr std::uint32_t IndexOf(const std::uint64_t head) noexcept
+	{
+		return static_cast<std::uint32_t>(head & 0xFFFFFFFFull);
+	}
+} // namespace
+
+void ConcurrentDescriptorAllocator::Initialize(
+	const std::uint32_t base,
+	const std::uint32_t count,
+	const std::uint32_t blockSize)
+{
+	m_base		 = base;
+	m_blockSize	 = std::max(blockSize, 1u);
+	m_blockCount = count / m_blockSize; // a tail shorter than a block is left out
+
+	m_next	= std::make_unique<std::atomic<std::uint32_t>[]>(m_blockCount);
+	m_state = std::make_unique<std::atomic<std::uint32_t>[]>(m_blockCount);
+
+	//~ chain every block in order, block 0 on top
+	for (std::uint32_t block = 0; block < m_blockCount; ++block)
+	{
+		m_next [block].store(block + 1u < m_blockCount ? block + 1u : InvalidIndex, std::memory_order_relaxed);
+		m_state[block].store(0u, std::memory_order_relaxed);
+	}
+
+	m_head.store(Pack(0u, m_blockCount ? 0u : InvalidIndex), std::memory_order_release);
+	m_caches.fill({});
+	m_freeBlocks.store(m_blockCount, std::memory_order_relaxed);
+	m_allocated .store(0u, std::memory_order_relaxed);
+}
+
+std::uint32_t ConcurrentDescriptorAllocator::Allocate(const std::uint32_t count)
+{
+	if (count == 0u || count > m_blockSize) return InvalidIndex;
+
+	const std::uint32_t slot = t_threadSlot.Id;
+
+	if (slot >= MaxThreads)
+	{
+		//~ no cache to keep a block in, take one and let go of it straight away
+		const std::uint32_t block = PopBlock();
+		if (block == InvalidIndex) return InvalidIndex;
+
+		m_state[block].store(count, std::memory_order_relaxed);
+		m_allocated.fetch_add(count, std::memory_order_relaxed);
+		return m_base + block * m_blockSize;
+	}
+
+	ThreadCache& cache = m_caches[slot];
+
+	if (cache.Block != InvalidIndex && cache.Next + count > m_blockSize)
+	{
+		Release(cache.Block, OwnedBit);
+		cache.Block = InvalidIndex;
+	}
+
+	if (cache.Block == InvalidIndex)
+	{
+		const std::uint32_t block = PopBlock();
+		if (block == InvalidIndex) return InvalidIndex;
+
+		//~ nobody else can see a popped block until its slots go out
+		m_state[block].store(OwnedBit, std::memory_order_relaxed);
+		cache.Block = block;
+		cache.Next	= 0u;
+	}
+
+	m_state[cache.Block].fetch_add(count, std::memory_order_relaxed);
+	m_allocated.fetch_add(count, std::memory_order_relaxed);
+
+	const std::uint32_t index = m_base + cache.Block * m_blockSize + cache.Next;
+	cache.Next += count;
+	return index;
+}
+
+void ConcurrentDescriptorAllocator::Free(const std::uint32_t index, const std::uint32_t count)
+{
+	if (count == 0u || !Owns(index)) return;
+
+	m_allocated.fetch_sub(count, std::memory_order_relaxed);
+	Release((index - m_base) / m_blockSize, count);
+}
+
+void ConcurrentDescriptorAllocator::ReleaseThreadCache()
+{
+	const std::uint32_t slot = t_threadSlot.Id;
+	if (slot >= MaxThreads) return;
+
+	ThreadCache& cache = m_caches[slot];
+	if (cache.Block == InvalidIndex) return;
+
+	Release(cache.Block, OwnedBit);
+	cache = {};
+}
+
+std::uint32_t ConcurrentDescriptorAllocator::PopBlock()
+{
+	std::uint64_t head = m_head.load(std::memory_order_acquire);
+
+	while (true)
+	{
+		const std::uint32_t block = IndexOf(head);
+		if (block == InvalidIndex) return InvalidIndex;
+
+		//~ may be stale if the block moved meanwhile, the tag makes the exchange fail then
+		const std::uint32_t next = m_next[block].load(std::memory_order_relaxed);
+
+		if (m_head.compare_exchange_weak(head, Pack((head >> 32u) + 1u, next),
+										 std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			m_freeBlocks.fetch_sub(1u, std::memory_order_relaxed);
+			return block;
+		}
+	}
+}
+
+void ConcurrentDescriptorAllocator::PushBlock(const std::uint32_t block)
+{
+	std::uint64_t head = m_head.load(std::memory_order_relaxed);
+
+	do
+	{
+		m_next[block].store(IndexOf(head), std::memory_order_relaxed);
+	}
+	while (!m_head.compare_exchange_weak(head, Pack((head >> 32u) + 1u, block),
+										 std::memory_order_release, std::memory_order_relaxed));
+
+	m_freeBlocks.fetch_add(1u, std::memory_order_relaxed);
+}
+
+void ConcurrentDescriptorAllocator::Release(const std::uint32_t block, const std::uint32_t count)
+{
+	if (m_state[block].fetch_sub(count, std::memory_order_acq_rel) == count) PushBlock(block);
+}
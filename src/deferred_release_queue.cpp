@@ -0,0 +1,112 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/deferred_release_queue.h"
+
+#include <algorithm>
+
+#include "imgui.h"
+
+using namespace framework;
+
+void DeferredReleaseQueue::Defer(const std::uint64_t fenceValue, std::function<void()> release)
+{
+	Push(fenceValue, nullptr, std::move(release), 0u);
+}
+
+void DeferredReleaseQueue::Push(
+	const std::uint64_t fenceValue,
+	std::shared_ptr<void> object,
+	std::function<void()> release,
+	const std::uint32_t descriptors)
+{
+	Entry entry{};
+	entry.FenceValue  = fenceValue;
+	entry.Object	  = std::move(object);
+	entry.Release	  = std::move(release);
+	entry.Descriptors = descriptors;
+	m_pending.push_back(std::move(entry));
+
+	m_pendingDescriptors += descriptors;
+	m_peakPending		  = std::max(m_peakPending, GetPendingCount());
+}
+
+void DeferredReleaseQueue::RetireFront()
+{
+	//~ popped first so a release that queues something new sees a consistent queue
+	Entry entry = std::move(m_pending.front());
+	m_pending.pop_front();
+
+	m_pendingDescriptors -= entry.Descriptors;
+	++m_retired;
+
+	if (entry.Release) entry.Release();
+}
+
+std::uint32_t DeferredReleaseQueue::Retire(const std::uint64_t completedFenceValue)
+{
+	m_lastCompleted = completedFenceValue;
+
+	std::uint32_t count = 0u;
+	while (!m_pending.empty() && m_pending.front().FenceValue <= completedFenceValue)
+	{
+		RetireFront();
+		++count;
+	}
+	return count;
+}
+
+void DeferredReleaseQueue::Flush()
+{
+	while (!m_pending.empty()) RetireFront();
+}
+
+void DeferredReleaseQueue::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Deferred Releases"))
+	{
+		ImGui::BulletText("Pending: %u (%u descriptors), Peak: %u", GetPendingCount(), m_pendingDescriptors, m_peakPending);
+		ImGui::BulletText("Retired: %llu", static_cast<unsigned long long>(m_retired));
+		ImGui::BulletText("Completed Fence: %llu", static_cast<unsigned long long>(m_lastCompleted));
+
+		if (!m_pending.empty())
+		{
+			ImGui::BulletText("Oldest Waits For: %llu", static_cast<unsigned long long>(m_pending.front().FenceValue));
+		}
+	}
+
+	ImGui::PopID();
+}
@@ -38,6 +38,9 @@
 
 #include "imgui.h"
 
+#include <algorithm>
+#include <cfloat>
+
 using namespace framework;
 
 void DescriptorHeap::Initialize(const InitDescriptorHeap &desc)
@@ -46,8 +49,7 @@ void DescriptorHeap::Initialize(const InitDescriptorHeap &desc)
 
     m_bInitialized = false;
 
-    m_allocatedMap.clear();
-    m_allocatedMap.resize(desc.AllocationSize, false);
+    m_ranges.Reset(desc.AllocationSize);
 
     m_allocationMaxSize = desc.AllocationSize;
     m_allocationCount   = 0u;
@@ -64,6 +66,8 @@ void DescriptorHeap::Initialize(const InitDescriptorHeap &desc)
     );
 
     m_heapIncrement        = desc.pDevice->GetDescriptorHandleIncrementSize(desc.Type);
+    m_type                 = desc.Type;
+    m_bShaderVisible       = (desc.Flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE) != 0;
     m_szDescriptorHeapName = desc.szDebugName;
 
     const auto w_name = std::wstring(desc.szDebugName.begin(), desc.szDebugName.end());
@@ -76,50 +80,45 @@ void DescriptorHeap::Initialize(const InitDescriptorHeap &desc)
 }
 
 std::uint32_t DescriptorHeap::Allocate(const std::uint32_t &allocCounts)
+{
+    return Allocate(allocCounts, true);
+}
+
+std::uint32_t DescriptorHeap::Allocate(const std::uint32_t allocCounts, const bool bConcurrent)
 {
     if (!IsValid()) THROW_MSG("DescriptorHeap not initialized");
     if (allocCounts == 0u) THROW_MSG("Allocate called with 0 descriptors");
 
-    if (m_allocationCount + allocCounts > m_allocationMaxSize)
+    if (m_allocationCount.load(std::memory_order_relaxed) + allocCounts > m_allocationMaxSize)
     {
         THROW_MSG("Allocation count exceeded");
     }
 
-    int left  = -1;
-    int right = -1;
-
-    const int maxSize = static_cast<int>(m_allocationMaxSize);
-    const int need    = static_cast<int>(allocCounts);
-
-    for (int i = 0; i < maxSize; ++i)
+    if (bConcurrent && m_concurrent.IsInitialized() && allocCounts <= m_concurrent.GetBlockSize())
     {
-        if (!m_allocatedMap[static_cast<size_t>(i)])
+        if (const std::uint32_t index = m_concurrent.Allocate(allocCounts);
+            index != ConcurrentDescriptorAllocator::InvalidIndex)
         {
-            if (left == -1) left = i;
-            right = i;
-
-            if ((right - left + 1) == need)
-                break; // found a contiguous range
-        }
-        else
-        {
-            left  = -1;
-            right = -1;
+            m_allocationCount.fetch_add(allocCounts, std::memory_order_relaxed);
+            m_allocateCalls.fetch_add(1u, std::memory_order_relaxed);
+            return index;
         }
     }
 
-    if (left == -1 || right == -1 || (right - left + 1) < need)
+    std::uint32_t index;
     {
-        THROW_MSG("Not enough contiguous space in the heap");
+        std::lock_guard lock{ m_rangeLock };
+        index = m_ranges.Allocate(allocCounts);
     }
 
-    for (int i = left; i <= right; ++i)
+    if (index == DescriptorRangeAllocator::InvalidIndex)
     {
-        m_allocatedMap[static_cast<size_t>(i)] = true;
+        THROW_MSG("Not enough contiguous space in the heap");
     }
 
-    m_allocationCount += allocCounts;
-    return static_cast<std::uint32_t>(left);
+    m_allocationCount.fetch_add(allocCounts, std::memory_order_relaxed);
+    m_allocateCalls.fetch_add(1u, std::memory_order_relaxed);
+    return index;
 }
 
 void DescriptorHeap::Deallocate(const std::uint32_t index, const std::uint32_t count)
@@ -130,20 +129,127 @@ void DescriptorHeap::Deallocate(const std::uint32_t index, const std::uint32_t c
     if (index >= m_allocationMaxSize) return;
     if (index + count > m_allocationMaxSize) return;
 
-    std::uint32_t freed = 0u;
+    std::uint32_t freed = count;
+
+    if (m_concurrent.Owns(index)) m_concurrent.Free(index, count);
+    else
+    {
+        //~ slots in the range that were not allocated are skipped
+        std::lock_guard lock{ m_rangeLock };
+        freed = m_ranges.Free(index, count);
+    }
+
+    std::uint32_t current = m_allocationCount.load(std::memory_order_relaxed);
+    while (!m_allocationCount.compare_exchange_weak(current, current > freed ? current - freed : 0u,
+                                                    std::memory_order_relaxed))
+    {
+    }
+    m_freeCalls.fetch_add(1u, std::memory_order_relaxed);
+}
+
+void DescriptorHeap::EnableConcurrentAllocation(const std::uint32_t count, const std::uint32_t blockSize)
+{
+    if (!IsValid()) THROW_MSG("DescriptorHeap not initialized");
+    if (m_concurrent.IsInitialized()) THROW_MSG("Concurrent allocation already enabled");
+    if (count < blockSize || blockSize == 0u) THROW_MSG("Concurrent range smaller than one block");
+
+    //~ whole blocks only, the carved range never goes back to the range allocator
+    const std::uint32_t carved = count - count % blockSize;
+    std::lock_guard lock{ m_rangeLock };
 
-    for (std::uint32_t i = index; i < index + count; ++i)
+    m_concurrentBase = m_ranges.Allocate(carved);
+    if (m_concurrentBase == DescriptorRangeAllocator::InvalidIndex)
     {
-        const size_t idx = static_cast<size_t>(i);
-        if (m_allocatedMap[idx])
+        THROW_MSG("Not enough contiguous space for the concurrent range");
+    }
+
+    m_concurrent.Initialize(m_concurrentBase, carved, blockSize);
+}
+
+DescriptorHandle DescriptorHeap::AllocateHandle(const std::uint32_t count)
+{
+    //~ Compact leaves the concurrent range alone, a handle carved from it could never move
+    const std::uint32_t index = Allocate(count, false);
+
+    std::lock_guard lock{ m_rangeLock };
+    const DescriptorHandle handle = m_handles.Add();
+    m_handleRanges.push_back({ index, count });
+    return handle;
+}
+
+void DescriptorHeap::Deallocate(const DescriptorHandle handle)
+{
+    HandleRange range{};
+    {
+        std::lock_guard lock{ m_rangeLock };
+
+        const std::uint32_t dense = m_handles.GetDense(handle);
+        if (dense == SlotHandle::InvalidIndex) return;
+        range = m_handleRanges[dense];
+
+        std::uint32_t removed, moved;
+        m_handles.Remove(handle, removed, moved);
+        m_handleRanges[removed] = m_handleRanges[moved];
+        m_handleRanges.pop_back();
+    }
+
+    Deallocate(range.Index, range.Count);
+}
+
+std::uint32_t DescriptorHeap::GetIndex(const DescriptorHandle handle) const
+{
+    std::lock_guard lock{ m_rangeLock };
+
+    const std::uint32_t dense = m_handles.GetDense(handle);
+    return dense == SlotHandle::InvalidIndex ? DescriptorRangeAllocator::InvalidIndex : m_handleRanges[dense].Index;
+}
+
+std::uint32_t DescriptorHeap::Compact()
+{
+    if (!IsValid()) THROW_MSG("DescriptorHeap not initialized");
+    if (m_bShaderVisible) THROW_MSG("Compact needs a heap the shaders can't see");
+
+    Microsoft::WRL::ComPtr<ID3D12Device> device;
+    THROW_DX_IF_FAILS(m_heap->GetDevice(IID_PPV_ARGS(&device)));
+
+    std::lock_guard lock{ m_rangeLock };
+
+    //~ lowest ranges first, each one only ever moves down into space already behind it.
+    //~ handles never live in the concurrent range, plain allocations stay where they are
+    std::vector<std::uint32_t> order(m_handleRanges.size());
+    for (std::uint32_t dense = 0; dense < order.size(); ++dense) order[dense] = dense;
+
+    std::ranges::sort(order, [this](const std::uint32_t a, const std::uint32_t b)
+    {
+        return m_handleRanges[a].Index < m_handleRanges[b].Index;
+    });
+
+    std::uint32_t moved = 0u;
+    for (const std::uint32_t dense : order)
+    {
+        auto& [index, count] = m_handleRanges[dense];
+
+        //~ freed before the search, so a hole that overlaps the range's own slots counts.
+        //~ the range goes back where it was when nothing lower fits
+        const std::uint32_t target = m_ranges.Relocate(index, count);
+        if (target >= index) continue;
+
+        //~ ascending chunks no longer than the distance, a chunk never overwrites what is still to be read
+        const std::uint32_t distance = index - target;
+        for (std::uint32_t offset = 0u; offset < count; offset += distance)
         {
-            m_allocatedMap[idx] = false;
-            ++freed;
+            device->CopyDescriptorsSimple(
+                std::min(distance, count - offset),
+                GetCPUHandle(target + offset),
+                GetCPUHandle(index + offset),
+                m_type);
         }
+
+        index = target;
+        ++moved;
     }
 
-    if (freed > m_allocationCount) m_allocationCount = 0u;
-    else m_allocationCount -= freed;
+    return moved;
 }
 
 ID3D12DescriptorHeap * DescriptorHeap::GetNative() const
@@ -158,8 +264,15 @@ D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeap::GetCPUHandle(std::uint32_t index) co
     return handle;
 }
 
+D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeap::GetCPUHandle(const DescriptorHandle handle) const
+{
+    return GetCPUHandle(GetIndex(handle));
+}
+
 D3D12_GPU_DESCRIPTOR_HANDLE DescriptorHeap::GetGPUHandle(std::uint32_t index) const
 {
+    if (!m_bShaderVisible) return {};
+
     auto handle = m_heap->GetGPUDescriptorHandleForHeapStart();
     handle.ptr += index * m_heapIncrement;
     return handle;
@@ -170,7 +283,7 @@ bool DescriptorHeap::IsValid() const
     return (m_heap != nullptr) && m_bInitialized;
 }
 
-void DescriptorHeap::ImguiView() const
+void DescriptorHeap::ImguiView()
 {
     ImGui::PushID(this); // unique per heap instance
 
@@ -186,7 +299,55 @@ void DescriptorHeap::ImguiView() const
         ImGui::BulletText("Initialized: %s", m_bInitialized ? "true" : "false");
         ImGui::BulletText("Heap Increment: %u", m_heapIncrement);
         ImGui::BulletText("Max Size: %u", m_allocationMaxSize);
-        ImGui::BulletText("Allocated Count: %u", m_allocationCount);
+        ImGui::BulletText("Allocated Count: %u", m_allocationCount.load(std::memory_order_relaxed));
+
+        if (m_concurrent.IsInitialized())
+        {
+            ImGui::BulletText("Concurrent Range: [%u, %u) in blocks of %u",
+                m_concurrentBase, m_concurrentBase + m_concurrent.GetBlockCount() * m_concurrent.GetBlockSize(),
+                m_concurrent.GetBlockSize());
+            ImGui::BulletText("Concurrent Blocks Free: %u / %u (%u descriptors live)",
+                m_concurrent.GetFreeBlocks(), m_concurrent.GetBlockCount(), m_concurrent.GetAllocated());
+        }
+
+        ImGui::Spacing();
+        ImGui::TextUnformatted("Fragmentation");
+        ImGui::Separator();
+        {
+            std::unique_lock lock{ m_rangeLock };
+            const auto stats            = m_ranges.GetFragmentation();
+            const std::uint32_t handles = m_handles.GetCount();
+            lock.unlock();
+
+            ImGui::BulletText("Free: %u slots in %u runs (largest %u)", stats.FreeSlots, stats.FreeRuns, stats.LargestFreeRun);
+            ImGui::BulletText("Fragmentation: %.1f%%", stats.Fragmentation * 100.0f);
+
+            float buckets[DescriptorRangeAllocator::HistogramBuckets];
+            for (std::uint32_t i = 0; i < DescriptorRangeAllocator::HistogramBuckets; ++i)
+            {
+                buckets[i] = static_cast<float>(stats.Histogram[i]);
+            }
+            ImGui::PlotHistogram("Free Runs", buckets, IM_ARRAYSIZE(buckets), 0,
+                "length 1, 2-3, 4-7 ... 2048+", 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+
+            //~ the view runs once a frame, so the deltas are per frame churn
+            const std::uint64_t allocations = m_allocateCalls.load(std::memory_order_relaxed);
+            const std::uint64_t frees       = m_freeCalls.load(std::memory_order_relaxed);
+            ImGui::BulletText("Churn: %llu allocations, %llu frees (+%llu / -%llu this frame)",
+                static_cast<unsigned long long>(allocations), static_cast<unsigned long long>(frees),
+                static_cast<unsigned long long>(allocations - m_seenAllocateCalls),
+                static_cast<unsigned long long>(frees - m_seenFreeCalls));
+            m_seenAllocateCalls = allocations;
+            m_seenFreeCalls     = frees;
+
+            ImGui::BulletText("Relocatable Ranges: %u", handles);
+            if (!m_bShaderVisible)
+            {
+                if (ImGui::Button("Compact")) m_lastMoved = Compact();
+                ImGui::SameLine();
+                ImGui::Text("last pass moved %u ranges", m_lastMoved);
+            }
+        }
 
         ImGui::Spacing();
         ImGui::TextUnformatted("Descriptor Heap");
@@ -197,37 +358,71 @@ void DescriptorHeap::ImguiView() const
         ImGui::TextUnformatted("Allocation Map");
         ImGui::Separator();
 
-        const std::uint32_t mapSize = static_cast<std::uint32_t>(m_allocatedMap.size());
-        ImGui::Text("Bits: %u", mapSize);
+        const std::uint32_t mapSize = m_ranges.GetCapacity();
 
         ImGui::PushID("AllocatedMap");
 
-        if (!m_allocatedMap.empty())
+        if (mapSize)
         {
-            constexpr int columns = 32;
-
-            if (ImGui::BeginTable("AllocBitsTable", columns, ImGuiTableFlags_SizingFixedFit))
             {
-                for (std::uint32_t i = 0; i < mapSize; ++i)
+                std::lock_guard lock{ m_rangeLock };
+                m_ranges.CollectRuns(m_runs);
+            }
+            ImGui::Text("Descriptors: %u in %u runs", mapSize, static_cast<std::uint32_t>(m_runs.size()));
+
+            //~ at most 64 rows, a run is one rectangle per row it touches
+            constexpr float rowHeight = 10.0f;
+            const std::uint32_t perRow = std::min(mapSize, std::max(256u, (mapSize + 63u) / 64u));
+            const std::uint32_t rows   = (mapSize + perRow - 1u) / perRow;
+            const float width          = std::max(ImGui::GetContentRegionAvail().x, 64.0f);
+            const float scale          = width / static_cast<float>(perRow);
+            const ImVec2 origin        = ImGui::GetCursorScreenPos();
+            ImDrawList* draw           = ImGui::GetWindowDrawList();
+
+            const auto drawRange = [&](std::uint32_t start, const std::uint32_t count, const ImU32 colour)
+            {
+                const std::uint32_t end = start + count;
+                while (start < end)
                 {
-                    ImGui::TableNextColumn();
-                    ImGui::PushID(static_cast<int>(i));
+                    const std::uint32_t row     = start / perRow;
+                    const std::uint32_t rowBase = row * perRow;
+                    const std::uint32_t rowEnd  = std::min(end, rowBase + perRow);
+
+                    const float y = origin.y + static_cast<float>(row) * rowHeight;
+                    draw->AddRectFilled(
+                        ImVec2(origin.x + static_cast<float>(start - rowBase) * scale, y),
+                        ImVec2(origin.x + static_cast<float>(rowEnd - rowBase) * scale, y + rowHeight - 1.0f),
+                        colour);
+                    start = rowEnd;
+                }
+            };
 
-                    bool bit = m_allocatedMap[static_cast<size_t>(i)];
+            constexpr ImU32 freeColour       = IM_COL32(60, 60, 60, 255);
+            constexpr ImU32 usedColour       = IM_COL32(80, 170, 90, 255);
+            constexpr ImU32 concurrentColour = IM_COL32(200, 140, 60, 255);
 
-                    ImGui::BeginDisabled(true);
-                    ImGui::Checkbox("##bit", &bit);
-                    ImGui::EndDisabled();
+            for (const auto& run : m_runs) drawRange(run.Start, run.Count, run.bUsed ? usedColour : freeColour);
 
-                    if (ImGui::IsItemHovered())
-                    {
-                        ImGui::SetTooltip("Index: %u\nAllocated: %s", i, bit ? "true" : "false");
-                    }
+            const std::uint32_t concurrentCount = m_concurrent.GetBlockCount() * m_concurrent.GetBlockSize();
+            if (concurrentCount) drawRange(m_concurrentBase, concurrentCount, concurrentColour);
 
-                    ImGui::PopID();
-                }
+            ImGui::Dummy(ImVec2(width, static_cast<float>(rows) * rowHeight));
+
+            if (ImGui::IsItemHovered())
+            {
+                const ImVec2 mouse     = ImGui::GetMousePos();
+                const auto column      = static_cast<std::uint32_t>(std::max(0.0f, (mouse.x - origin.x) / scale));
+                const auto row         = static_cast<std::uint32_t>(std::max(0.0f, (mouse.y - origin.y) / rowHeight));
+                const std::uint32_t at = row * perRow + std::min(column, perRow - 1u);
 
-                ImGui::EndTable();
+                const auto it = std::ranges::upper_bound(m_runs, at, {}, &DescriptorRangeAllocator::Run::Start);
+                if (at < mapSize && it != m_runs.begin())
+                {
+                    const auto& run = *std::prev(it);
+                    ImGui::SetTooltip("Index: %u\n%s run [%u, %u), %u descriptors%s",
+                        at, run.bUsed ? "Used" : "Free", run.Start, run.Start + run.Count, run.Count,
+                        m_concurrent.Owns(at) ? "\nConcurrent range" : "");
+                }
             }
         }
         else
@@ -244,7 +439,7 @@ void DescriptorHeap::ImguiView() const
 
 std::uint32_t DescriptorHeap::GetAllocatedCounts() const
 {
-	return m_allocationCount;
+	return m_allocationCount.load(std::memory_order_relaxed);
 }
 
 std::uint32_t DescriptorHeap::GetAllocationSize() const
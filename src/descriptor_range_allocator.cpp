@@ -0,0 +1,365 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/descriptor_range_allocator.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace framework;
+
+DescriptorRangeAllocator::Mapping DescriptorRangeAllocator::MapInsert(const std::uint32_t size)
+{
+	//~ small runs get one list per size, bigger ones split each power of two sixteen ways
+	if (size < SecondLevelCount) return { 0u, size };
+
+	const std::uint32_t top = static_cast<std::uint32_t>(std::bit_width(size)) - 1u;
+	return { top - SecondLevelBits + 1u, (size >> (top - SecondLevelBits)) - SecondLevelCount };
+}
+
+DescriptorRangeAllocator::Mapping DescriptorRangeAllocator::MapSearch(const std::uint32_t size)
+{
+	//~ rounded up to the next class so any run found there is long enough
+	if (size < SecondLevelCount) return MapInsert(size);
+
+	const std::uint32_t top	  = static_cast<std::uint32_t>(std::bit_width(size)) - 1u;
+	const std::uint64_t round = static_cast<std::uint64_t>(size) + (1ull << (top - SecondLevelBits)) - 1ull;
+	if (round > 0xFFFFFFFFull) return { FirstLevelCount, 0u };
+
+	return MapInsert(static_cast<std::uint32_t>(round));
+}
+
+void DescriptorRangeAllocator::Reset(const std::uint32_t capacity)
+{
+	m_capacity	= capacity;
+	m_allocated = 0u;
+	m_freeRuns	= 0u;
+
+	m_firstBitmap = 0u;
+	m_secondBitmap.fill(0u);
+	m_heads		  .fill(InvalidIndex);
+
+	m_runSize .assign(capacity, 0u);
+	m_runStart.assign(capacity, InvalidIndex);
+	m_next	  .assign(capacity, InvalidIndex);
+	m_prev	  .assign(capacity, InvalidIndex);
+	m_used	  .assign((static_cast<size_t>(capacity) + 63u) / 64u, 0ull);
+
+	if (capacity) InsertFree(0u, capacity);
+}
+
+void DescriptorRangeAllocator::InsertFree(const std::uint32_t start, const std::uint32_t size)
+{
+	const auto [first, second] = MapInsert(size);
+	const std::uint32_t list   = first * SecondLevelCount + second;
+
+	m_runSize[start]			 = size;
+	m_runStart[start + size - 1u] = start;
+
+	m_prev[start] = InvalidIndex;
+	m_next[start] = m_heads[list];
+	if (m_heads[list] != InvalidIndex) m_prev[m_heads[list]] = start;
+	m_heads[list] = start;
+
+	m_firstBitmap		  |= 1u << first;
+	m_secondBitmap[first] |= 1u << second;
+	++m_freeRuns;
+}
+
+void DescriptorRangeAllocator::RemoveFree(const std::uint32_t start)
+{
+	const std::uint32_t size   = m_runSize[start];
+	const auto [first, second] = MapInsert(size);
+	const std::uint32_t list   = first * SecondLevelCount + second;
+
+	const std::uint32_t next = m_next[start];
+	const std::uint32_t prev = m_prev[start];
+
+	if (next != InvalidIndex) m_prev[next] = prev;
+	if (prev != InvalidIndex) m_next[prev] = next;
+	else					  m_heads[list] = next;
+
+	if (m_heads[list] == InvalidIndex)
+	{
+		m_secondBitmap[first] &= ~(1u << second);
+		if (!m_secondBitmap[first]) m_firstBitmap &= ~(1u << first);
+	}
+
+	m_runSize[start]			 = 0u;
+	m_runStart[start + size - 1u] = InvalidIndex;
+	--m_freeRuns;
+}
+
+std::uint32_t DescriptorRangeAllocator::FindFree(const std::uint32_t size) const
+{
+	const auto [first, second] = MapSearch(size);
+
+	if (first < FirstLevelCount)
+	{
+		std::uint32_t fl = first;
+		std::uint32_t sl = m_secondBitmap[fl] & (~0u << second);
+
+		if (!sl)
+		{
+			const std::uint32_t above = m_firstBitmap & (~0u << (fl + 1u));
+			if (above)
+			{
+				fl = static_cast<std::uint32_t>(std::countr_zero(above));
+				sl = m_secondBitmap[fl];
+			}
+		}
+
+		if (sl) return m_heads[fl * SecondLevelCount + static_cast<std::uint32_t>(std::countr_zero(sl))];
+	}
+
+	//~ nothing in the rounded up classes, a run in the request's own class may still be long enough
+	const auto [exactFirst, exactSecond] = MapInsert(size);
+	for (std::uint32_t run = m_heads[exactFirst * SecondLevelCount + exactSecond]; run != InvalidIndex; run = m_next[run])
+	{
+		if (m_runSize[run] >= size) return run;
+	}
+
+	return InvalidIndex;
+}
+
+void DescriptorRangeAllocator::MarkUsed(const std::uint32_t index, const std::uint32_t count, const bool bUsed)
+{
+	std::uint32_t i			= index;
+	const std::uint32_t end = index + count;
+
+	while (i < end)
+	{
+		const std::uint32_t bit	 = i & 63u;
+		const std::uint32_t take = std::min(64u - bit, end - i);
+		const std::uint64_t mask = (take == 64u ? ~0ull : ((1ull << take) - 1ull)) << bit;
+
+		if (bUsed) m_used[i >> 6u] |=  mask;
+		else	   m_used[i >> 6u] &= ~mask;
+		i += take;
+	}
+}
+
+std::uint32_t DescriptorRangeAllocator::Allocate(const std::uint32_t count)
+{
+	if (count == 0u || count > m_capacity - m_allocated) return InvalidIndex;
+
+	const std::uint32_t start = FindFree(count);
+	if (start == InvalidIndex) return InvalidIndex;
+
+	//~ the tail of the run goes back as a shorter free run
+	const std::uint32_t size = m_runSize[start];
+	RemoveFree(start);
+	if (size > count) InsertFree(start + count, size - count);
+
+	MarkUsed(start, count, true);
+	m_allocated += count;
+	return start;
+}
+
+std::uint32_t DescriptorRangeAllocator::Free(const std::uint32_t index, std::uint32_t count)
+{
+	if (index >= m_capacity || count == 0u) return 0u;
+	count = std::min(count, m_capacity - index);
+
+	std::uint32_t freed = 0u;
+	std::uint32_t i		= index;
+	const std::uint32_t end = index + count;
+
+	while (i < end)
+	{
+		if (!IsAllocated(i)) { ++i; continue; }
+
+		//~ every used stretch inside the range is returned as its own run
+		std::uint32_t runEnd = i + 1u;
+		while (runEnd < end && IsAllocated(runEnd)) ++runEnd;
+
+		std::uint32_t start = i;
+		std::uint32_t size	= runEnd - i;
+		MarkUsed(start, size, false);
+		freed += size;
+
+		if (start > 0u && m_runStart[start - 1u] != InvalidIndex)
+		{
+			const std::uint32_t left = m_runStart[start - 1u];
+			size += m_runSize[left];
+			RemoveFree(left);
+			start = left;
+		}
+
+		if (runEnd < m_capacity && m_runSize[runEnd] != 0u)
+		{
+			size += m_runSize[runEnd];
+			RemoveFree(runEnd);
+		}
+
+		InsertFree(start, size);
+		i = runEnd;
+	}
+
+	m_allocated -= freed;
+	return freed;
+}
+
+std::uint32_t DescriptorRangeAllocator::GetLargestFreeRun() const
+{
+	if (!m_firstBitmap) return 0u;
+
+	const auto first  = static_cast<std::uint32_t>(std::bit_width(m_firstBitmap)) - 1u;
+	const auto second = static_cast<std::uint32_t>(std::bit_width(m_secondBitmap[first])) - 1u;
+
+	std::uint32_t largest = 0u;
+	for (std::uint32_t run = m_heads[first * SecondLevelCount + second]; run != InvalidIndex; run = m_next[run])
+	{
+		largest = std::max(largest, m_runSize[run]);
+	}
+	return largest;
+}
+
+bool DescriptorRangeAllocator::AllocateAt(const std::uint32_t index, const std::uint32_t count)
+{
+	if (count == 0u || index >= m_capacity || count > m_capacity - index) return false;
+	if (IsAllocated(index)) return false;
+
+	const std::uint32_t end = NextUsed(index);
+	if (end - index < count) return false;
+
+	//~ the free run ends right before the next used slot, its start is kept there
+	const std::uint32_t start = m_runStart[end - 1u];
+	RemoveFree(start);
+	if (start < index)		 InsertFree(start, index - start);
+	if (index + count < end) InsertFree(index + count, end - index - count);
+
+	MarkUsed(index, count, true);
+	m_allocated += count;
+	return true;
+}
+
+std::uint32_t DescriptorRangeAllocator::FindFirstFit(const std::uint32_t count, const std::uint32_t limit) const
+{
+	if (count == 0u) return InvalidIndex;
+
+	for (std::uint32_t start = NextFree(0u); start <= limit && start < m_capacity;)
+	{
+		const std::uint32_t end = NextUsed(start);
+		if (end - start >= count) return start;
+		start = NextFree(end);
+	}
+	return InvalidIndex;
+}
+
+std::uint32_t DescriptorRangeAllocator::Relocate(const std::uint32_t index, const std::uint32_t count)
+{
+	if (count == 0u || index >= m_capacity || count > m_capacity - index) return index;
+
+	//~ freed first so a hole that overlaps the range's own slots is found too
+	Free(index, count);
+
+	std::uint32_t target = FindFirstFit(count, index);
+	if (target > index) target = index;
+
+	//~ the range itself is always free again, claiming it back can't fail
+	AllocateAt(target, count);
+	return target;
+}
+
+std::uint32_t DescriptorRangeAllocator::NextUsed(const std::uint32_t from) const
+{
+	if (from >= m_capacity) return m_capacity;
+
+	size_t word		   = from >> 6u;
+	std::uint64_t bits = m_used[word] & (~0ull << (from & 63u));
+
+	while (!bits)
+	{
+		if (++word == m_used.size()) return m_capacity;
+		bits = m_used[word];
+	}
+
+	return std::min(m_capacity, static_cast<std::uint32_t>(word * 64u + std::countr_zero(bits)));
+}
+
+std::uint32_t DescriptorRangeAllocator::NextFree(const std::uint32_t from) const
+{
+	if (from >= m_capacity) return m_capacity;
+
+	//~ bits past the capacity read as free, the clamp below hides them
+	size_t word		   = from >> 6u;
+	std::uint64_t bits = ~m_used[word] & (~0ull << (from & 63u));
+
+	while (!bits)
+	{
+		if (++word == m_used.size()) return m_capacity;
+		bits = ~m_used[word];
+	}
+
+	return std::min(m_capacity, static_cast<std::uint32_t>(word * 64u + std::countr_zero(bits)));
+}
+
+void DescriptorRangeAllocator::CollectRuns(std::vector<Run>& runs) const
+{
+	runs.clear();
+
+	for (std::uint32_t start = 0u; start < m_capacity;)
+	{
+		const bool bUsed		= IsAllocated(start);
+		const std::uint32_t end = bUsed ? NextFree(start) : NextUsed(start);
+		runs.push_back({ start, end - start, bUsed });
+		start = end;
+	}
+}
+
+DescriptorRangeAllocator::FragmentationStats DescriptorRangeAllocator::GetFragmentation() const
+{
+	FragmentationStats stats{};
+	stats.FreeSlots = m_capacity - m_allocated;
+	stats.FreeRuns	= m_freeRuns;
+
+	for (const std::uint32_t head : m_heads)
+	{
+		for (std::uint32_t run = head; run != InvalidIndex; run = m_next[run])
+		{
+			const std::uint32_t size   = m_runSize[run];
+			const std::uint32_t bucket = static_cast<std::uint32_t>(std::bit_width(size)) - 1u;
+
+			++stats.Histogram[std::min(bucket, HistogramBuckets - 1u)];
+			stats.LargestFreeRun = std::max(stats.LargestFreeRun, size);
+		}
+	}
+
+	if (stats.FreeSlots)
+	{
+		stats.Fragmentation = 1.0f - static_cast<float>(stats.LargestFreeRun) / static_cast<float>(stats.FreeSlots);
+	}
+	return stats;
+}
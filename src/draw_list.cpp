@@ -0,0 +1,126 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/15/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/draw_list.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+
+#include "imgui.h"
+
+using namespace framework;
+
+std::uint32_t DrawKey::QuantizeDepth(const float distance, const float farZ)
+{
+	constexpr float maxDepth = static_cast<float>((1u << DepthBits) - 1u);
+	const float t = farZ > 0.0f ? std::clamp(distance / farZ, 0.0f, 1.0f) : 0.0f;
+	return static_cast<std::uint32_t>(t * maxDepth);
+}
+
+void DrawList::Reserve(const std::uint32_t count)
+{
+	m_packets.reserve(count);
+	m_scratch.reserve(count);
+}
+
+void DrawList::Sort()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	RadixSort(m_packets, m_scratch);
+
+	m_lastSortMicro = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+}
+
+void DrawList::RadixSort(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch)
+{
+	const size_t count = packets.size();
+	if (count < 2u) return;
+
+	//~ every histogram in one read of the keys
+	std::array<std::array<std::uint32_t, 256>, 8> histograms{};
+	for (const auto& packet : packets)
+	{
+		for (std::uint32_t digit = 0; digit < 8u; ++digit)
+			++histograms[digit][(packet.Key >> (digit * 8u)) & 0xFFu];
+	}
+
+	scratch.resize(count);
+	DrawPacket* src = packets.data();
+	DrawPacket* dst = scratch.data();
+
+	for (std::uint32_t digit = 0; digit < 8u; ++digit)
+	{
+		auto& histogram = histograms[digit];
+
+		//~ all keys share this byte, the pass would be a plain copy
+		const std::uint32_t first = (src[0].Key >> (digit * 8u)) & 0xFFu;
+		if (histogram[first] == count) continue;
+
+		std::uint32_t offset = 0u;
+		for (auto& bucket : histogram)
+		{
+			const std::uint32_t n = bucket;
+			bucket = offset;
+			offset += n;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const std::uint32_t byte = (src[i].Key >> (digit * 8u)) & 0xFFu;
+			dst[histogram[byte]++] = src[i];
+		}
+		std::swap(src, dst);
+	}
+
+	//~ odd number of real passes leaves the result in scratch
+	if (src != packets.data())
+		packets.swap(scratch);
+}
+
+void DrawList::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Draw List"))
+	{
+		ImGui::BulletText("Packets: %u", static_cast<std::uint32_t>(m_packets.size()));
+		ImGui::BulletText("Sort: %.1f us", m_lastSortMicro);
+	}
+
+	ImGui::PopID();
+}
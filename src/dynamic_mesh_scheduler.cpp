@@ -0,0 +1,235 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/10/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/dynamic_mesh_scheduler.h"
+#include "framework/jobs/job_system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+#include "imgui.h"
+
+using namespace framework;
+
+void DynamicMeshScheduler::Initialize(const DynamicMeshSchedulerConfig &config)
+{
+	m_config = config;
+	m_config.RowFraction		= std::clamp(m_config.RowFraction, 0.0f, 1.0f);
+	m_config.BudgetMicroseconds = std::max(m_config.BudgetMicroseconds, 0.0f);
+
+	const size_t rows = m_config.RowCount;
+	m_age  .assign(rows, 0u);
+	m_dirty.assign(rows, 0u);
+	m_order.resize(rows);
+	m_score.resize(rows);
+	m_updatedRows.clear();
+	m_updatedRows.reserve(rows);
+
+	//~ nothing has been computed yet, everything must go once
+	MarkAllStale();
+}
+
+void DynamicMeshScheduler::SetRowFraction(const float fraction)
+{
+	m_config.RowFraction = std::clamp(fraction, 0.0f, 1.0f);
+}
+
+void DynamicMeshScheduler::SetBudgetMicroseconds(const float micro)
+{
+	m_config.BudgetMicroseconds = std::max(micro, 0.0f);
+}
+
+std::uint32_t DynamicMeshScheduler::Update(
+	const std::vector<float> &rowDistances,
+	const std::function<void(std::uint32_t row)> &updateRow)
+{
+	m_updatedRows.clear();
+	m_bLastBudgetHit = false;
+	if (!IsInitialized() || !updateRow) return 0u;
+
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	const std::uint32_t rows  = m_config.RowCount;
+	const std::uint32_t quota = std::clamp(
+		static_cast<std::uint32_t>(std::ceil(static_cast<float>(rows) * m_config.RowFraction)),
+		1u, rows);
+
+	//~ stale and close rows first
+	for (std::uint32_t i = 0; i < rows; ++i)
+	{
+		const float distance = i < rowDistances.size() ? std::max(rowDistances[i], 0.0f) : 0.0f;
+		m_score[i] = static_cast<float>(m_age[i] + 1u) / (1.0f + m_config.DistanceFalloff * distance);
+		++m_age[i];
+	}
+
+	std::iota(m_order.begin(), m_order.end(), 0u);
+	const auto byScore = [&](const std::uint32_t a, const std::uint32_t b)
+	{
+		return m_score[a] > m_score[b];
+	};
+
+	if (quota < rows)
+	{
+		std::nth_element(m_order.begin(), m_order.begin() + quota, m_order.end(), byScore);
+	}
+	std::sort(m_order.begin(), m_order.begin() + quota, byScore);
+
+	const float budget = m_config.BudgetMicroseconds;
+	float elapsed = 0.0f;
+
+	//~ batch of rows between budget checks, one row when running serial
+	const bool parallel = m_jobs && m_jobs->IsInitialized() && m_jobs->GetWorkerCount() > 0u;
+	const std::uint32_t grain = std::max(m_config.ParallelGrain, 1u);
+	const std::uint32_t batch = parallel ? grain * (m_jobs->GetWorkerCount() + 1u) : 1u;
+
+	for (std::uint32_t k = 0; k < quota; )
+	{
+		const std::uint32_t count = std::min(batch, quota - k);
+
+		if (parallel)
+		{
+			m_jobs->ParallelFor(count, grain, [&, k](const std::uint32_t begin, const std::uint32_t end)
+			{
+				for (std::uint32_t i = begin; i < end; ++i)
+					updateRow(m_order[k + i]);
+			});
+		}
+		else updateRow(m_order[k]);
+
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			const std::uint32_t row = m_order[k + i];
+			m_age  [row] = 0u;
+			m_dirty[row] = 1u;
+			m_updatedRows.push_back(row);
+		}
+		k += count;
+
+		elapsed = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+		if (elapsed >= budget)
+		{
+			m_bLastBudgetHit = k < quota;
+			break;
+		}
+	}
+
+	m_maxAge			= *std::ranges::max_element(m_age);
+	m_lastRowsUpdated	= static_cast<std::uint32_t>(m_updatedRows.size());
+	m_lastElapsedMicro	= elapsed;
+	return m_lastRowsUpdated;
+}
+
+void DynamicMeshScheduler::MarkDirty(const std::uint32_t firstRow, const std::uint32_t rowCount)
+{
+	if (firstRow >= m_config.RowCount) return;
+	const std::uint32_t last = std::min(firstRow + rowCount, m_config.RowCount);
+	std::fill(m_dirty.begin() + firstRow, m_dirty.begin() + last, std::uint8_t{ 1u });
+}
+
+void DynamicMeshScheduler::MarkAllStale()
+{
+	//~ same age for every row means camera distance alone orders the next passes
+	std::ranges::fill(m_age, m_config.RowCount);
+}
+
+void DynamicMeshScheduler::CollectDirtyRanges(std::vector<DirtyRowRange> &out)
+{
+	out.clear();
+
+	std::uint32_t rowsUploaded = 0u;
+	std::uint32_t row = 0u;
+	while (row < m_config.RowCount)
+	{
+		if (!m_dirty[row])
+		{
+			++row;
+			continue;
+		}
+
+		DirtyRowRange range{ row, 0u };
+		while (row < m_config.RowCount && m_dirty[row])
+		{
+			m_dirty[row] = 0u;
+			++range.RowCount;
+			++row;
+		}
+
+		rowsUploaded += range.RowCount;
+		out.push_back(range);
+	}
+
+	m_lastRangesUploaded = static_cast<std::uint32_t>(out.size());
+	m_lastRowsUploaded	 = rowsUploaded;
+}
+
+void DynamicMeshScheduler::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Dynamic Mesh Scheduler", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::Indent();
+
+		float fraction = m_config.RowFraction;
+		if (ImGui::SliderFloat("Rows / Frame", &fraction, 0.01f, 1.0f))
+			SetRowFraction(fraction);
+
+		float budget = m_config.BudgetMicroseconds;
+		if (ImGui::DragFloat("Budget (us)", &budget, 10.0f, 0.0f, 33000.0f))
+			SetBudgetMicroseconds(budget);
+
+		ImGui::SliderFloat("Distance Falloff", &m_config.DistanceFalloff, 0.0f, 2.0f);
+
+		int grain = static_cast<int>(m_config.ParallelGrain);
+		if (ImGui::SliderInt("Rows / Job", &grain, 1, 64))
+			m_config.ParallelGrain = static_cast<std::uint32_t>(grain);
+
+		if (ImGui::Button("Refresh All"))
+			MarkAllStale();
+
+		ImGui::Separator();
+		ImGui::BulletText("Rows: %u", m_config.RowCount);
+		ImGui::BulletText("Updated: %u (%.1f us)%s", m_lastRowsUpdated, m_lastElapsedMicro,
+			m_bLastBudgetHit ? " [budget hit]" : "");
+		ImGui::BulletText("Uploaded: %u rows in %u ranges", m_lastRowsUploaded, m_lastRangesUploaded);
+		ImGui::BulletText("Oldest Row Age: %u frames", m_maxAge);
+
+		ImGui::Unindent();
+	}
+
+	ImGui::PopID();
+}
@@ -0,0 +1,220 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/15/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/frustum_culler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "imgui.h"
+
+using namespace framework;
+using namespace DirectX;
+
+void FrustumCuller::SetViewProjection(const XMFLOAT4X4& viewProjection)
+{
+	//~ clip = p * VP, every plane is a sum of the w column and one other column (d3d depth 0..1)
+	const auto column = [&](const int c)
+	{
+		return XMFLOAT4(viewProjection.m[0][c], viewProjection.m[1][c], viewProjection.m[2][c], viewProjection.m[3][c]);
+	};
+
+	const XMFLOAT4 x = column(0), y = column(1), z = column(2), w = column(3);
+
+	m_planes[0] = { w.x + x.x, w.y + x.y, w.z + x.z, w.w + x.w }; // left
+	m_planes[1] = { w.x - x.x, w.y - x.y, w.z - x.z, w.w - x.w }; // right
+	m_planes[2] = { w.x + y.x, w.y + y.y, w.z + y.z, w.w + y.w }; // bottom
+	m_planes[3] = { w.x - y.x, w.y - y.y, w.z - y.z, w.w - y.w }; // top
+	m_planes[4] = { z.x,	   z.y,		  z.z,		 z.w	   }; // near
+	m_planes[5] = { w.x - z.x, w.y - z.y, w.z - z.z, w.w - z.w }; // far
+
+	for (auto& plane : m_planes)
+	{
+		const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+		if (length <= 0.0f) continue;
+
+		plane.x /= length; plane.y /= length; plane.z /= length; plane.w /= length;
+	}
+}
+
+void FrustumCuller::Clear()
+{
+	for (auto* v : { &m_centerX, &m_centerY, &m_centerZ, &m_extentX, &m_extentY, &m_extentZ })
+		v->clear();
+
+	m_ids.clear();
+}
+
+void FrustumCuller::Reserve(const std::uint32_t count)
+{
+	const size_t padded = (static_cast<size_t>(count) + 3u) & ~size_t{ 3u };
+
+	for (auto* v : { &m_centerX, &m_centerY, &m_centerZ, &m_extentX, &m_extentY, &m_extentZ })
+		v->reserve(padded);
+
+	m_ids	 .reserve(count);
+	m_visible.reserve(padded);
+}
+
+void FrustumCuller::Add(
+	const std::uint32_t id,
+	const XMFLOAT3& center,
+	const XMFLOAT3& extents,
+	const XMFLOAT4X4& worldTransposed)
+{
+	const auto& m = worldTransposed.m;
+
+	//~ row r of the transposed world is what the world's column r does to a point
+	const XMFLOAT3 worldCenter
+	{
+		m[0][0] * center.x + m[0][1] * center.y + m[0][2] * center.z + m[0][3],
+		m[1][0] * center.x + m[1][1] * center.y + m[1][2] * center.z + m[1][3],
+		m[2][0] * center.x + m[2][1] * center.y + m[2][2] * center.z + m[2][3],
+	};
+
+	//~ extents of the rotated box projected back onto the world axes
+	const XMFLOAT3 worldExtents
+	{
+		std::fabs(m[0][0]) * extents.x + std::fabs(m[0][1]) * extents.y + std::fabs(m[0][2]) * extents.z,
+		std::fabs(m[1][0]) * extents.x + std::fabs(m[1][1]) * extents.y + std::fabs(m[1][2]) * extents.z,
+		std::fabs(m[2][0]) * extents.x + std::fabs(m[2][1]) * extents.y + std::fabs(m[2][2]) * extents.z,
+	};
+
+	AddWorld(id, worldCenter, worldExtents);
+}
+
+void FrustumCuller::AddWorld(const std::uint32_t id, const XMFLOAT3& center, const XMFLOAT3& extents)
+{
+	//~ the arrays grow a whole group of four at a time, the unused tail lanes stay zero
+	const size_t index = m_ids.size();
+	if (index == m_centerX.size())
+	{
+		for (auto* v : { &m_centerX, &m_centerY, &m_centerZ, &m_extentX, &m_extentY, &m_extentZ })
+			v->resize(index + 4u, 0.0f);
+	}
+
+	m_centerX[index] = center.x;  m_centerY[index] = center.y;	m_centerZ[index] = center.z;
+	m_extentX[index] = extents.x; m_extentY[index] = extents.y; m_extentZ[index] = extents.z;
+	m_ids.push_back(id);
+}
+
+void FrustumCuller::GetWorldBounds(const std::uint32_t index, XMFLOAT3& center, XMFLOAT3& extents) const
+{
+	center	= { m_centerX[index], m_centerY[index], m_centerZ[index] };
+	extents = { m_extentX[index], m_extentY[index], m_extentZ[index] };
+}
+
+std::uint32_t FrustumCuller::Cull()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	//~ AddWorld keeps the arrays padded, tail lanes are dropped by the count check below
+	const size_t count	= m_ids.size();
+	const size_t padded = (count + 3u) & ~size_t{ 3u };
+
+	XMVECTOR nx[6], ny[6], nz[6], nw[6], ax[6], ay[6], az[6];
+	for (int p = 0; p < 6; ++p)
+	{
+		nx[p] = XMVectorReplicate(m_planes[p].x);
+		ny[p] = XMVectorReplicate(m_planes[p].y);
+		nz[p] = XMVectorReplicate(m_planes[p].z);
+		nw[p] = XMVectorReplicate(m_planes[p].w);
+		ax[p] = XMVectorAbs(nx[p]);
+		ay[p] = XMVectorAbs(ny[p]);
+		az[p] = XMVectorAbs(nz[p]);
+	}
+
+	m_visible.resize(padded);
+	std::uint32_t visible = 0u;
+	const XMVECTOR zero = XMVectorZero();
+
+	for (size_t i = 0; i < padded; i += 4u)
+	{
+		const XMVECTOR cx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_centerX[i]));
+		const XMVECTOR cy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_centerY[i]));
+		const XMVECTOR cz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_centerZ[i]));
+		const XMVECTOR ex = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_extentX[i]));
+		const XMVECTOR ey = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_extentY[i]));
+		const XMVECTOR ez = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_extentZ[i]));
+
+		//~ a box is out once it lies fully behind any plane: distance + projected radius < 0
+		XMVECTOR outside = XMVectorFalseInt();
+		for (int p = 0; p < 6; ++p)
+		{
+			XMVECTOR distance = XMVectorMultiplyAdd(cx, nx[p], nw[p]);
+			distance = XMVectorMultiplyAdd(cy, ny[p], distance);
+			distance = XMVectorMultiplyAdd(cz, nz[p], distance);
+
+			XMVECTOR radius = XMVectorMultiply(ex, ax[p]);
+			radius = XMVectorMultiplyAdd(ey, ay[p], radius);
+			radius = XMVectorMultiplyAdd(ez, az[p], radius);
+
+			outside = XMVectorOrInt(outside, XMVectorLess(XMVectorAdd(distance, radius), zero));
+		}
+
+		XMUINT4 mask;
+		XMStoreUInt4(&mask, outside);
+		const std::uint32_t lanes[4] = { mask.x, mask.y, mask.z, mask.w };
+
+		//~ branchless compaction, every lane is written and only survivors advance
+		const size_t valid = std::min<size_t>(4u, count - i);
+		for (size_t k = 0; k < valid; ++k)
+		{
+			m_visible[visible] = m_ids[i + k];
+			visible += lanes[k] == 0u ? 1u : 0u;
+		}
+	}
+
+	m_visible.resize(visible);
+
+	m_lastTested  = static_cast<std::uint32_t>(count);
+	m_lastVisible = visible;
+	m_lastMicro	  = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+	return visible;
+}
+
+void FrustumCuller::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Frustum Culling"))
+	{
+		ImGui::BulletText("Visible: %u / %u", m_lastVisible, m_lastTested);
+		ImGui::BulletText("Cull: %.1f us", m_lastMicro);
+	}
+
+	ImGui::PopID();
+}
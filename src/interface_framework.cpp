@@ -162,6 +162,9 @@ namespace framework
 			logger::error("Failed to Initialize Render Manager");
 		}
 
+		m_jobSystem.Initialize();
+		logger::info("Job System running with {} workers", m_jobSystem.GetWorkerCount());
+
 		logger::success("All Managers initialized.");
 	}
 
@@ -169,6 +172,9 @@ namespace framework
 	{
 		logger::warning("Closing Application!");
 
+		//~ the application lets its scenes go while the device is still alive
+		Release();
+
 		if (m_pWindowsManager && !m_pWindowsManager->Release())
 		{
 			logger::error("Failed to Release Windows Manager!");
@@ -179,6 +185,8 @@ namespace framework
 			logger::error("Failed to release render manager");
 		}
 
+		m_jobSystem.Shutdown();
+
 		logger::close();
 	}
 
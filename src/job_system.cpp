@@ -0,0 +1,399 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/12/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/jobs/job_system.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "imgui.h"
+
+using namespace framework;
+
+namespace
+{
+	//~ index of the queue owned by this thread, -1 for threads outside the pool
+	thread_local std::int32_t t_queueIndex = -1;
+	thread_local const JobSystem* t_owner  = nullptr;
+}
+
+JobSystem::~JobSystem()
+{
+	Shutdown();
+}
+
+void JobSystem::Initialize(std::uint32_t workerCount)
+{
+	if (m_bInitialized) return;
+
+	if (workerCount == 0u)
+	{
+		const std::uint32_t hw = std::max(std::thread::hardware_concurrency(), 2u);
+		workerCount = hw - 1u;
+	}
+
+	m_bStop.store(false);
+	m_queues.clear();
+	for (std::uint32_t i = 0; i < workerCount + 1u; ++i)
+		m_queues.emplace_back(std::make_unique<WorkQueue>());
+
+	t_queueIndex = 0;
+	t_owner		 = this;
+
+	m_workers.reserve(workerCount);
+	for (std::uint32_t i = 0; i < workerCount; ++i)
+	{
+		m_workers.emplace_back([this, queue = i + 1u] { WorkerLoop(queue); });
+	}
+
+	m_bInitialized = true;
+}
+
+void JobSystem::Shutdown()
+{
+	if (!m_bInitialized) return;
+
+	//~ drain whatever is left so no counter stays pending forever
+	while (TryRunOne()) {}
+
+	{
+		std::lock_guard lock(m_wakeLock);
+		m_bStop.store(true);
+	}
+	m_wake.notify_all();
+	m_workers.clear(); // jthread joins
+
+	m_queues.clear();
+	m_bInitialized = false;
+}
+
+void JobSystem::Run(Job job, JobCounter *counter)
+{
+	if (counter) counter->m_pending.fetch_add(1u, std::memory_order_acq_rel);
+
+	Task task{ std::move(job), counter };
+	if (!m_bInitialized)
+	{
+		//~ no pool, behave like a plain call
+		Execute(task);
+		return;
+	}
+	Push(std::move(task));
+}
+
+void JobSystem::RunOnWorker(Job job, JobCounter *counter)
+{
+	if (counter) counter->m_pending.fetch_add(1u, std::memory_order_acq_rel);
+
+	Task task{ std::move(job), counter };
+	if (!m_bInitialized)
+	{
+		Execute(task);
+		return;
+	}
+
+	{
+		std::lock_guard lock(m_workerOnly.Lock);
+		m_workerOnly.Tasks.push_back(std::move(task));
+		m_queued.fetch_add(1u, std::memory_order_release);
+	}
+
+	{
+		std::lock_guard lock(m_wakeLock);
+	}
+	m_wake.notify_one();
+}
+
+void JobSystem::RunAfter(JobCounter &dependency, Job job, JobCounter *counter)
+{
+	if (counter) counter->m_pending.fetch_add(1u, std::memory_order_acq_rel);
+
+	{
+		std::lock_guard lock(dependency.m_lock);
+		if (!dependency.IsDone())
+		{
+			dependency.m_continuations.push_back({ std::move(job), counter });
+			return;
+		}
+	}
+
+	Task task{ std::move(job), counter };
+	if (m_bInitialized) Push(std::move(task));
+	else Execute(task);
+}
+
+void JobSystem::Wait(JobCounter &counter)
+{
+	while (!counter.IsDone())
+	{
+		if (!TryRunOne()) std::this_thread::yield();
+	}
+
+	//~ let the finishing job leave the counter before the caller drops it
+	std::exception_ptr error;
+	{
+		std::lock_guard lock(counter.m_lock);
+		error = std::exchange(counter.m_error, nullptr);
+	}
+
+	if (error) std::rethrow_exception(error);
+}
+
+void JobSystem::RethrowDetached()
+{
+	std::exception_ptr error;
+	{
+		std::lock_guard lock(m_errorLock);
+		error = std::exchange(m_detachedError, nullptr);
+	}
+
+	if (error) std::rethrow_exception(error);
+}
+
+void JobSystem::ParallelFor(
+	const std::uint32_t count,
+	std::uint32_t grain,
+	const std::function<void(std::uint32_t begin, std::uint32_t end)> &body)
+{
+	if (count == 0u) return;
+	grain = std::max(grain, 1u);
+
+	const std::uint32_t chunks = (count + grain - 1u) / grain;
+	if (!m_bInitialized || m_workers.empty() || chunks == 1u)
+	{
+		body(0u, count);
+		return;
+	}
+
+	JobCounter counter;
+	for (std::uint32_t c = 1u; c < chunks; ++c)
+	{
+		const std::uint32_t begin = c * grain;
+		const std::uint32_t end	  = std::min(begin + grain, count);
+		Run([&body, begin, end] { body(begin, end); }, &counter);
+	}
+
+	//~ first chunk on the caller, then help until the rest is done. The other chunks hold on to
+	//~ body and counter, so even a throwing first chunk has to wait for them before leaving
+	try
+	{
+		body(0u, std::min(grain, count));
+	}
+	catch (...)
+	{
+		KeepError(&counter, std::current_exception());
+	}
+	Wait(counter);
+}
+
+void JobSystem::Push(Task &&task)
+{
+	std::uint32_t queue = CurrentQueue();
+	if (queue >= m_queues.size())
+	{
+		//~ foreign thread, spread over the pool
+		queue = m_submitCursor.fetch_add(1u, std::memory_order_relaxed) % static_cast<std::uint32_t>(m_queues.size());
+	}
+
+	{
+		std::lock_guard lock(m_queues[queue]->Lock);
+		m_queues[queue]->Tasks.push_back(std::move(task));
+		m_queued.fetch_add(1u, std::memory_order_release);
+	}
+
+	{
+		std::lock_guard lock(m_wakeLock);
+	}
+	m_wake.notify_one();
+}
+
+bool JobSystem::TryPop(const std::uint32_t queue, Task &out)
+{
+	auto& q = *m_queues[queue];
+	std::lock_guard lock(q.Lock);
+	if (q.Tasks.empty()) return false;
+
+	out = std::move(q.Tasks.back());
+	q.Tasks.pop_back();
+	m_queued.fetch_sub(1u, std::memory_order_acq_rel);
+	return true;
+}
+
+bool JobSystem::TrySteal(const std::uint32_t thief, Task &out)
+{
+	const auto count = static_cast<std::uint32_t>(m_queues.size());
+	for (std::uint32_t i = 1; i < count; ++i)
+	{
+		auto& q = *m_queues[(thief + i) % count];
+		std::lock_guard lock(q.Lock);
+		if (q.Tasks.empty()) continue;
+
+		out = std::move(q.Tasks.front());
+		q.Tasks.pop_front();
+		m_queued.fetch_sub(1u, std::memory_order_acq_rel);
+		m_stolen.fetch_add(1u, std::memory_order_relaxed);
+		return true;
+	}
+	return false;
+}
+
+bool JobSystem::TryPopWorkerOnly(Task &out)
+{
+	std::lock_guard lock(m_workerOnly.Lock);
+	if (m_workerOnly.Tasks.empty()) return false;
+
+	out = std::move(m_workerOnly.Tasks.front());
+	m_workerOnly.Tasks.pop_front();
+	m_queued.fetch_sub(1u, std::memory_order_acq_rel);
+	return true;
+}
+
+bool JobSystem::TryRunOne()
+{
+	if (m_queues.empty()) return false;
+
+	std::uint32_t queue = CurrentQueue();
+	if (queue >= m_queues.size()) queue = 0u;
+
+	Task task;
+	//~ queue 0 is the thread that called Initialize, it leaves the worker only jobs alone
+	if (TryPop(queue, task) || (queue != 0u && TryPopWorkerOnly(task)) || TrySteal(queue, task))
+	{
+		Execute(task);
+		return true;
+	}
+	return false;
+}
+
+void JobSystem::Execute(Task &task)
+{
+	//~ a throwing job still counts down, otherwise its waiters spin forever and the worker dies
+	try
+	{
+		task.Work();
+	}
+	catch (...)
+	{
+		KeepError(task.Counter, std::current_exception());
+	}
+	m_executed.fetch_add(1u, std::memory_order_relaxed);
+
+	JobCounter* counter = task.Counter;
+	if (!counter) return;
+
+	//~ not the last one, no need for the lock
+	std::uint32_t pending = counter->m_pending.load(std::memory_order_acquire);
+	while (pending > 1u)
+	{
+		if (counter->m_pending.compare_exchange_weak(pending, pending - 1u, std::memory_order_acq_rel))
+			return;
+	}
+
+	//~ last one out releases the dependants, zero is only ever published under the lock
+	//~ so a waiter that takes the lock afterwards knows the counter is no longer touched
+	std::vector<JobCounter::Continuation> ready;
+	{
+		std::lock_guard lock(counter->m_lock);
+		if (counter->m_pending.fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+			return;
+		ready.swap(counter->m_continuations);
+	}
+
+	for (auto& next : ready)
+	{
+		Task follow{ std::move(next.Work), next.Counter };
+		if (m_bInitialized) Push(std::move(follow));
+		else Execute(follow);
+	}
+}
+
+void JobSystem::KeepError(JobCounter *counter, std::exception_ptr error)
+{
+	if (counter)
+	{
+		std::lock_guard lock(counter->m_lock);
+		if (!counter->m_error) counter->m_error = std::move(error);
+		return;
+	}
+
+	std::lock_guard lock(m_errorLock);
+	if (!m_detachedError) m_detachedError = std::move(error);
+}
+
+void JobSystem::WorkerLoop(const std::uint32_t queue)
+{
+	t_queueIndex = static_cast<std::int32_t>(queue);
+	t_owner		 = this;
+
+	while (true)
+	{
+		if (TryRunOne()) continue;
+
+		std::unique_lock lock(m_wakeLock);
+		m_wake.wait(lock, [this]
+		{
+			return m_bStop.load() || m_queued.load(std::memory_order_acquire) > 0u;
+		});
+
+		if (m_bStop.load() && m_queued.load(std::memory_order_acquire) == 0u)
+			return;
+	}
+}
+
+std::uint32_t JobSystem::CurrentQueue() const
+{
+	if (t_owner != this || t_queueIndex < 0) return ~0u;
+	return static_cast<std::uint32_t>(t_queueIndex);
+}
+
+void JobSystem::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Job System"))
+	{
+		const std::uint64_t executed = m_executed.load(std::memory_order_relaxed);
+		const std::uint64_t stolen	 = m_stolen	 .load(std::memory_order_relaxed);
+
+		ImGui::BulletText("Workers: %u (+ main)", GetWorkerCount());
+		ImGui::BulletText("Queued: %u", m_queued.load(std::memory_order_relaxed));
+		ImGui::BulletText("Jobs / frame: %llu", static_cast<unsigned long long>(executed - m_lastExecuted));
+		ImGui::BulletText("Steals / frame: %llu", static_cast<unsigned long long>(stolen - m_lastStolen));
+
+		m_lastExecuted = executed;
+		m_lastStolen   = stolen;
+	}
+
+	ImGui::PopID();
+}
@@ -0,0 +1,438 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/light_cluster_grid.h"
+
+#include "framework/jobs/job_system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "imgui.h"
+
+using namespace framework;
+using namespace DirectX;
+
+void LightClusterGrid::LightSet::Clear()
+{
+	for (auto* v : { &X, &Y, &Z, &Radius, &DirX, &DirY, &DirZ, &Cos, &Sin })
+		v->clear();
+
+	Ids.clear();
+}
+
+void LightClusterGrid::LightSet::Push(const LightSet& from, const std::uint32_t index)
+{
+	X	 .push_back(from.X	  [index]);
+	Y	 .push_back(from.Y	  [index]);
+	Z	 .push_back(from.Z	  [index]);
+	Radius.push_back(from.Radius[index]);
+	DirX .push_back(from.DirX [index]);
+	DirY .push_back(from.DirY [index]);
+	DirZ .push_back(from.DirZ [index]);
+	Cos	 .push_back(from.Cos  [index]);
+	Sin	 .push_back(from.Sin  [index]);
+	Ids	 .push_back(from.Ids  [index]);
+}
+
+void LightClusterGrid::LightSet::Pad()
+{
+	const size_t padded = (Ids.size() + 3u) & ~size_t{ 3u };
+
+	for (auto* v : { &X, &Y, &Z, &Radius, &DirX, &DirY, &DirZ, &Cos, &Sin })
+		v->resize(padded, 0.0f);
+}
+
+void LightClusterGrid::SetGridSize(const std::uint32_t countX, const std::uint32_t countY, const std::uint32_t countZ)
+{
+	m_countX = std::max(countX, 1u);
+	m_countY = std::max(countY, 1u);
+	m_countZ = std::max(countZ, 1u);
+	RebuildBoxes();
+}
+
+void LightClusterGrid::SetView(
+	const XMFLOAT4X4& view,
+	const XMFLOAT4X4& projection,
+	const float nearZ, const float farZ)
+{
+	m_view	= view;
+	m_projX = projection.m[0][0];
+	m_projY = projection.m[1][1];
+	m_nearZ = std::max(nearZ, 1e-4f);
+	m_farZ	= std::max(farZ, m_nearZ * 1.001f);
+	RebuildBoxes();
+}
+
+LightClusterGrid::Box LightClusterGrid::MakeBox(
+	const float ndcX0, const float ndcX1,
+	const float ndcY0, const float ndcY1,
+	const float z0, const float z1) const
+{
+	//~ a tile edge at ndc n sits at view n * z / proj, the box spans both depths of the slice
+	Box box{};
+	box.MinX = std::min(ndcX0 * z0, ndcX0 * z1) / m_projX;
+	box.MaxX = std::max(ndcX1 * z0, ndcX1 * z1) / m_projX;
+	box.MinY = std::min(ndcY0 * z0, ndcY0 * z1) / m_projY;
+	box.MaxY = std::max(ndcY1 * z0, ndcY1 * z1) / m_projY;
+	box.MinZ = z0;
+	box.MaxZ = z1;
+	return box;
+}
+
+void LightClusterGrid::RebuildBoxes()
+{
+	const float logRatio = std::log(m_farZ / m_nearZ);
+	m_depthScale = static_cast<float>(m_countZ) / logRatio;
+	m_depthBias	 = -static_cast<float>(m_countZ) * std::log(m_nearZ) / logRatio;
+
+	m_sliceBoxes  .resize(m_countZ);
+	m_rowBoxes	  .resize(static_cast<size_t>(m_countZ) * m_countY);
+	m_clusterBoxes.resize(GetClusterCount());
+	m_ranges	  .resize(GetClusterCount());
+
+	const auto sliceDepth = [&](const std::uint32_t k)
+	{
+		return m_nearZ * std::pow(m_farZ / m_nearZ, static_cast<float>(k) / static_cast<float>(m_countZ));
+	};
+
+	const float tileX = 2.0f / static_cast<float>(m_countX);
+	const float tileY = 2.0f / static_cast<float>(m_countY);
+
+	for (std::uint32_t k = 0; k < m_countZ; ++k)
+	{
+		const float z0 = sliceDepth(k);
+		const float z1 = k + 1u == m_countZ ? m_farZ : sliceDepth(k + 1u);
+
+		m_sliceBoxes[k] = MakeBox(-1.0f, 1.0f, -1.0f, 1.0f, z0, z1);
+
+		//~ rows run top down like the screen
+		for (std::uint32_t j = 0; j < m_countY; ++j)
+		{
+			const float y1 = 1.0f - tileY * static_cast<float>(j);
+			const float y0 = y1 - tileY;
+			const std::uint32_t row = k * m_countY + j;
+
+			m_rowBoxes[row] = MakeBox(-1.0f, 1.0f, y0, y1, z0, z1);
+
+			for (std::uint32_t i = 0; i < m_countX; ++i)
+			{
+				const float x0 = -1.0f + tileX * static_cast<float>(i);
+				m_clusterBoxes[row * m_countX + i] = MakeBox(x0, x0 + tileX, y0, y1, z0, z1);
+			}
+		}
+	}
+}
+
+void LightClusterGrid::Clear()
+{
+	for (auto* v : { &m_worldX, &m_worldY, &m_worldZ, &m_range, &m_worldDirX, &m_worldDirY, &m_worldDirZ, &m_spotPower })
+		v->clear();
+}
+
+void LightClusterGrid::Reserve(const std::uint32_t count)
+{
+	for (auto* v : { &m_worldX, &m_worldY, &m_worldZ, &m_range, &m_worldDirX, &m_worldDirY, &m_worldDirZ, &m_spotPower })
+		v->reserve(count);
+}
+
+std::uint32_t LightClusterGrid::AddPoint(const XMFLOAT3& position, const float range)
+{
+	//~ zero spot power marks a point light
+	return AddSpot(position, { 0.0f, 0.0f, 0.0f }, range, 0.0f);
+}
+
+std::uint32_t LightClusterGrid::AddSpot(
+	const XMFLOAT3& position,
+	const XMFLOAT3& direction,
+	const float range, const float spotPower)
+{
+	const auto id = static_cast<std::uint32_t>(m_worldX.size());
+
+	m_worldX   .push_back(position.x);
+	m_worldY   .push_back(position.y);
+	m_worldZ   .push_back(position.z);
+	m_range	   .push_back(std::max(range, 0.0f));
+	m_worldDirX.push_back(direction.x);
+	m_worldDirY.push_back(direction.y);
+	m_worldDirZ.push_back(direction.z);
+	m_spotPower.push_back(spotPower);
+	return id;
+}
+
+void LightClusterGrid::TransformLights()
+{
+	const auto& v = m_view.m;
+	const size_t count = m_worldX.size();
+
+	m_lights.Clear();
+	for (auto* a : { &m_lights.X, &m_lights.Y, &m_lights.Z, &m_lights.Radius,
+					 &m_lights.DirX, &m_lights.DirY, &m_lights.DirZ, &m_lights.Cos, &m_lights.Sin })
+		a->resize(count);
+	m_lights.Ids.resize(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float x = m_worldX[i], y = m_worldY[i], z = m_worldZ[i];
+
+		m_lights.X[i] = x * v[0][0] + y * v[1][0] + z * v[2][0] + v[3][0];
+		m_lights.Y[i] = x * v[0][1] + y * v[1][1] + z * v[2][1] + v[3][1];
+		m_lights.Z[i] = x * v[0][2] + y * v[1][2] + z * v[2][2] + v[3][2];
+		m_lights.Radius[i] = m_range[i];
+		m_lights.Ids   [i] = static_cast<std::uint32_t>(i);
+
+		const float dx = m_worldDirX[i], dy = m_worldDirY[i], dz = m_worldDirZ[i];
+		const float vx = dx * v[0][0] + dy * v[1][0] + dz * v[2][0];
+		const float vy = dx * v[0][1] + dy * v[1][1] + dz * v[2][1];
+		const float vz = dx * v[0][2] + dy * v[1][2] + dz * v[2][2];
+		const float length = std::sqrt(vx * vx + vy * vy + vz * vz);
+
+		if (m_spotPower[i] <= 0.0f || length <= 0.0f)
+		{
+			m_lights.DirX[i] = 0.0f; m_lights.DirY[i] = 0.0f; m_lights.DirZ[i] = 0.0f;
+			m_lights.Cos [i] = -1.0f;
+			m_lights.Sin [i] = 0.0f;
+			continue;
+		}
+
+		//~ the shader's max(dot, 0) ^ power drops below the cutoff at this angle
+		const float cosine = std::pow(SpotCutoff, 1.0f / std::max(m_spotPower[i], 1.0f));
+
+		m_lights.DirX[i] = vx / length; m_lights.DirY[i] = vy / length; m_lights.DirZ[i] = vz / length;
+		m_lights.Cos [i] = cosine;
+		m_lights.Sin [i] = std::sqrt(std::max(1.0f - cosine * cosine, 0.0f));
+	}
+
+	m_lights.Pad();
+}
+
+void LightClusterGrid::Filter(const LightSet& lights, const Box& box, std::vector<std::uint32_t>& hits)
+{
+	const size_t count	= lights.Ids.size();
+	const size_t padded = (count + 3u) & ~size_t{ 3u };
+
+	hits.resize(padded);
+	std::uint32_t found = 0u;
+
+	const XMVECTOR minX = XMVectorReplicate(box.MinX), maxX = XMVectorReplicate(box.MaxX);
+	const XMVECTOR minY = XMVectorReplicate(box.MinY), maxY = XMVectorReplicate(box.MaxY);
+	const XMVECTOR minZ = XMVectorReplicate(box.MinZ), maxZ = XMVectorReplicate(box.MaxZ);
+
+	//~ bounding sphere of the box for the cone test
+	const float hx = 0.5f * (box.MaxX - box.MinX);
+	const float hy = 0.5f * (box.MaxY - box.MinY);
+	const float hz = 0.5f * (box.MaxZ - box.MinZ);
+	const XMVECTOR sphereX = XMVectorReplicate(box.MinX + hx);
+	const XMVECTOR sphereY = XMVectorReplicate(box.MinY + hy);
+	const XMVECTOR sphereZ = XMVectorReplicate(box.MinZ + hz);
+	const XMVECTOR sphereR = XMVectorReplicate(std::sqrt(hx * hx + hy * hy + hz * hz));
+	const XMVECTOR negSphereR = XMVectorNegate(sphereR);
+
+	const XMVECTOR zero = XMVectorZero();
+	const auto load = [](const std::vector<float>& v, const size_t i)
+	{
+		return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&v[i]));
+	};
+
+	for (size_t i = 0; i < padded; i += 4u)
+	{
+		const XMVECTOR px = load(lights.X, i);
+		const XMVECTOR py = load(lights.Y, i);
+		const XMVECTOR pz = load(lights.Z, i);
+		const XMVECTOR r  = load(lights.Radius, i);
+
+		//~ sphere against box: squared distance from the center to the closest point of the box
+		const XMVECTOR ex = XMVectorMax(XMVectorMax(XMVectorSubtract(minX, px), XMVectorSubtract(px, maxX)), zero);
+		const XMVECTOR ey = XMVectorMax(XMVectorMax(XMVectorSubtract(minY, py), XMVectorSubtract(py, maxY)), zero);
+		const XMVECTOR ez = XMVectorMax(XMVectorMax(XMVectorSubtract(minZ, pz), XMVectorSubtract(pz, maxZ)), zero);
+
+		XMVECTOR distance = XMVectorMultiply(ex, ex);
+		distance = XMVectorMultiplyAdd(ey, ey, distance);
+		distance = XMVectorMultiplyAdd(ez, ez, distance);
+
+		XMVECTOR keep = XMVectorLessOrEqual(distance, XMVectorMultiply(r, r));
+
+		//~ cone against the box sphere: out when the sphere is past the side, the front or behind the apex
+		const XMVECTOR vx = XMVectorSubtract(sphereX, px);
+		const XMVECTOR vy = XMVectorSubtract(sphereY, py);
+		const XMVECTOR vz = XMVectorSubtract(sphereZ, pz);
+
+		XMVECTOR lengthSq = XMVectorMultiply(vx, vx);
+		lengthSq = XMVectorMultiplyAdd(vy, vy, lengthSq);
+		lengthSq = XMVectorMultiplyAdd(vz, vz, lengthSq);
+
+		XMVECTOR along = XMVectorMultiply(vx, load(lights.DirX, i));
+		along = XMVectorMultiplyAdd(vy, load(lights.DirY, i), along);
+		along = XMVectorMultiplyAdd(vz, load(lights.DirZ, i), along);
+
+		const XMVECTOR across = XMVectorSqrt(XMVectorMax(XMVectorSubtract(lengthSq, XMVectorMultiply(along, along)), zero));
+		const XMVECTOR side	  = XMVectorSubtract(XMVectorMultiply(load(lights.Cos, i), across),
+												 XMVectorMultiply(along, load(lights.Sin, i)));
+
+		keep = XMVectorAndInt(keep, XMVectorLessOrEqual(side, sphereR));
+		keep = XMVectorAndInt(keep, XMVectorLessOrEqual(along, XMVectorAdd(sphereR, r)));
+		keep = XMVectorAndInt(keep, XMVectorGreaterOrEqual(along, negSphereR));
+
+		XMUINT4 mask;
+		XMStoreUInt4(&mask, keep);
+		const std::uint32_t lanes[4] = { mask.x, mask.y, mask.z, mask.w };
+
+		//~ branchless compaction, every lane is written and only hits advance
+		const size_t valid = std::min<size_t>(4u, count - i);
+		for (size_t k = 0; k < valid; ++k)
+		{
+			hits[found] = static_cast<std::uint32_t>(i + k);
+			found += lanes[k] != 0u ? 1u : 0u;
+		}
+	}
+
+	hits.resize(found);
+}
+
+void LightClusterGrid::AssignSlice(const std::uint32_t slice)
+{
+	auto& scratch = m_scratch[slice];
+	scratch.Indices.clear();
+	scratch.Dropped = 0u;
+
+	Filter(m_lights, m_sliceBoxes[slice], scratch.Hits);
+
+	scratch.Slice.Clear();
+	for (const std::uint32_t hit : scratch.Hits) scratch.Slice.Push(m_lights, hit);
+	scratch.Slice.Pad();
+
+	for (std::uint32_t j = 0; j < m_countY; ++j)
+	{
+		const std::uint32_t row = slice * m_countY + j;
+
+		scratch.Row.Clear();
+		if (!scratch.Slice.Ids.empty())
+		{
+			Filter(scratch.Slice, m_rowBoxes[row], scratch.Hits);
+			for (const std::uint32_t hit : scratch.Hits) scratch.Row.Push(scratch.Slice, hit);
+			scratch.Row.Pad();
+		}
+
+		for (std::uint32_t i = 0; i < m_countX; ++i)
+		{
+			const std::uint32_t cluster = row * m_countX + i;
+
+			//~ offsets are local to the slice until Assign stitches the slices together
+			auto& range	 = m_ranges[cluster];
+			range.Offset = static_cast<std::uint32_t>(scratch.Indices.size());
+			range.Count	 = 0u;
+
+			if (scratch.Row.Ids.empty()) continue;
+
+			Filter(scratch.Row, m_clusterBoxes[cluster], scratch.Hits);
+
+			const auto count = std::min(static_cast<std::uint32_t>(scratch.Hits.size()), MaxLightsPerCluster);
+			for (std::uint32_t h = 0; h < count; ++h)
+				scratch.Indices.push_back(scratch.Row.Ids[scratch.Hits[h]]);
+
+			range.Count		 = count;
+			scratch.Dropped += static_cast<std::uint32_t>(scratch.Hits.size()) - count;
+		}
+	}
+}
+
+std::uint32_t LightClusterGrid::Assign()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	if (m_clusterBoxes.size() != GetClusterCount()) RebuildBoxes();
+
+	TransformLights();
+	m_scratch.resize(m_countZ);
+
+	m_bLastParallel = m_jobs && m_jobs->IsInitialized() && m_jobs->GetWorkerCount() > 0u
+					  && GetLightCount() >= ParallelThreshold;
+
+	if (m_bLastParallel)
+	{
+		m_jobs->ParallelFor(m_countZ, 1u, [this](const std::uint32_t begin, const std::uint32_t end)
+		{
+			for (std::uint32_t k = begin; k < end; ++k) AssignSlice(k);
+		});
+	}
+	else
+	{
+		for (std::uint32_t k = 0; k < m_countZ; ++k) AssignSlice(k);
+	}
+
+	//~ stitch, every slice's offsets move by what the slices before it wrote
+	size_t total = 0u;
+	for (const auto& scratch : m_scratch) total += scratch.Indices.size();
+	m_indices.resize(total);
+
+	const std::uint32_t perSlice = m_countX * m_countY;
+	std::uint32_t base = 0u;
+	m_lastMaxPerCluster = 0u;
+	m_lastDropped		= 0u;
+
+	for (std::uint32_t k = 0; k < m_countZ; ++k)
+	{
+		const auto& scratch = m_scratch[k];
+
+		for (std::uint32_t c = k * perSlice; c < (k + 1u) * perSlice; ++c)
+		{
+			m_ranges[c].Offset += base;
+			m_lastMaxPerCluster = std::max(m_lastMaxPerCluster, m_ranges[c].Count);
+		}
+
+		std::copy(scratch.Indices.begin(), scratch.Indices.end(), m_indices.begin() + base);
+		base		  += static_cast<std::uint32_t>(scratch.Indices.size());
+		m_lastDropped += scratch.Dropped;
+	}
+
+	m_lastMicro = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+	return base;
+}
+
+void LightClusterGrid::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Light Clusters"))
+	{
+		ImGui::BulletText("Grid: %u x %u x %u (%u clusters)", m_countX, m_countY, m_countZ, GetClusterCount());
+		ImGui::BulletText("Lights: %u, Indices: %u", GetLightCount(), static_cast<std::uint32_t>(m_indices.size()));
+		ImGui::BulletText("Busiest Cluster: %u (dropped %u)", m_lastMaxPerCluster, m_lastDropped);
+		ImGui::BulletText("Assign: %.1f us (%s)", m_lastMicro, m_bLastParallel ? "parallel" : "serial");
+	}
+
+	ImGui::PopID();
+}
@@ -0,0 +1,523 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/light_manager.h"
+#include "imgui.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+static inline void Normalize3(DirectX::XMFLOAT3& v)
+{
+	const float x = v.x, y = v.y, z = v.z;
+	const float lenSq = x*x + y*y + z*z;
+	if (lenSq > 1e-8f)
+	{
+		const float invLen = 1.0f / std::sqrt(lenSq);
+		v.x *= invLen; v.y *= invLen; v.z *= invLen;
+	}
+}
+
+static inline void ImGuiEditVec3(const char* label, DirectX::XMFLOAT3& v, float speed, float minV, float maxV)
+{
+	ImGui::DragFloat3(label, &v.x, speed, minV, maxV);
+}
+
+std::uint32_t LightManager::Push(const ELightType type, const LightCPU& light)
+{
+	const auto index = static_cast<std::uint32_t>(m_types.size());
+
+	m_types		   .push_back(type);
+	m_strengths	   .push_back(light.Strength);
+	m_directions   .push_back(light.Direction);
+	m_positions	   .push_back(light.Position);
+	m_falloffStarts.push_back(light.FalloffStart);
+	m_falloffEnds  .push_back(light.FalloffEnd);
+	m_spotPowers   .push_back(light.SpotPower);
+	m_versions	   .push_back(0u);
+
+	Touch(index);
+	return index;
+}
+
+void LightManager::Touch(const std::uint32_t index)
+{
+	m_versions[index] = ++m_version;
+}
+
+std::uint32_t LightManager::AddDirectional(const DirectX::XMFLOAT3 &direction,
+	const DirectX::XMFLOAT3 &strength)
+{
+	LightCPU light{};
+	light.Direction = direction;
+	light.Strength  = strength;
+
+	return Push(ELightType::Directional, light);
+}
+
+std::uint32_t LightManager::AddPoint(const DirectX::XMFLOAT3 &position,
+	const DirectX::XMFLOAT3 &strength,
+	float falloffStart, float falloffEnd)
+{
+	LightCPU light{};
+	light.Position     = position;
+	light.Strength     = strength;
+	light.FalloffStart = falloffStart;
+	light.FalloffEnd   = falloffEnd;
+
+	return Push(ELightType::Point, light);
+}
+
+std::uint32_t LightManager::AddSpot(const DirectX::XMFLOAT3 &position,
+	const DirectX::XMFLOAT3 &direction,
+	const DirectX::XMFLOAT3 &strength, float falloffStart, float falloffEnd,
+	float spotPower)
+{
+	LightCPU light{};
+	light.Position     = position;
+	light.Direction    = direction;
+	light.Strength     = strength;
+	light.FalloffStart = falloffStart;
+	light.FalloffEnd   = falloffEnd;
+	light.SpotPower    = spotPower;
+
+	return Push(ELightType::Spotlight, light);
+}
+
+void LightManager::Remove(const std::uint32_t index)
+{
+	if (index >= m_types.size()) return;
+
+	const std::uint32_t last = TotalLightCount() - 1u;
+	if (index != last)
+	{
+		m_types		   [index] = m_types		[last];
+		m_strengths	   [index] = m_strengths	[last];
+		m_directions   [index] = m_directions	[last];
+		m_positions	   [index] = m_positions	[last];
+		m_falloffStarts[index] = m_falloffStarts[last];
+		m_falloffEnds  [index] = m_falloffEnds	[last];
+		m_spotPowers   [index] = m_spotPowers	[last];
+		Touch(index);
+	}
+
+	m_types		   .pop_back();
+	m_strengths	   .pop_back();
+	m_directions   .pop_back();
+	m_positions	   .pop_back();
+	m_falloffStarts.pop_back();
+	m_falloffEnds  .pop_back();
+	m_spotPowers   .pop_back();
+	m_versions	   .pop_back();
+	++m_version;
+}
+
+void LightManager::Clear()
+{
+	m_types		   .clear();
+	m_strengths	   .clear();
+	m_directions   .clear();
+	m_positions	   .clear();
+	m_falloffStarts.clear();
+	m_falloffEnds  .clear();
+	m_spotPowers   .clear();
+	m_versions	   .clear();
+	++m_version;
+}
+
+std::uint32_t LightManager::TotalLightCount() const
+{
+	return static_cast<std::uint32_t>(m_types.size());
+}
+
+LightCPU LightManager::Get(const std::uint32_t index) const
+{
+	LightCPU light{};
+	light.Strength	   = m_strengths	[index];
+	light.FalloffStart = m_falloffStarts[index];
+	light.Direction	   = m_directions	[index];
+	light.FalloffEnd   = m_falloffEnds	[index];
+	light.Position	   = m_positions	[index];
+	light.SpotPower	   = m_spotPowers	[index];
+	return light;
+}
+
+void LightManager::Set(const std::uint32_t index, const LightCPU& light)
+{
+	m_strengths	   [index] = light.Strength;
+	m_falloffStarts[index] = light.FalloffStart;
+	m_directions   [index] = light.Direction;
+	m_falloffEnds  [index] = light.FalloffEnd;
+	m_positions	   [index] = light.Position;
+	m_spotPowers   [index] = light.SpotPower;
+	Touch(index);
+}
+
+std::uint32_t LightManager::GatherLocal(std::vector<LightCPU>& out) const
+{
+	out.clear();
+
+	for (std::uint32_t i = 0; i < TotalLightCount(); ++i)
+		if (m_types[i] == ELightType::Point) out.push_back(Get(i));
+
+	const auto points = static_cast<std::uint32_t>(out.size());
+
+	for (std::uint32_t i = 0; i < TotalLightCount(); ++i)
+		if (m_types[i] == ELightType::Spotlight) out.push_back(Get(i));
+
+	return points;
+}
+
+float LightManager::Importance(const std::uint32_t index, const DirectX::XMFLOAT3& eye) const
+{
+	const auto& s = m_strengths[index];
+	const float luminance = 0.2126f * s.x + 0.7152f * s.y + 0.0722f * s.z;
+
+	if (m_types[index] == ELightType::Directional)
+		return 1e30f * (1.0f + luminance);
+
+	//~ full strength inside the range, falling off with the square of the distance past it
+	const auto& p = m_positions[index];
+	const float dx = p.x - eye.x, dy = p.y - eye.y, dz = p.z - eye.z;
+	const float distanceSq = dx * dx + dy * dy + dz * dz;
+	const float rangeSq	   = m_falloffEnds[index] * m_falloffEnds[index];
+
+	return luminance * rangeSq / std::max(rangeSq + distanceSq, 1e-6f);
+}
+
+void LightManager::FillPassConstants(PassConstantsCPU &out)
+{
+	const std::uint32_t count = TotalLightCount();
+	const auto& eye = out.EyePositionW;
+
+	//~ the eye only matters when the ranking decides who gets in
+	const bool eyeMoved = count > MaxLights &&
+		(eye.x != m_filledEye.x || eye.y != m_filledEye.y || eye.z != m_filledEye.z);
+
+	if (m_filledTarget == &out && m_filledVersion == m_version && !eyeMoved)
+	{
+		m_lastPatched = 0u;
+		++m_skippedFills;
+		return;
+	}
+
+	if (m_filledTarget != &out)
+	{
+		//~ new target, nothing in it can be trusted
+		std::fill(std::begin(m_slotIds), std::end(m_slotIds), InvalidIndex);
+		for (auto& light : out.Lights) light = {};
+	}
+
+	m_ranked.resize(count);
+	for (std::uint32_t i = 0; i < count; ++i) m_ranked[i] = i;
+
+	if (count > MaxLights)
+	{
+		m_scores.resize(count);
+		for (std::uint32_t i = 0; i < count; ++i) m_scores[i] = Importance(i, eye);
+
+		std::nth_element(m_ranked.begin(), m_ranked.begin() + (MaxLights - 1u), m_ranked.end(),
+			[&](const std::uint32_t a, const std::uint32_t b) { return m_scores[a] > m_scores[b]; });
+		m_ranked.resize(MaxLights);
+	}
+
+	//~ shader reads directionals, then points, then spots. inside a type the index order keeps slots stable
+	std::sort(m_ranked.begin(), m_ranked.end(), [&](const std::uint32_t a, const std::uint32_t b)
+	{
+		return m_types[a] != m_types[b] ? m_types[a] < m_types[b] : a < b;
+	});
+
+	out.NumDirLights   = 0;
+	out.NumPointLights = 0;
+	out.NumSpotLights  = 0;
+	m_lastPatched	   = 0u;
+
+	for (std::uint32_t slot = 0; slot < MaxLights; ++slot)
+	{
+		if (slot >= m_ranked.size())
+		{
+			//~ clear slots that went unused since the last fill
+			if (m_slotIds[slot] != InvalidIndex)
+			{
+				out.Lights[slot] = {};
+				m_slotIds [slot] = InvalidIndex;
+				++m_lastPatched;
+			}
+			continue;
+		}
+
+		const std::uint32_t index = m_ranked[slot];
+		switch (m_types[index])
+		{
+			case ELightType::Directional: ++out.NumDirLights;	break;
+			case ELightType::Point:		  ++out.NumPointLights; break;
+			case ELightType::Spotlight:	  ++out.NumSpotLights;	break;
+		}
+
+		if (m_slotIds[slot] == index && m_slotVersions[slot] == m_versions[index]) continue;
+
+		out.Lights	   [slot] = Get(index);
+		m_slotIds	   [slot] = index;
+		m_slotVersions [slot] = m_versions[index];
+		++m_lastPatched;
+	}
+
+	m_filledTarget	= &out;
+	m_filledVersion = m_version;
+	m_filledEye		= eye;
+}
+
+void LightManager::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (!ImGui::CollapsingHeader("Light Manager", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::PopID();
+		return;
+	}
+
+	ImGui::Indent();
+
+	ImGui::Text("Total: %u (Packed Max: %u)", TotalLightCount(), MaxLights);
+	ImGui::Text("Version: %llu, Slots Patched: %u, Fills Skipped: %u",
+		static_cast<unsigned long long>(m_version), m_lastPatched, m_skippedFills);
+
+	// Add buttons
+	if (ImGui::Button("+ Directional"))
+	{
+		AddDirectional({ 0.0f, -1.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("+ Point"))
+	{
+		AddPoint({ 0.0f, 2.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, 1.0f, 10.0f);
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("+ Spot"))
+	{
+		AddSpot({ 0.0f, 2.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, 1.0f, 15.0f, 64.0f);
+	}
+
+	ImGui::Separator();
+
+	auto DrawList = [&](const char* title, const ELightType type)
+	{
+		std::uint32_t count = 0u;
+		for (const ELightType t : m_types) count += t == type ? 1u : 0u;
+
+		std::string header = std::string(title) + " (" + std::to_string(count) + ")";
+		if (!ImGui::CollapsingHeader(header.c_str(), ImGuiTreeNodeFlags_DefaultOpen))
+			return;
+
+		ImGui::Indent();
+
+		int shown = 0;
+		for (std::uint32_t index = 0; index < TotalLightCount(); ++index)
+		{
+			if (m_types[index] != type) continue;
+
+			ImGui::PushID(static_cast<int>(index));
+
+			char label[64]{};
+			std::snprintf(label, sizeof(label), "%s %d", title, shown++);
+
+			if (ImGui::TreeNodeEx(label, ImGuiTreeNodeFlags_DefaultOpen))
+			{
+				const LightCPU before = Get(index);
+				LightCPU l = before;
+
+				ImGuiEditVec3("Strength", l.Strength, 0.01f, 0.0f, 10000.0f);
+
+				if (type == ELightType::Directional || type == ELightType::Spotlight)
+				{
+					ImGuiEditVec3("Direction", l.Direction, 0.01f, -1.0f, 1.0f);
+					ImGui::SameLine();
+					if (ImGui::Button("Normalize##Dir"))
+						Normalize3(l.Direction);
+				}
+
+				if (type == ELightType::Point || type == ELightType::Spotlight)
+				{
+					ImGuiEditVec3("Position", l.Position, 0.05f, -100000.0f, 100000.0f);
+
+					ImGui::DragFloat("FalloffStart", &l.FalloffStart, 0.05f, 0.0f, 100000.0f);
+					ImGui::DragFloat("FalloffEnd",   &l.FalloffEnd,   0.05f, 0.0f, 100000.0f);
+
+					if (l.FalloffEnd < l.FalloffStart)
+						l.FalloffEnd = l.FalloffStart;
+				}
+
+				if (type == ELightType::Spotlight)
+				{
+					ImGui::DragFloat("SpotPower", &l.SpotPower, 1.0f, 1.0f, 512.0f);
+				}
+
+				//~ untouched lights keep their version
+				if (std::memcmp(&before, &l, sizeof(LightCPU)) != 0)
+					Set(index, l);
+
+				ImGui::Separator();
+
+				if (ImGui::Button("Remove"))
+				{
+					Remove(index);
+					ImGui::TreePop();
+					ImGui::PopID();
+					break;
+				}
+
+				ImGui::TreePop();
+			}
+
+			ImGui::PopID();
+		}
+
+		ImGui::Unindent();
+	};
+
+	DrawList("Directional", ELightType::Directional);
+	DrawList("Point",       ELightType::Point);
+	DrawList("Spotlight",   ELightType::Spotlight);
+
+	ImGui::Unindent();
+	ImGui::PopID();
+}
+
+JsonLoader LightManager::GetJsonData() const
+{
+	JsonLoader saver{};
+
+	auto WriteVec3 = [&](JsonLoader& node, const char* k, const DirectX::XMFLOAT3& v)
+	{
+		node[k]["X"] = v.x;
+		node[k]["Y"] = v.y;
+		node[k]["Z"] = v.z;
+	};
+
+	auto WriteLight = [&](JsonLoader& node, const LightCPU& l)
+	{
+		WriteVec3(node, "Strength",  l.Strength);
+		node["FalloffStart"] = l.FalloffStart;
+
+		WriteVec3(node, "Direction", l.Direction);
+		node["FalloffEnd"] = l.FalloffEnd;
+
+		WriteVec3(node, "Position",  l.Position);
+		node["SpotPower"] = l.SpotPower;
+	};
+
+	auto WriteList = [&](const char* listKey, const ELightType type)
+	{
+		auto& root = saver["Lights"][listKey];
+
+		int count = 0;
+		for (std::uint32_t i = 0; i < TotalLightCount(); ++i)
+		{
+			if (m_types[i] != type) continue;
+
+			const std::string itemKey = "Item_" + std::to_string(count++);
+			auto& n = root[itemKey];
+			WriteLight(n, Get(i));
+		}
+
+		root["Count"] = count;
+	};
+
+	WriteList("Directional", ELightType::Directional);
+	WriteList("Point",       ELightType::Point);
+	WriteList("Spot",        ELightType::Spotlight);
+
+	return saver;
+}
+
+void LightManager::LoadJsonData(const JsonLoader& data)
+{
+	auto ReadVec3 = [](const JsonLoader& node, const char* key, const DirectX::XMFLOAT3& def) -> DirectX::XMFLOAT3
+	{
+		if (!node.Has(key)) return def;
+
+		const auto& v = node[key];
+		if (!v.Has("X") || !v.Has("Y") || !v.Has("Z")) return def;
+
+		return DirectX::XMFLOAT3(
+			v["X"].AsFloat(def.x),
+			v["Y"].AsFloat(def.y),
+			v["Z"].AsFloat(def.z)
+		);
+	};
+
+	auto ReadLight = [&](const JsonLoader& node) -> LightCPU
+	{
+		LightCPU l{};
+
+		l.Strength     = ReadVec3(node, "Strength",  DirectX::XMFLOAT3(1.f, 1.f, 1.f));
+		l.FalloffStart = node.Has("FalloffStart") ? node["FalloffStart"].AsFloat(0.0f) : 0.0f;
+
+		l.Direction    = ReadVec3(node, "Direction", DirectX::XMFLOAT3(0.f, -1.f, 0.f));
+		l.FalloffEnd   = node.Has("FalloffEnd") ? node["FalloffEnd"].AsFloat(0.0f) : 0.0f;
+
+		l.Position     = ReadVec3(node, "Position",  DirectX::XMFLOAT3(0.f, 0.f, 0.f));
+		l.SpotPower    = node.Has("SpotPower") ? node["SpotPower"].AsFloat(64.0f) : 64.0f;
+
+		return l;
+	};
+
+	auto ReadList = [&](const char* listKey, const ELightType type)
+	{
+		if (!data.Has("Lights")) return;
+		const auto& lightsRoot = data["Lights"];
+
+		if (!lightsRoot.Has(listKey)) return;
+		const auto& root = lightsRoot[listKey];
+
+		const int count = root.Has("Count") ? root["Count"].AsInt(0) : 0;
+		if (count <= 0) return;
+
+		for (int i = 0; i < count; ++i)
+		{
+			const std::string itemKey = "Item_" + std::to_string(i);
+			if (!root.Has(itemKey)) continue;
+
+			Push(type, ReadLight(root[itemKey]));
+		}
+	};
+
+	Clear();
+	ReadList("Directional", ELightType::Directional);
+	ReadList("Point",       ELightType::Point);
+	ReadList("Spot",        ELightType::Spotlight);
+}
@@ -0,0 +1,133 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/13/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/linear_allocator.h"
+
+#include <algorithm>
+
+using namespace framework;
+
+namespace
+{
+	constexpr std::uint64_t AlignUp(const std::uint64_t value, const std::uint64_t alignment)
+	{
+		return (value + alignment - 1u) & ~(alignment - 1u);
+	}
+}
+
+void LinearAllocatorCore::Initialize(const std::uint64_t capacity)
+{
+	m_capacity	 = capacity;
+	m_head		 = 0u;
+	m_tail		 = 0u;
+	m_used		 = 0u;
+	m_frameBytes = 0u;
+	m_peak		 = 0u;
+	m_wraps		 = 0u;
+	m_frames.clear();
+}
+
+std::uint64_t LinearAllocatorCore::Allocate(const std::uint64_t size, std::uint64_t alignment)
+{
+	if (size == 0u || size > m_capacity) return InvalidOffset;
+	alignment = std::max<std::uint64_t>(alignment, 1u);
+
+	//~ nothing alive, start over at the front to keep big blocks possible. not a wrap
+	if (m_used == 0u)
+	{
+		m_head = 0u;
+		m_tail = 0u;
+	}
+
+	std::uint64_t offset = InvalidOffset;
+	std::uint64_t consumed = 0u;
+
+	const std::uint64_t aligned = AlignUp(m_head, alignment);
+	if (m_head >= m_tail && !(m_used > 0u && m_head == m_tail))
+	{
+		//~ free space is [head, capacity) and [0, tail)
+		if (aligned + size <= m_capacity)
+		{
+			offset	 = aligned;
+			consumed = aligned + size - m_head;
+		}
+		else if (size <= m_tail)
+		{
+			//~ skip the end of the ring, the padding retires with this frame
+			offset	 = 0u;
+			consumed = (m_capacity - m_head) + size;
+			++m_wraps;
+		}
+	}
+	else if (m_head < m_tail && aligned + size <= m_tail)
+	{
+		//~ wrapped, free space is [head, tail)
+		offset	 = aligned;
+		consumed = aligned + size - m_head;
+	}
+
+	if (offset == InvalidOffset) return InvalidOffset;
+
+	m_head = offset + size;
+	if (m_head == m_capacity)
+	{
+		//~ ended flush with the ring, the next allocation starts over at the front
+		m_head = 0u;
+		++m_wraps;
+	}
+
+	m_used		 += consumed;
+	m_frameBytes += consumed;
+	m_peak		  = std::max(m_peak, m_used);
+	return offset;
+}
+
+void LinearAllocatorCore::FinishFrame(const std::uint64_t fenceValue)
+{
+	if (m_frameBytes == 0u) return;
+
+	m_frames.push_back({ fenceValue, m_head, m_frameBytes });
+	m_frameBytes = 0u;
+}
+
+void LinearAllocatorCore::Reclaim(const std::uint64_t completedFenceValue)
+{
+	while (!m_frames.empty() && m_frames.front().FenceValue <= completedFenceValue)
+	{
+		const auto& frame = m_frames.front();
+		m_tail = frame.End;
+		m_used -= frame.Bytes;
+		m_frames.pop_front();
+	}
+}
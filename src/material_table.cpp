@@ -0,0 +1,167 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/material_table.h"
+
+#include "framework/exception/base_exception.h"
+#include "framework/exception/dx_exception.h"
+
+#include <cstring>
+
+#include "imgui.h"
+
+using namespace framework;
+
+MaterialTable::~MaterialTable()
+{
+	if (m_buffer && m_mapped)
+	{
+		m_buffer->Unmap(0u, nullptr);
+		m_mapped = nullptr;
+	}
+}
+
+void MaterialTable::Initialize(ID3D12Device* device, const std::uint32_t frameCount, const std::uint32_t capacity)
+{
+	if (frameCount == 0u || capacity == 0u)
+	{
+		THROW_MSG("Material table needs at least one frame and one material!");
+	}
+
+	m_frameCount = frameCount;
+	m_capacity	 = capacity;
+	m_frameIndex = 0u;
+	Clear();
+
+	D3D12_RESOURCE_DESC resource{};
+	resource.Flags				= D3D12_RESOURCE_FLAG_NONE;
+	resource.Format				= DXGI_FORMAT_UNKNOWN;
+	resource.Alignment			= 0u;
+	resource.DepthOrArraySize	= 1u;
+	resource.Dimension			= D3D12_RESOURCE_DIMENSION_BUFFER;
+	resource.Height				= 1u;
+	resource.Layout				= D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	resource.MipLevels			= 1u;
+	resource.SampleDesc.Count	= 1u;
+	resource.SampleDesc.Quality = 0u;
+	resource.Width				= static_cast<std::uint64_t>(Stride) * capacity * frameCount;
+
+	D3D12_HEAP_PROPERTIES property{};
+	property.Type				  = D3D12_HEAP_TYPE_UPLOAD;
+	property.CPUPageProperty	  = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	property.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+	property.CreationNodeMask	  = 1u;
+	property.VisibleNodeMask	  = 1u;
+
+	THROW_DX_IF_FAILS(device->CreateCommittedResource(
+		&property, D3D12_HEAP_FLAG_NONE,
+		&resource, D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr, IID_PPV_ARGS(&m_buffer)));
+
+	THROW_DX_IF_FAILS(m_buffer->Map(
+		0u, nullptr,
+		reinterpret_cast<void**>(&m_mapped)));
+
+	m_gpuBase = m_buffer->GetGPUVirtualAddress();
+}
+
+std::uint32_t MaterialTable::Add(Material& material)
+{
+	if (m_sources.size() >= m_capacity)
+	{
+		THROW_MSG("Material table is full!");
+	}
+
+	const auto index = static_cast<std::uint32_t>(m_sources.size());
+	m_sources.push_back(&material.Config);
+	m_shadow .push_back(material.Config);
+	m_pending.push_back(static_cast<std::uint8_t>(m_frameCount));
+
+	material.TableIndex = index;
+	return index;
+}
+
+void MaterialTable::Clear()
+{
+	m_sources.clear();
+	m_shadow .clear();
+	m_pending.clear();
+	m_uploaded = 0u;
+}
+
+void MaterialTable::BeginFrame(const std::uint32_t frameIndex)
+{
+	m_frameIndex = frameIndex % m_frameCount;
+}
+
+void MaterialTable::Flush()
+{
+	BYTE* region = m_mapped + static_cast<std::uint64_t>(m_frameIndex) * m_capacity * Stride;
+	m_uploaded = 0u;
+
+	for (std::size_t i = 0; i < m_sources.size(); ++i)
+	{
+		//~ the shadow lives in cached memory, comparing there keeps reads off the upload heap
+		if (std::memcmp(m_sources[i], &m_shadow[i], Stride) != 0)
+		{
+			m_shadow [i] = *m_sources[i];
+			m_pending[i] = static_cast<std::uint8_t>(m_frameCount);
+		}
+
+		if (m_pending[i] == 0u) continue;
+
+		std::memcpy(region + i * Stride, &m_shadow[i], Stride);
+		--m_pending[i];
+		++m_uploaded;
+	}
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS MaterialTable::GetAddress() const
+{
+	return m_gpuBase + static_cast<std::uint64_t>(m_frameIndex) * m_capacity * Stride;
+}
+
+void MaterialTable::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Material Table"))
+	{
+		ImGui::BulletText("Materials: %u / %u (x%u frames)", GetCount(), m_capacity, m_frameCount);
+		ImGui::BulletText("Uploaded This Frame: %u", m_uploaded);
+		ImGui::BulletText("Region Size: %.1f KB", static_cast<double>(m_capacity) * Stride / 1024.0);
+	}
+
+	ImGui::PopID();
+}
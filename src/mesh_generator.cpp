@@ -784,6 +784,52 @@ void MeshGenerator::ComputeNormals(MeshData& mesh, const bool flip)
     }
 }
 
+void MeshGenerator::ComputeGridNormals(
+    MeshData& mesh,
+    const uint32_t columns,
+    const uint32_t firstRow,
+    const uint32_t rowCount)
+{
+    if (columns < 2 || mesh.vertices.size() < static_cast<size_t>(columns) * 2)
+        return;
+
+    const uint32_t rows = static_cast<uint32_t>(mesh.vertices.size() / columns);
+    const uint32_t last = std::min(firstRow + rowCount, rows);
+
+    auto& v = mesh.vertices;
+    auto at = [&](const uint32_t x, const uint32_t z) -> const XMFLOAT3&
+    {
+        return v[static_cast<size_t>(z) * columns + x].Position;
+    };
+
+    // central differences, one sided on the borders
+    for (uint32_t z = firstRow; z < last; ++z)
+    {
+        const uint32_t z0 = z > 0 ? z - 1 : z;
+        const uint32_t z1 = z + 1 < rows ? z + 1 : z;
+
+        for (uint32_t x = 0; x < columns; ++x)
+        {
+            const uint32_t x0 = x > 0 ? x - 1 : x;
+            const uint32_t x1 = x + 1 < columns ? x + 1 : x;
+
+            const XMFLOAT3& l = at(x0, z);
+            const XMFLOAT3& r = at(x1, z);
+            const XMFLOAT3& d = at(x, z0);
+            const XMFLOAT3& u = at(x, z1);
+
+            const XMVECTOR tx = XMVectorSet(r.x - l.x, r.y - l.y, r.z - l.z, 0.f);
+            const XMVECTOR tz = XMVectorSet(u.x - d.x, u.y - d.y, u.z - d.z, 0.f);
+
+            XMVECTOR n = XMVector3Cross(tz, tx);
+            if (XMVectorGetX(XMVector3LengthSq(n)) < 1e-12f)
+                n = XMVectorSet(0.f, 1.f, 0.f, 0.f);
+
+            XMStoreFloat3(&v[static_cast<size_t>(z) * columns + x].Normal, XMVector3Normalize(n));
+        }
+    }
+}
+
 void MeshGenerator::ComputeTangents(MeshData& mesh, bool flip)
 {
     auto& v = mesh.vertices;
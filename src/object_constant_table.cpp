@@ -0,0 +1,144 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/14/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/object_constant_table.h"
+
+#include "framework/exception/base_exception.h"
+#include "framework/exception/dx_exception.h"
+
+#include "imgui.h"
+
+using namespace framework;
+
+ObjectConstantTable::~ObjectConstantTable()
+{
+	if (m_buffer && m_mapped)
+	{
+		m_buffer->Unmap(0u, nullptr);
+		m_mapped = nullptr;
+	}
+}
+
+void ObjectConstantTable::Initialize(ID3D12Device *device, const std::uint32_t frameCount, const std::uint32_t capacity)
+{
+	if (frameCount == 0u || capacity == 0u)
+	{
+		THROW_MSG("Object constant table needs at least one frame and one slot!");
+	}
+
+	m_frameCount = frameCount;
+	m_capacity	 = capacity;
+	m_slotCount	 = 0u;
+	m_frameIndex = 0u;
+
+	D3D12_RESOURCE_DESC resource{};
+	resource.Flags				= D3D12_RESOURCE_FLAG_NONE;
+	resource.Format				= DXGI_FORMAT_UNKNOWN;
+	resource.Alignment			= 0u;
+	resource.DepthOrArraySize	= 1u;
+	resource.Dimension			= D3D12_RESOURCE_DIMENSION_BUFFER;
+	resource.Height				= 1u;
+	resource.Layout				= D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	resource.MipLevels			= 1u;
+	resource.SampleDesc.Count	= 1u;
+	resource.SampleDesc.Quality = 0u;
+	resource.Width				= static_cast<std::uint64_t>(SlotSize) * capacity * frameCount;
+
+	D3D12_HEAP_PROPERTIES property{};
+	property.Type				  = D3D12_HEAP_TYPE_UPLOAD;
+	property.CPUPageProperty	  = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	property.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+	property.CreationNodeMask	  = 1u;
+	property.VisibleNodeMask	  = 1u;
+
+	THROW_DX_IF_FAILS(device->CreateCommittedResource(
+		&property, D3D12_HEAP_FLAG_NONE,
+		&resource, D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr, IID_PPV_ARGS(&m_buffer)));
+
+	THROW_DX_IF_FAILS(m_buffer->Map(
+		0u, nullptr,
+		reinterpret_cast<void**>(&m_mapped)));
+
+	m_gpuBase = m_buffer->GetGPUVirtualAddress();
+}
+
+void ObjectConstantTable::BeginFrame(const std::uint32_t frameIndex)
+{
+	m_frameIndex = frameIndex % m_frameCount;
+}
+
+BYTE* ObjectConstantTable::GetFrameData(const std::uint32_t slotCount)
+{
+	if (slotCount > m_capacity)
+	{
+		THROW_MSG("Object constant table is full!");
+	}
+
+	m_slotCount = slotCount;
+	return m_mapped + static_cast<std::uint64_t>(m_frameIndex) * m_capacity * SlotSize;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS ObjectConstantTable::GetAddress(const std::uint32_t slot) const
+{
+	const std::uint64_t index = static_cast<std::uint64_t>(m_frameIndex) * m_capacity + slot;
+	return m_gpuBase + index * SlotSize;
+}
+
+BYTE* ObjectConstantTable::GetMapped(const std::uint32_t slot) const
+{
+	const std::uint64_t index = static_cast<std::uint64_t>(m_frameIndex) * m_capacity + slot;
+	return m_mapped + index * SlotSize;
+}
+
+void ObjectConstantTable::CheckRange(const std::uint32_t offset, const std::size_t size) const
+{
+	if (offset > SlotSize || size > SlotSize - offset)
+	{
+		THROW_MSG("Object constant write runs past the end of its slot!");
+	}
+}
+
+void ObjectConstantTable::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Object Constants"))
+	{
+		ImGui::BulletText("Slots: %u / %u (x%u frames)", m_slotCount, m_capacity, m_frameCount);
+		ImGui::BulletText("Region Size: %.1f KB", static_cast<double>(m_capacity) * SlotSize / 1024.0);
+	}
+
+	ImGui::PopID();
+}
@@ -0,0 +1,325 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/object_light_lists.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/light_cluster_grid.h"
+#include "framework/render_manager/components/light_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "imgui.h"
+
+using namespace framework;
+using namespace DirectX;
+
+void ObjectLightLists::SetLights(const std::span<const LightCPU> lights, const std::uint32_t pointCount)
+{
+	const size_t count	= lights.size();
+	const size_t padded = (count + 3u) & ~size_t{ 3u };
+
+	for (auto* v : { &m_x, &m_y, &m_z, &m_radius, &m_dirX, &m_dirY, &m_dirZ, &m_cos, &m_sin,
+					 &m_luminance, &m_falloffStart, &m_spotPower })
+	{
+		v->assign(padded, 0.0f);
+	}
+	m_lightIds.resize(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const LightCPU& light = lights[i];
+
+		m_x[i]			  = light.Position.x;
+		m_y[i]			  = light.Position.y;
+		m_z[i]			  = light.Position.z;
+		m_radius[i]		  = std::max(light.FalloffEnd, 0.0f);
+		m_falloffStart[i] = std::min(light.FalloffStart, m_radius[i]);
+		m_luminance[i]	  = 0.2126f * light.Strength.x + 0.7152f * light.Strength.y + 0.0722f * light.Strength.z;
+		m_lightIds[i]	  = static_cast<std::uint32_t>(i);
+
+		//~ points keep a zero direction and cos -1, the cone test then always passes
+		m_cos[i] = -1.0f;
+
+		const float length = std::sqrt(light.Direction.x * light.Direction.x +
+									   light.Direction.y * light.Direction.y +
+									   light.Direction.z * light.Direction.z);
+
+		if (i < pointCount || light.SpotPower <= 0.0f || length <= 0.0f) continue;
+
+		//~ same cutoff as the cluster grid, past it the shader's spot factor is dark
+		const float cosine = std::pow(LightClusterGrid::SpotCutoff, 1.0f / std::max(light.SpotPower, 1.0f));
+
+		m_dirX[i]	   = light.Direction.x / length;
+		m_dirY[i]	   = light.Direction.y / length;
+		m_dirZ[i]	   = light.Direction.z / length;
+		m_cos[i]	   = cosine;
+		m_sin[i]	   = std::sqrt(std::max(1.0f - cosine * cosine, 0.0f));
+		m_spotPower[i] = light.SpotPower;
+	}
+}
+
+void ObjectLightLists::ClearObjects()
+{
+	m_centers.clear();
+	m_extents.clear();
+}
+
+std::uint32_t ObjectLightLists::AddObject(const XMFLOAT3& center, const XMFLOAT3& extents)
+{
+	const auto index = static_cast<std::uint32_t>(m_centers.size());
+	m_centers.push_back(center);
+	m_extents.push_back(extents);
+	return index;
+}
+
+void ObjectLightLists::Filter(const std::uint32_t index, std::vector<std::uint32_t>& hits) const
+{
+	const size_t count	= m_lightIds.size();
+	const size_t padded = (count + 3u) & ~size_t{ 3u };
+
+	hits.resize(padded);
+	std::uint32_t found = 0u;
+
+	const XMFLOAT3& c = m_centers[index];
+	const XMFLOAT3& e = m_extents[index];
+
+	const XMVECTOR minX = XMVectorReplicate(c.x - e.x), maxX = XMVectorReplicate(c.x + e.x);
+	const XMVECTOR minY = XMVectorReplicate(c.y - e.y), maxY = XMVectorReplicate(c.y + e.y);
+	const XMVECTOR minZ = XMVectorReplicate(c.z - e.z), maxZ = XMVectorReplicate(c.z + e.z);
+
+	//~ bounding sphere of the box for the cone test
+	const XMVECTOR sphereX	  = XMVectorReplicate(c.x);
+	const XMVECTOR sphereY	  = XMVectorReplicate(c.y);
+	const XMVECTOR sphereZ	  = XMVectorReplicate(c.z);
+	const XMVECTOR sphereR	  = XMVectorReplicate(std::sqrt(e.x * e.x + e.y * e.y + e.z * e.z));
+	const XMVECTOR negSphereR = XMVectorNegate(sphereR);
+
+	const XMVECTOR zero = XMVectorZero();
+	const auto load = [](const std::vector<float>& v, const size_t i)
+	{
+		return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&v[i]));
+	};
+
+	for (size_t i = 0; i < padded; i += 4u)
+	{
+		const XMVECTOR px = load(m_x, i);
+		const XMVECTOR py = load(m_y, i);
+		const XMVECTOR pz = load(m_z, i);
+		const XMVECTOR r  = load(m_radius, i);
+
+		//~ sphere against box
+		const XMVECTOR ex = XMVectorMax(XMVectorMax(XMVectorSubtract(minX, px), XMVectorSubtract(px, maxX)), zero);
+		const XMVECTOR ey = XMVectorMax(XMVectorMax(XMVectorSubtract(minY, py), XMVectorSubtract(py, maxY)), zero);
+		const XMVECTOR ez = XMVectorMax(XMVectorMax(XMVectorSubtract(minZ, pz), XMVectorSubtract(pz, maxZ)), zero);
+
+		XMVECTOR distance = XMVectorMultiply(ex, ex);
+		distance = XMVectorMultiplyAdd(ey, ey, distance);
+		distance = XMVectorMultiplyAdd(ez, ez, distance);
+
+		XMVECTOR keep = XMVectorLessOrEqual(distance, XMVectorMultiply(r, r));
+
+		//~ cone against the box sphere
+		const XMVECTOR vx = XMVectorSubtract(sphereX, px);
+		const XMVECTOR vy = XMVectorSubtract(sphereY, py);
+		const XMVECTOR vz = XMVectorSubtract(sphereZ, pz);
+
+		XMVECTOR lengthSq = XMVectorMultiply(vx, vx);
+		lengthSq = XMVectorMultiplyAdd(vy, vy, lengthSq);
+		lengthSq = XMVectorMultiplyAdd(vz, vz, lengthSq);
+
+		XMVECTOR along = XMVectorMultiply(vx, load(m_dirX, i));
+		along = XMVectorMultiplyAdd(vy, load(m_dirY, i), along);
+		along = XMVectorMultiplyAdd(vz, load(m_dirZ, i), along);
+
+		const XMVECTOR across = XMVectorSqrt(XMVectorMax(XMVectorSubtract(lengthSq, XMVectorMultiply(along, along)), zero));
+		const XMVECTOR side	  = XMVectorSubtract(XMVectorMultiply(load(m_cos, i), across),
+												 XMVectorMultiply(along, load(m_sin, i)));
+
+		keep = XMVectorAndInt(keep, XMVectorLessOrEqual(side, sphereR));
+		keep = XMVectorAndInt(keep, XMVectorLessOrEqual(along, XMVectorAdd(sphereR, r)));
+		keep = XMVectorAndInt(keep, XMVectorGreaterOrEqual(along, negSphereR));
+
+		XMUINT4 mask;
+		XMStoreUInt4(&mask, keep);
+		const std::uint32_t lanes[4] = { mask.x, mask.y, mask.z, mask.w };
+
+		const size_t valid = std::min<size_t>(4u, count - i);
+		for (size_t k = 0; k < valid; ++k)
+		{
+			hits[found] = static_cast<std::uint32_t>(i + k);
+			found += lanes[k] != 0u ? 1u : 0u;
+		}
+	}
+
+	hits.resize(found);
+}
+
+float ObjectLightLists::Score(const std::uint32_t light, const std::uint32_t index) const
+{
+	const XMFLOAT3& c = m_centers[index];
+	const XMFLOAT3& e = m_extents[index];
+
+	//~ nearest point of the box, so a big object next to a light isn't judged by its far center
+	const float dx = std::max(std::abs(m_x[light] - c.x) - e.x, 0.0f);
+	const float dy = std::max(std::abs(m_y[light] - c.y) - e.y, 0.0f);
+	const float dz = std::max(std::abs(m_z[light] - c.z) - e.z, 0.0f);
+	const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+	//~ the shader's linear falloff
+	const float start = m_falloffStart[light];
+	const float end	  = m_radius[light];
+	const float falloff = end > start ? std::clamp((end - distance) / (end - start), 0.0f, 1.0f)
+									  : (distance <= end ? 1.0f : 0.0f);
+
+	float spot = 1.0f;
+	if (m_spotPower[light] > 0.0f)
+	{
+		//~ toward the box center, floored at the cutoff since the cone test already let the box in
+		const float tx = c.x - m_x[light];
+		const float ty = c.y - m_y[light];
+		const float tz = c.z - m_z[light];
+		const float length = std::sqrt(tx * tx + ty * ty + tz * tz);
+
+		if (length > 0.0f)
+		{
+			const float cosine = (tx * m_dirX[light] + ty * m_dirY[light] + tz * m_dirZ[light]) / length;
+			spot = std::pow(std::max(cosine, 0.0f), m_spotPower[light]);
+		}
+		spot = std::max(spot, LightClusterGrid::SpotCutoff);
+	}
+
+	//~ a tiny floor keeps touching lights ordered by brightness even at the edge of their range
+	return m_luminance[light] * std::max(falloff * spot, 1e-6f);
+}
+
+void ObjectLightLists::BuildOne(const std::uint32_t index, Scratch& scratch)
+{
+	ObjectLightList& list = m_lists[index];
+	list.Count = 0u;
+
+	if (m_lightIds.empty()) return;
+
+	Filter(index, scratch.Hits);
+	scratch.Candidates += static_cast<std::uint32_t>(scratch.Hits.size());
+
+	//~ insertion into a short sorted list, hits come in id order so ties keep the lower id
+	float scores[ObjectLightList::MaxLights]{};
+
+	for (const std::uint32_t hit : scratch.Hits)
+	{
+		const float score = Score(hit, index);
+
+		std::uint32_t slot = list.Count;
+		while (slot > 0u && scores[slot - 1u] < score) --slot;
+
+		if (slot >= ObjectLightList::MaxLights) continue;
+
+		const std::uint32_t last = std::min(list.Count, ObjectLightList::MaxLights - 1u);
+		for (std::uint32_t k = last; k > slot; --k)
+		{
+			scores[k]		= scores[k - 1u];
+			list.Indices[k] = list.Indices[k - 1u];
+		}
+
+		scores[slot]	   = score;
+		list.Indices[slot] = m_lightIds[hit];
+		list.Count		   = std::min(list.Count + 1u, ObjectLightList::MaxLights);
+	}
+}
+
+void ObjectLightLists::BuildRange(const std::uint32_t begin, const std::uint32_t end, Scratch& scratch)
+{
+	for (std::uint32_t i = begin; i < end; ++i) BuildOne(i, scratch);
+}
+
+std::uint32_t ObjectLightLists::Build()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	const auto count = static_cast<std::uint32_t>(m_centers.size());
+	m_lists.resize(count);
+
+	//~ one scratch per chunk, ParallelFor hands out chunks of exactly the grain
+	const std::uint32_t chunks = std::max((count + ParallelGrain - 1u) / ParallelGrain, 1u);
+	m_scratch.resize(std::max<size_t>(m_scratch.size(), chunks));
+	for (auto& scratch : m_scratch) scratch.Candidates = 0u;
+
+	m_bLastParallel = m_jobs && m_jobs->IsInitialized() && m_jobs->GetWorkerCount() > 0u
+					  && count >= ParallelThreshold && !m_lightIds.empty();
+
+	if (m_bLastParallel)
+	{
+		m_jobs->ParallelFor(count, ParallelGrain, [this](const std::uint32_t begin, const std::uint32_t end)
+		{
+			BuildRange(begin, end, m_scratch[begin / ParallelGrain]);
+		});
+	}
+	else
+	{
+		BuildRange(0u, count, m_scratch[0]);
+	}
+
+	m_lastPicked	 = 0u;
+	m_lastCandidates = 0u;
+	m_lastFull		 = 0u;
+
+	for (const auto& list : m_lists)
+	{
+		m_lastPicked += list.Count;
+		m_lastFull	 += list.Count == ObjectLightList::MaxLights ? 1u : 0u;
+	}
+	for (const auto& scratch : m_scratch) m_lastCandidates += scratch.Candidates;
+
+	m_lastMicro = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+	return m_lastPicked;
+}
+
+void ObjectLightLists::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Per Object Lights"))
+	{
+		ImGui::BulletText("Objects: %u, Local Lights: %u", GetObjectCount(), GetLightCount());
+		ImGui::BulletText("Touching: %u, Picked: %u (max %u each)", m_lastCandidates, m_lastPicked, ObjectLightList::MaxLights);
+		ImGui::BulletText("Objects At Cap: %u", m_lastFull);
+		ImGui::BulletText("Build: %.1f us (%s)", m_lastMicro, m_bLastParallel ? "parallel" : "serial");
+	}
+
+	ImGui::PopID();
+}
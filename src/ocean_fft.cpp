@@ -0,0 +1,384 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/11/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/ocean_fft.h"
+#include "framework/jobs/job_system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "imgui.h"
+
+using namespace framework;
+
+namespace
+{
+	constexpr float kGravity = 9.81f;
+	constexpr float kPi		 = std::numbers::pi_v<float>;
+}
+
+void OceanFFT::Initialize(const OceanFFTConfig &config)
+{
+	m_config = config;
+
+	//~ round down to a power of two in [8, 512]
+	std::uint32_t n = std::clamp(m_config.Size, 8u, 512u);
+	m_log2N = 0u;
+	while ((2u << m_log2N) <= n) ++m_log2N;
+	m_config.Size = n = 1u << m_log2N;
+	m_config.PatchLength = std::max(m_config.PatchLength, 0.01f);
+
+	const size_t cells = static_cast<size_t>(n) * n;
+	m_h0		.assign(cells, Complex{});
+	m_h0Conj	.assign(cells, Complex{});
+	m_omega		.assign(cells, 0.0f);
+	m_kx		.assign(cells, 0.0f);
+	m_kz		.assign(cells, 0.0f);
+	m_spectrumH .assign(cells, Complex{});
+	m_spectrumDx.assign(cells, Complex{});
+	m_spectrumDz.assign(cells, Complex{});
+	m_height	.assign(cells, 0.0f);
+	m_dispX		.assign(cells, 0.0f);
+	m_dispZ		.assign(cells, 0.0f);
+
+	//~ fft tables
+	m_bitReverse.resize(n);
+	for (std::uint32_t i = 0; i < n; ++i)
+	{
+		std::uint32_t r = 0u;
+		for (std::uint32_t b = 0; b < m_log2N; ++b)
+			r |= ((i >> b) & 1u) << (m_log2N - 1u - b);
+		m_bitReverse[i] = r;
+	}
+
+	m_twiddles.resize(n / 2u);
+	for (std::uint32_t i = 0; i < n / 2u; ++i)
+	{
+		const float a = 2.0f * kPi * static_cast<float>(i) / static_cast<float>(n);
+		m_twiddles[i] = Complex(std::cos(a), std::sin(a)); // +i for the inverse transform
+	}
+
+	//~ initial spectrum, k index i maps to (i - N/2) * 2pi / L
+	std::mt19937 rng(m_config.Seed);
+	std::normal_distribution<float> gauss(0.0f, 1.0f);
+
+	const float dk	 = 2.0f * kPi / m_config.PatchLength;
+	const int	half = static_cast<int>(n / 2u);
+	double energy	 = 0.0;
+
+	std::vector<Complex> h0(cells);
+	for (std::uint32_t m = 0; m < n; ++m)
+	{
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			const float kx = static_cast<float>(static_cast<int>(i) - half) * dk;
+			const float kz = static_cast<float>(static_cast<int>(m) - half) * dk;
+			const float amp = std::sqrt(EvaluateSpectrum(kx, kz) * 0.5f);
+
+			const size_t idx = static_cast<size_t>(m) * n + i;
+			h0[idx] = Complex(gauss(rng) * amp, gauss(rng) * amp);
+			energy += 2.0 * std::norm(h0[idx]);
+
+			const float k = std::sqrt(kx * kx + kz * kz);
+			m_omega[idx]  = std::sqrt(kGravity * k);
+			m_kx[idx]	  = k > 1e-6f ? kx / k : 0.0f;
+			m_kz[idx]	  = k > 1e-6f ? kz / k : 0.0f;
+		}
+	}
+
+	//~ spectrum only sets the shape, Amplitude sets the rms height (parseval)
+	const float scale = energy > 0.0 ? m_config.Amplitude / static_cast<float>(std::sqrt(energy)) : 0.0f;
+
+	for (std::uint32_t m = 0; m < n; ++m)
+	{
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			const size_t idx = static_cast<size_t>(m) * n + i;
+			const std::uint32_t mi = (n - m) % n;
+			const std::uint32_t ii = (n - i) % n;
+
+			m_h0	[idx] = h0[idx] * scale;
+			m_h0Conj[idx] = std::conj(h0[static_cast<size_t>(mi) * n + ii]) * scale;
+		}
+	}
+
+	Update(0.0f);
+}
+
+float OceanFFT::EvaluateSpectrum(const float kx, const float kz) const
+{
+	const float k2 = kx * kx + kz * kz;
+	if (k2 < 1e-12f) return 0.0f;
+
+	const float wind = std::max(m_config.WindSpeed, 0.01f);
+	const float L	 = wind * wind / kGravity;
+	const float l	 = L * m_config.SmallWaveCutoff;
+
+	float wx = m_config.WindDirectionX;
+	float wz = m_config.WindDirectionZ;
+	const float wl = std::sqrt(wx * wx + wz * wz);
+	if (wl > 1e-6f) { wx /= wl; wz /= wl; }
+	else			{ wx = 0.0f; wz = 1.0f; }
+
+	const float k	   = std::sqrt(k2);
+	const float cosine = (kx * wx + kz * wz) / k;
+
+	float p = std::exp(-1.0f / (k2 * L * L)) / (k2 * k2);
+	p *= cosine * cosine;
+	p *= std::exp(-k2 * l * l);
+
+	if (m_config.Spectrum == EOceanSpectrum::Jonswap)
+	{
+		//~ peak enhancement on top of the directional shape
+		const float omega  = std::sqrt(kGravity * k);
+		const float omegaP = 0.855f * kGravity / wind;
+		const float sigma  = omega <= omegaP ? 0.07f : 0.09f;
+		const float d	   = (omega - omegaP) / (sigma * omegaP);
+		p *= std::pow(std::max(m_config.JonswapGamma, 1.0f), std::exp(-0.5f * d * d));
+	}
+
+	return p;
+}
+
+void OceanFFT::Update(const float totalTime)
+{
+	if (m_h0.empty()) return;
+
+	const auto start = std::chrono::steady_clock::now();
+	const std::uint32_t n = m_config.Size;
+	const size_t cells	  = static_cast<size_t>(n) * n;
+
+	//~ D(k, t) = -i k/|k| h(k, t)
+	for (size_t i = 0; i < cells; ++i)
+	{
+		const Complex h = GetSpectrum(i, totalTime);
+
+		m_spectrumH [i] = h;
+		m_spectrumDx[i] = Complex(h.imag() * m_kx[i], -h.real() * m_kx[i]);
+		m_spectrumDz[i] = Complex(h.imag() * m_kz[i], -h.real() * m_kz[i]);
+	}
+
+	Inverse2D(m_spectrumH);
+	Inverse2D(m_spectrumDx);
+	Inverse2D(m_spectrumDz);
+
+	//~ spectrum is centred at N/2, which flips the sign of every other sample
+	float lo =  1e30f;
+	float hi = -1e30f;
+	for (std::uint32_t z = 0; z < n; ++z)
+	{
+		for (std::uint32_t x = 0; x < n; ++x)
+		{
+			const size_t idx  = static_cast<size_t>(z) * n + x;
+			const float  sign = ((x + z) & 1u) ? -1.0f : 1.0f;
+
+			m_height[idx] = m_spectrumH [idx].real() * sign;
+			m_dispX [idx] = m_spectrumDx[idx].real() * sign;
+			m_dispZ [idx] = m_spectrumDz[idx].real() * sign;
+
+			lo = std::min(lo, m_height[idx]);
+			hi = std::max(hi, m_height[idx]);
+		}
+	}
+	m_minHeight = lo;
+	m_maxHeight = hi;
+
+	const auto end = std::chrono::steady_clock::now();
+	m_lastUpdateMicro = std::chrono::duration<float, std::micro>(end - start).count();
+}
+
+OceanFFT::Complex OceanFFT::GetSpectrum(const size_t index, const float totalTime) const
+{
+	//~ h(k, t) = h0(k) e^{iwt} + conj(h0(-k)) e^{-iwt}
+	const float wt = m_omega[index] * totalTime;
+	const Complex e(std::cos(wt), std::sin(wt));
+	return m_h0[index] * e + m_h0Conj[index] * std::conj(e);
+}
+
+void OceanFFT::InverseFFT(
+	Complex *data,
+	const std::uint32_t count,
+	const std::uint32_t stride,
+	const std::vector<std::uint32_t> &bitReverse,
+	const std::vector<Complex> &twiddles,
+	std::vector<Complex> &scratch)
+{
+	//~ gather in bit reversed order so the butterflies run on contiguous memory
+	for (std::uint32_t i = 0; i < count; ++i)
+		scratch[bitReverse[i]] = data[static_cast<size_t>(i) * stride];
+
+	//~ iterative radix-2 decimation in time
+	for (std::uint32_t len = 2u; len <= count; len <<= 1u)
+	{
+		const std::uint32_t half = len >> 1u;
+		const std::uint32_t step = count / len;
+		for (std::uint32_t base = 0; base < count; base += len)
+		{
+			for (std::uint32_t j = 0; j < half; ++j)
+			{
+				const Complex u = scratch[base + j];
+				const Complex v = scratch[base + j + half] * twiddles[j * step];
+				scratch[base + j]		 = u + v;
+				scratch[base + j + half] = u - v;
+			}
+		}
+	}
+
+	for (std::uint32_t i = 0; i < count; ++i)
+		data[static_cast<size_t>(i) * stride] = scratch[i];
+}
+
+void OceanFFT::Inverse2D(std::vector<Complex> &grid)
+{
+	const std::uint32_t n = m_config.Size;
+	const std::uint32_t grain = 8u;
+
+	//~ every line is independent, each thread keeps its own scratch line
+	const auto rows = [&](const std::uint32_t begin, const std::uint32_t end)
+	{
+		thread_local std::vector<Complex> scratch;
+		scratch.resize(n);
+		for (std::uint32_t row = begin; row < end; ++row)
+			InverseFFT(grid.data() + static_cast<size_t>(row) * n, n, 1u, m_bitReverse, m_twiddles, scratch);
+	};
+
+	const auto cols = [&](const std::uint32_t begin, const std::uint32_t end)
+	{
+		thread_local std::vector<Complex> scratch;
+		scratch.resize(n);
+		for (std::uint32_t col = begin; col < end; ++col)
+			InverseFFT(grid.data() + col, n, n, m_bitReverse, m_twiddles, scratch);
+	};
+
+	if (m_jobs)
+	{
+		m_jobs->ParallelFor(n, grain, rows);
+		m_jobs->ParallelFor(n, grain, cols);
+	}
+	else
+	{
+		rows(0u, n);
+		cols(0u, n);
+	}
+}
+
+float OceanFFT::Sample(const std::vector<float> &field, const float x, const float z) const
+{
+	if (field.empty()) return 0.0f;
+
+	const std::uint32_t n = m_config.Size;
+	const float cells = static_cast<float>(n) / m_config.PatchLength;
+
+	const float fx = x * cells;
+	const float fz = z * cells;
+	const float ix = std::floor(fx);
+	const float iz = std::floor(fz);
+	const float tx = fx - ix;
+	const float tz = fz - iz;
+
+	//~ n is a power of two, masking wraps negatives too
+	const std::uint32_t mask = n - 1u;
+	const std::uint32_t x0 = static_cast<std::uint32_t>(static_cast<std::int64_t>(ix)) & mask;
+	const std::uint32_t z0 = static_cast<std::uint32_t>(static_cast<std::int64_t>(iz)) & mask;
+	const std::uint32_t x1 = (x0 + 1u) & mask;
+	const std::uint32_t z1 = (z0 + 1u) & mask;
+
+	const float a = field[static_cast<size_t>(z0) * n + x0];
+	const float b = field[static_cast<size_t>(z0) * n + x1];
+	const float c = field[static_cast<size_t>(z1) * n + x0];
+	const float d = field[static_cast<size_t>(z1) * n + x1];
+
+	const float top = a + (b - a) * tx;
+	const float bot = c + (d - c) * tx;
+	return top + (bot - top) * tz;
+}
+
+float OceanFFT::SampleHeight(const float x, const float z) const
+{
+	return Sample(m_height, x, z);
+}
+
+void OceanFFT::SampleDisplacement(const float x, const float z, float &dx, float &dz) const
+{
+	dx = Sample(m_dispX, x, z) * m_config.Choppiness;
+	dz = Sample(m_dispZ, x, z) * m_config.Choppiness;
+}
+
+void OceanFFT::ImguiView()
+{
+	ImGui::PushID(this);
+	if (ImGui::CollapsingHeader("Ocean FFT", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		OceanFFTConfig cfg = m_config;
+		bool rebuild = false;
+
+		int sizeIndex = static_cast<int>(m_log2N) - 5;
+		const char* sizes[] = { "32", "64", "128", "256" };
+		if (ImGui::Combo("Size", &sizeIndex, sizes, IM_ARRAYSIZE(sizes)))
+		{
+			cfg.Size = 32u << std::clamp(sizeIndex, 0, 3);
+			rebuild = true;
+		}
+
+		int spectrum = static_cast<int>(cfg.Spectrum);
+		const char* spectra[] = { "Phillips", "JONSWAP" };
+		if (ImGui::Combo("Spectrum", &spectrum, spectra, IM_ARRAYSIZE(spectra)))
+		{
+			cfg.Spectrum = static_cast<EOceanSpectrum>(spectrum);
+			rebuild = true;
+		}
+
+		rebuild |= ImGui::SliderFloat("Patch Length", &cfg.PatchLength, 1.0f, 256.0f);
+		rebuild |= ImGui::SliderFloat("Wind Speed", &cfg.WindSpeed, 0.5f, 40.0f);
+		rebuild |= ImGui::SliderFloat("Wind Dir X", &cfg.WindDirectionX, -1.0f, 1.0f);
+		rebuild |= ImGui::SliderFloat("Wind Dir Z", &cfg.WindDirectionZ, -1.0f, 1.0f);
+		rebuild |= ImGui::SliderFloat("Amplitude", &cfg.Amplitude, 0.0f, 1.0f);
+		if (cfg.Spectrum == EOceanSpectrum::Jonswap)
+			rebuild |= ImGui::SliderFloat("Gamma", &cfg.JonswapGamma, 1.0f, 7.0f);
+
+		//~ choppiness only scales the output, no rebuild needed
+		ImGui::SliderFloat("Choppiness", &m_config.Choppiness, 0.0f, 2.0f);
+		cfg.Choppiness = m_config.Choppiness;
+
+		if (rebuild) Initialize(cfg);
+
+		ImGui::Text("Tile: %u x %u", m_config.Size, m_config.Size);
+		ImGui::Text("Update: %.1f us", m_lastUpdateMicro);
+		ImGui::Text("Height Range: %.3f .. %.3f", m_minHeight, m_maxHeight);
+	}
+	ImGui::PopID();
+}
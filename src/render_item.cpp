@@ -36,28 +36,13 @@
 #include "framework/exception/dx_exception.h"
 #include "imgui.h"
 
+#include <algorithm>
 #include <DDSTextureLoader.h>
 #include <ranges>
 #include <ResourceUploadBatch.h>
 
 #include "utility/helpers.h"
 
-static inline void Normalize3(DirectX::XMFLOAT3& v)
-{
-	const float x = v.x, y = v.y, z = v.z;
-	const float lenSq = x*x + y*y + z*z;
-	if (lenSq > 1e-8f)
-	{
-		const float invLen = 1.0f / std::sqrt(lenSq);
-		v.x *= invLen; v.y *= invLen; v.z *= invLen;
-	}
-}
-
-static inline void ImGuiEditVec3(const char* label, DirectX::XMFLOAT3& v, float speed, float minV, float maxV)
-{
-	ImGui::DragFloat3(label, &v.x, speed, minV, maxV);
-}
-
 DirectX::XMFLOAT4X4 Transformation::GetTransform() const
 {
 	using namespace DirectX;
@@ -81,6 +66,21 @@ DirectX::XMFLOAT4X4 Transformation::GetTransform() const
 	return out;
 }
 
+void Transformation::MarkDirty() const noexcept
+{
+	m_dirty = true;
+
+	if (m_store)
+		m_store->Set(m_storeIndex, Position, Rotation, Scale);
+}
+
+void Transformation::BindStore(framework::TransformStore* store, const std::uint32_t index)
+{
+	m_store		 = store;
+	m_storeIndex = index;
+	MarkDirty();
+}
+
 void Transformation::ImguiView()
 {
 	bool changed = false;
@@ -91,23 +91,30 @@ void Transformation::ImguiView()
 
 	if (changed)
 		MarkDirty();
-}
 
-void MeshGeometry::InitGeometryBuffer(
-	ID3D12Device *device,
-	ID3D12GraphicsCommandList *cmdList,
-	const MeshData &mesh,
-	const bool keepMapping)
-{
-	Data = mesh;
-	VertexStride = sizeof(MeshVertex);
-	const std::uint32_t vbSize	= sizeof(MeshVertex) * mesh.vertices.size();
-	const auto vbAlignment = (vbSize + 3u) & ~3u;
-	VertexByteSize				= vbAlignment;
+	//~ values above are relative to the parent, -1 for none
+	if (m_store)
+	{
+		const std::uint32_t current = m_store->GetParent(m_storeIndex);
+		int parent = current == framework::TransformStore::InvalidIndex ? -1 : static_cast<int>(current);
 
-	const std::uint32_t ibSize = sizeof(uint32_t) * mesh.indices.size();
-	const auto totalSize = vbAlignment + ibSize;
+		if (ImGui::InputInt("Parent", &parent))
+		{
+			m_store->SetParent(m_storeIndex, parent < 0
+				? framework::TransformStore::InvalidIndex
+				: static_cast<std::uint32_t>(parent));
+		}
+		ImGui::SameLine();
+		ImGui::TextDisabled("(#%u)", m_storeIndex);
+	}
+}
 
+static void CreateGeometryResources(
+	ID3D12Device* device,
+	const std::uint64_t totalSize,
+	Microsoft::WRL::ComPtr<ID3D12Resource>& buffer,
+	Microsoft::WRL::ComPtr<ID3D12Resource>& uploader)
+{
 	D3D12_RESOURCE_DESC resource{};
 	resource.Flags				= D3D12_RESOURCE_FLAG_NONE;
 	resource.Alignment			= 0u;
@@ -134,7 +141,7 @@ void MeshGeometry::InitGeometryBuffer(
 		&resource,
 		D3D12_RESOURCE_STATE_COMMON,
 		nullptr,
-		IID_PPV_ARGS(&GeometryBuffer)));
+		IID_PPV_ARGS(&buffer)));
 
 	D3D12_HEAP_PROPERTIES upload = property;
 	upload.Type = D3D12_HEAP_TYPE_UPLOAD;
@@ -145,34 +152,28 @@ void MeshGeometry::InitGeometryBuffer(
 		&resource,
 		D3D12_RESOURCE_STATE_GENERIC_READ,
 		nullptr,
-		IID_PPV_ARGS(&GeometryUploader)));
-
-	//~ copy data on uploader
-	THROW_DX_IF_FAILS(GeometryUploader->Map(0u, nullptr,
-	reinterpret_cast<void**>(&Mapped)));
-
-	std::memcpy(Mapped, mesh.vertices.data(), vbSize);
-	if (vbAlignment > vbSize)
-	{
-		std::memset(Mapped + vbSize, 0, vbAlignment - vbSize);
-	}
-	std::memcpy(Mapped + vbAlignment, mesh.indices.data(), ibSize);
-
-	if (!keepMapping) GeometryUploader->Unmap(0u, nullptr);
+		IID_PPV_ARGS(&uploader)));
+}
 
+static void CopyGeometryToDefault(
+	ID3D12GraphicsCommandList* cmdList,
+	ID3D12Resource* buffer,
+	ID3D12Resource* uploader,
+	const std::uint64_t totalSize)
+{
 	//~ transition
 	D3D12_RESOURCE_BARRIER barrier{};
 	barrier.Type					= D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
 	barrier.Transition.StateBefore	= D3D12_RESOURCE_STATE_COMMON;
 	barrier.Transition.StateAfter	= D3D12_RESOURCE_STATE_COPY_DEST;
-	barrier.Transition.pResource	= GeometryBuffer.Get();
+	barrier.Transition.pResource	= buffer;
 	barrier.Transition.Subresource	= D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
 	cmdList->ResourceBarrier(1, &barrier);
 
 	cmdList->CopyBufferRegion(
-		GeometryBuffer.Get(),
+		buffer,
 		0,
-		GeometryUploader.Get(),
+		uploader,
 		0,
 		totalSize);
 
@@ -182,324 +183,197 @@ void MeshGeometry::InitGeometryBuffer(
 	final.Transition.StateAfter	 = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER |
 								   D3D12_RESOURCE_STATE_INDEX_BUFFER;
 	cmdList->ResourceBarrier(1, &final);
-
-	//~ set vertex views
-	D3D12_VERTEX_BUFFER_VIEW vert{};
-	vert.BufferLocation = GeometryBuffer->GetGPUVirtualAddress();
-	vert.StrideInBytes	= sizeof(MeshVertex);
-	vert.SizeInBytes	= vbAlignment;
-	VertexViews.push_back(vert);
-
-	//~ set index view
-	IndexViews.BufferLocation = GeometryBuffer->GetGPUVirtualAddress() + vbAlignment;
-	IndexViews.Format		  = DXGI_FORMAT_R32_UINT;
-	IndexViews.SizeInBytes	  = ibSize;
-
-	IndexCount = mesh.indices.size();
 }
 
-LightCPU & LightManager::AddDirectional(const DirectX::XMFLOAT3 &direction,
-	const DirectX::XMFLOAT3 &strength)
+void MeshGeometry::ComputeBounds()
 {
-	LightCPU light{};
-	light.Direction = direction;
-	light.Strength  = strength;
-
-	DirectionalLights.push_back(light);
-	return DirectionalLights.back();
-}
-
-LightCPU & LightManager::AddPoint(const DirectX::XMFLOAT3 &position,
-	const DirectX::XMFLOAT3 &strength,
-	float falloffStart, float falloffEnd)
-{
-	LightCPU light{};
-	light.Position     = position;
-	light.Strength     = strength;
-	light.FalloffStart = falloffStart;
-	light.FalloffEnd   = falloffEnd;
-
-	PointLights.push_back(light);
-	return PointLights.back();
-}
-
-LightCPU & LightManager::AddSpot(const DirectX::XMFLOAT3 &position,
-	const DirectX::XMFLOAT3 &direction,
-	const DirectX::XMFLOAT3 &strength, float falloffStart, float falloffEnd,
-	float spotPower)
-{
-	LightCPU light{};
-	light.Position     = position;
-	light.Direction    = direction;
-	light.Strength     = strength;
-	light.FalloffStart = falloffStart;
-	light.FalloffEnd   = falloffEnd;
-	light.SpotPower    = spotPower;
-
-	SpotLights.push_back(light);
-	return SpotLights.back();
-}
-
-void LightManager::Clear()
-{
-	DirectionalLights.clear();
-	PointLights.clear();
-	SpotLights.clear();
-}
-
-std::uint32_t LightManager::TotalLightCount() const
-{
-	return static_cast<std::uint32_t>(
-	DirectionalLights.size() +
-	PointLights.size() +
-	SpotLights.size());
-}
-
-void LightManager::FillPassConstants(PassConstantsCPU &out) const
-{
-	out.NumDirLights   = 0;
-	out.NumPointLights = 0;
-	out.NumSpotLights  = 0;
-
-	std::uint32_t index = 0;
-
-	// Directional lights first
-	for (const auto& l : DirectionalLights)
+	if (Data.vertices.empty())
 	{
-		if (index >= MaxLights) break;
-		out.Lights[index++] = l;
-		out.NumDirLights++;
+		BoundsCenter  = { 0.0f, 0.0f, 0.0f };
+		BoundsExtents = { 0.0f, 0.0f, 0.0f };
+		return;
 	}
 
-	// Point lights next
-	for (const auto& l : PointLights)
-	{
-		if (index >= MaxLights) break;
-		out.Lights[index++] = l;
-		out.NumPointLights++;
-	}
+	DirectX::XMFLOAT3 minimum = Data.vertices.front().Position;
+	DirectX::XMFLOAT3 maximum = minimum;
 
-	// Spot lights last
-	for (const auto& l : SpotLights)
+	for (const auto& vertex : Data.vertices)
 	{
-		if (index >= MaxLights) break;
-		out.Lights[index++] = l;
-		out.NumSpotLights++;
+		minimum.x = std::min(minimum.x, vertex.Position.x);
+		minimum.y = std::min(minimum.y, vertex.Position.y);
+		minimum.z = std::min(minimum.z, vertex.Position.z);
+		maximum.x = std::max(maximum.x, vertex.Position.x);
+		maximum.y = std::max(maximum.y, vertex.Position.y);
+		maximum.z = std::max(maximum.z, vertex.Position.z);
 	}
 
-	// Clear unused slots (important!)
-	for (; index < MaxLights; ++index)
-	{
-		out.Lights[index] = {};
-	}
+	BoundsCenter  = { 0.5f * (minimum.x + maximum.x), 0.5f * (minimum.y + maximum.y), 0.5f * (minimum.z + maximum.z) };
+	BoundsExtents = { 0.5f * (maximum.x - minimum.x), 0.5f * (maximum.y - minimum.y), 0.5f * (maximum.z - minimum.z) };
 }
 
-void LightManager::ImguiView()
+void MeshGeometry::InflateBounds(const DirectX::XMFLOAT3& margin)
 {
-	ImGui::PushID(this);
+	BoundsExtents.x += margin.x;
+	BoundsExtents.y += margin.y;
+	BoundsExtents.z += margin.z;
+}
 
-	if (!ImGui::CollapsingHeader("Light Manager", ImGuiTreeNodeFlags_DefaultOpen))
-	{
-		ImGui::PopID();
-		return;
-	}
+void MeshGeometry::InitGeometryBuffer(
+	ID3D12Device *device,
+	ID3D12GraphicsCommandList *cmdList,
+	const MeshData &mesh,
+	const bool keepMapping)
+{
+	Data = mesh;
+	ComputeBounds();
+	VertexStride = sizeof(MeshVertex);
+	const std::uint32_t vbSize	= sizeof(MeshVertex) * mesh.vertices.size();
+	const auto vbAlignment = (vbSize + 3u) & ~3u;
+	VertexByteSize				= vbAlignment;
 
-	ImGui::Indent();
+	const std::uint32_t ibSize = sizeof(uint32_t) * mesh.indices.size();
+	const auto totalSize = vbAlignment + ibSize;
 
-	ImGui::Text("Total: %u (Packed Max: %u)", TotalLightCount(), MaxLights);
+	CreateGeometryResources(device, totalSize, GeometryBuffer, GeometryUploader);
 
-	// Add buttons
-	if (ImGui::Button("+ Directional"))
-	{
-		AddDirectional({ 0.0f, -1.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
-	}
-	ImGui::SameLine();
-	if (ImGui::Button("+ Point"))
-	{
-		AddPoint({ 0.0f, 2.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, 1.0f, 10.0f);
-	}
-	ImGui::SameLine();
-	if (ImGui::Button("+ Spot"))
+	//~ copy data on uploader
+	THROW_DX_IF_FAILS(GeometryUploader->Map(0u, nullptr,
+	reinterpret_cast<void**>(&Mapped)));
+
+	std::memcpy(Mapped, mesh.vertices.data(), vbSize);
+	if (vbAlignment > vbSize)
 	{
-		AddSpot({ 0.0f, 2.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, 1.0f, 15.0f, 64.0f);
+		std::memset(Mapped + vbSize, 0, vbAlignment - vbSize);
 	}
+	std::memcpy(Mapped + vbAlignment, mesh.indices.data(), ibSize);
 
-	ImGui::Separator();
-
-	auto DrawList = [&](const char* title, std::vector<LightCPU>& list, ELightType type)
-	{
-		std::string header = std::string(title) + " (" + std::to_string(list.size()) + ")";
-		if (!ImGui::CollapsingHeader(header.c_str(), ImGuiTreeNodeFlags_DefaultOpen))
-			return;
+	if (!keepMapping) GeometryUploader->Unmap(0u, nullptr);
 
-		ImGui::Indent();
+	CopyGeometryToDefault(cmdList, GeometryBuffer.Get(), GeometryUploader.Get(), totalSize);
 
-		for (int i = 0; i < (int)list.size(); ++i)
-		{
-			ImGui::PushID(i);
+	//~ set vertex views
+	D3D12_VERTEX_BUFFER_VIEW vert{};
+	vert.BufferLocation = GeometryBuffer->GetGPUVirtualAddress();
+	vert.StrideInBytes	= sizeof(MeshVertex);
+	vert.SizeInBytes	= vbAlignment;
+	VertexViews.push_back(vert);
 
-			char label[64]{};
-			std::snprintf(label, sizeof(label), "%s %d", title, i);
+	//~ set index view
+	IndexViews.BufferLocation = GeometryBuffer->GetGPUVirtualAddress() + vbAlignment;
+	IndexViews.Format		  = DXGI_FORMAT_R32_UINT;
+	IndexViews.SizeInBytes	  = ibSize;
 
-			if (ImGui::TreeNodeEx(label, ImGuiTreeNodeFlags_DefaultOpen))
-			{
-				auto& l = list[static_cast<size_t>(i)];
+	IndexCount = mesh.indices.size();
+}
 
-				ImGuiEditVec3("Strength", l.Strength, 0.01f, 0.0f, 10000.0f);
+void MeshGeometry::InitSplitStreamBuffer(
+	ID3D12Device *device,
+	ID3D12GraphicsCommandList *cmdList,
+	const MeshData &mesh)
+{
+	Data		  = mesh;
+	ComputeBounds();
+	bSplitStream  = true;
+	VertexStride  = sizeof(MeshStaticStreamVertex);
+	DynamicStride = sizeof(MeshDynamicStreamVertex);
 
-				if (type == ELightType::Directional || type == ELightType::Spotlight)
-				{
-					ImGuiEditVec3("Direction", l.Direction, 0.01f, -1.0f, 1.0f);
-					ImGui::SameLine();
-					if (ImGui::Button("Normalize##Dir"))
-						Normalize3(l.Direction);
-				}
+	const std::uint32_t count		= static_cast<std::uint32_t>(mesh.vertices.size());
+	const std::uint32_t staticSize	= (VertexStride * count + 3u) & ~3u;
+	const std::uint32_t dynamicSize = (DynamicStride * count + 3u) & ~3u;
+	const std::uint32_t ibSize		= sizeof(uint32_t) * static_cast<std::uint32_t>(mesh.indices.size());
 
-				if (type == ELightType::Point || type == ELightType::Spotlight)
-				{
-					ImGuiEditVec3("Position", l.Position, 0.05f, -100000.0f, 100000.0f);
+	DynamicOffset  = staticSize;
+	VertexByteSize = staticSize + dynamicSize;
+	const std::uint32_t totalSize = VertexByteSize + ibSize;
 
-					ImGui::DragFloat("FalloffStart", &l.FalloffStart, 0.05f, 0.0f, 100000.0f);
-					ImGui::DragFloat("FalloffEnd",   &l.FalloffEnd,   0.05f, 0.0f, 100000.0f);
+	CreateGeometryResources(device, totalSize, GeometryBuffer, GeometryUploader);
 
-					if (l.FalloffEnd < l.FalloffStart)
-						l.FalloffEnd = l.FalloffStart;
-				}
+	THROW_DX_IF_FAILS(GeometryUploader->Map(0u, nullptr,
+		reinterpret_cast<void**>(&Mapped)));
 
-				if (type == ELightType::Spotlight)
-				{
-					ImGui::DragFloat("SpotPower", &l.SpotPower, 1.0f, 1.0f, 512.0f);
-				}
+	std::memset(Mapped, 0, VertexByteSize);
 
-				ImGui::Separator();
+	auto* staticStream  = reinterpret_cast<MeshStaticStreamVertex*>(Mapped);
+	auto* dynamicStream = reinterpret_cast<MeshDynamicStreamVertex*>(Mapped + DynamicOffset);
+	for (std::uint32_t i = 0; i < count; ++i)
+	{
+		staticStream [i] = MeshStaticStreamVertex::Pack(mesh.vertices[i]);
+		dynamicStream[i] = MeshDynamicStreamVertex::Pack(mesh.vertices[i]);
+	}
+	std::memcpy(Mapped + VertexByteSize, mesh.indices.data(), ibSize);
 
-				if (ImGui::Button("Remove"))
-				{
-					list.erase(list.begin() + i);
-					ImGui::TreePop();
-					ImGui::PopID();
-					break;
-				}
+	CopyGeometryToDefault(cmdList, GeometryBuffer.Get(), GeometryUploader.Get(), totalSize);
 
-				ImGui::TreePop();
-			}
+	const D3D12_GPU_VIRTUAL_ADDRESS base = GeometryBuffer->GetGPUVirtualAddress();
 
-			ImGui::PopID();
-		}
+	D3D12_VERTEX_BUFFER_VIEW staticView{};
+	staticView.BufferLocation = base;
+	staticView.StrideInBytes  = VertexStride;
+	staticView.SizeInBytes	  = staticSize;
+	VertexViews.push_back(staticView);
 
-		ImGui::Unindent();
-	};
+	D3D12_VERTEX_BUFFER_VIEW dynamicView{};
+	dynamicView.BufferLocation = base + DynamicOffset;
+	dynamicView.StrideInBytes  = DynamicStride;
+	dynamicView.SizeInBytes	   = dynamicSize;
+	VertexViews.push_back(dynamicView);
 
-	DrawList("Directional", DirectionalLights, ELightType::Directional);
-	DrawList("Point",       PointLights,       ELightType::Point);
-	DrawList("Spotlight",   SpotLights,        ELightType::Spotlight);
+	IndexViews.BufferLocation = base + VertexByteSize;
+	IndexViews.Format		  = DXGI_FORMAT_R32_UINT;
+	IndexViews.SizeInBytes	  = ibSize;
 
-	ImGui::Unindent();
-	ImGui::PopID();
+	IndexCount = static_cast<UINT>(mesh.indices.size());
 }
 
-JsonLoader LightManager::GetJsonData() const
+void MeshGeometry::UploadRows(
+	ID3D12GraphicsCommandList *cmdList,
+	const std::uint32_t columns,
+	const std::vector<framework::DirtyRowRange> &ranges)
 {
-	JsonLoader saver{};
-
-	auto WriteVec3 = [&](JsonLoader& node, const char* k, const DirectX::XMFLOAT3& v)
-	{
-		node[k]["X"] = v.x;
-		node[k]["Y"] = v.y;
-		node[k]["Z"] = v.z;
-	};
+	if (!Mapped || ranges.empty()) return;
 
-	auto WriteLight = [&](JsonLoader& node, const LightCPU& l)
-	{
-		WriteVec3(node, "Strength",  l.Strength);
-		node["FalloffStart"] = l.FalloffStart;
+	constexpr D3D12_RESOURCE_STATES readState =
+		D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_INDEX_BUFFER;
 
-		WriteVec3(node, "Direction", l.Direction);
-		node["FalloffEnd"] = l.FalloffEnd;
+	D3D12_RESOURCE_BARRIER br{};
+	br.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+	br.Transition.pResource   = GeometryBuffer.Get();
+	br.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+	br.Transition.StateBefore = readState;
+	br.Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_DEST;
+	cmdList->ResourceBarrier(1, &br);
 
-		WriteVec3(node, "Position",  l.Position);
-		node["SpotPower"] = l.SpotPower;
-	};
+	const std::uint64_t stride	 = bSplitStream ? DynamicStride : sizeof(MeshVertex);
+	const std::uint64_t base	 = bSplitStream ? DynamicOffset : 0u;
+	const std::uint64_t rowBytes = stride * columns;
 
-	auto WriteList = [&](const char* listKey, const std::vector<LightCPU>& list)
+	for (const auto& range : ranges)
 	{
-		auto& root = saver["Lights"][listKey];
-		root["Count"] = static_cast<int>(list.size());
+		const size_t first = static_cast<size_t>(range.FirstRow) * columns;
+		const size_t count = static_cast<size_t>(range.RowCount) * columns;
+		const std::uint64_t offset = base + range.FirstRow * rowBytes;
 
-		for (size_t i = 0; i < list.size(); ++i)
+		if (bSplitStream)
 		{
-			const std::string itemKey = "Item_" + std::to_string(i);
-			auto& n = root[itemKey];
-			WriteLight(n, list[i]);
+			auto* dst = reinterpret_cast<MeshDynamicStreamVertex*>(Mapped + offset);
+			for (size_t i = 0; i < count; ++i)
+				dst[i] = MeshDynamicStreamVertex::Pack(Data.vertices[first + i]);
 		}
-	};
-
-	WriteList("Directional", DirectionalLights);
-	WriteList("Point",       PointLights);
-	WriteList("Spot",        SpotLights);
-
-	return saver;
-}
-
-void LightManager::LoadJsonData(const JsonLoader& data)
-{
-	auto ReadVec3 = [](const JsonLoader& node, const char* key, const DirectX::XMFLOAT3& def) -> DirectX::XMFLOAT3
-	{
-		if (!node.Has(key)) return def;
-
-		const auto& v = node[key];
-		if (!v.Has("X") || !v.Has("Y") || !v.Has("Z")) return def;
-
-		return DirectX::XMFLOAT3(
-			v["X"].AsFloat(def.x),
-			v["Y"].AsFloat(def.y),
-			v["Z"].AsFloat(def.z)
-		);
-	};
-
-	auto ReadLight = [&](const JsonLoader& node) -> LightCPU
-	{
-		LightCPU l{};
-
-		l.Strength     = ReadVec3(node, "Strength",  DirectX::XMFLOAT3(1.f, 1.f, 1.f));
-		l.FalloffStart = node.Has("FalloffStart") ? node["FalloffStart"].AsFloat(0.0f) : 0.0f;
-
-		l.Direction    = ReadVec3(node, "Direction", DirectX::XMFLOAT3(0.f, -1.f, 0.f));
-		l.FalloffEnd   = node.Has("FalloffEnd") ? node["FalloffEnd"].AsFloat(0.0f) : 0.0f;
-
-		l.Position     = ReadVec3(node, "Position",  DirectX::XMFLOAT3(0.f, 0.f, 0.f));
-		l.SpotPower    = node.Has("SpotPower") ? node["SpotPower"].AsFloat(64.0f) : 64.0f;
-
-		return l;
-	};
-
-	auto ReadList = [&](const char* listKey, std::vector<LightCPU>& outList)
-	{
-		outList.clear();
-
-		if (!data.Has("Lights")) return;
-		const auto& lightsRoot = data["Lights"];
-
-		if (!lightsRoot.Has(listKey)) return;
-		const auto& root = lightsRoot[listKey];
-
-		const int count = root.Has("Count") ? root["Count"].AsInt(0) : 0;
-		if (count <= 0) return;
-
-		outList.reserve(static_cast<size_t>(count));
-
-		for (int i = 0; i < count; ++i)
+		else
 		{
-			const std::string itemKey = "Item_" + std::to_string(i);
-			if (!root.Has(itemKey)) continue;
-
-			outList.push_back(ReadLight(root[itemKey]));
+			std::memcpy(Mapped + offset, Data.vertices.data() + first, count * sizeof(MeshVertex));
 		}
-	};
 
-	ReadList("Directional", DirectionalLights);
-	ReadList("Point",       PointLights);
-	ReadList("Spot",        SpotLights);
+		cmdList->CopyBufferRegion(
+			GeometryBuffer.Get(),
+			offset,
+			GeometryUploader.Get(),
+			offset,
+			range.RowCount * rowBytes);
+	}
+
+	std::swap(br.Transition.StateBefore, br.Transition.StateAfter);
+	cmdList->ResourceBarrier(1, &br);
 }
 
 void Texture::Init(	ID3D12Device *device,
@@ -538,7 +412,8 @@ void Texture::Init(	ID3D12Device *device,
 
 	const std::uint32_t count = static_cast<std::uint32_t>(toLoad.size());
 
-	heapIndex = heap.Allocate(count);
+	heapHandle = heap.AllocateHandle(count);
+	heapIndex  = heap.GetIndex(heapHandle);
 	baseCpuHandle = heap.GetCPUHandle(heapIndex);
 	baseGpuHandle = heap.GetGPUHandle(heapIndex);
 
@@ -615,6 +490,27 @@ void Texture::Init(	ID3D12Device *device,
 	}
 }
 
+void Texture::Release(const std::uint64_t fenceValue,
+					  framework::DescriptorHeap &heap,
+					  framework::DeferredReleaseQueue &releases)
+{
+	if (!IsValid()) return;
+
+	releases.FreeHandle(fenceValue, heap, heapHandle, static_cast<std::uint32_t>(Resources.size()));
+	for (auto &pack: Resources | std::views::values)
+	{
+		if (pack.Resource)	 releases.Keep(fenceValue, std::move(pack.Resource));
+		if (pack.UploadHeap) releases.Keep(fenceValue, std::move(pack.UploadHeap));
+	}
+
+	Resources.clear();
+	bCubeMap	  = false;
+	heapHandle	  = {};
+	heapIndex	  = 0u;
+	baseCpuHandle = {};
+	baseGpuHandle = {};
+}
+
 bool Texture::IsValid() const noexcept
 {
 	for (const auto &pack: Resources | std::views::values)
@@ -634,84 +530,6 @@ void RenderItem::InitTextures(	ID3D12Device *device,
 	}
 }
 
-void RenderItem::InitConstantBuffer(
-	const std::uint32_t frameCount,
-	ID3D12Device *device,
-	framework::DescriptorHeap &heap)
-{
-	FrameCount = frameCount;
-	constexpr std::uint32_t perObjSize	= (sizeof(PerObjectConstantsCPU) + 255u) & ~255u;
-	constexpr std::uint32_t passSize	= (sizeof(PassConstantsCPU) + 255u) & ~255u;
-	const std::uint32_t totalSize		= (passSize + perObjSize) * frameCount;
-
-	D3D12_RESOURCE_DESC resource{};
-	resource.Flags				= D3D12_RESOURCE_FLAG_NONE;
-	resource.Format				= DXGI_FORMAT_UNKNOWN;
-	resource.Alignment			= 0u;
-	resource.DepthOrArraySize	= 1u;
-	resource.Dimension			= D3D12_RESOURCE_DIMENSION_BUFFER;
-	resource.Height				= 1u;
-	resource.Layout				= D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-	resource.MipLevels			= 1u;
-	resource.SampleDesc.Count	= 1u;
-	resource.SampleDesc.Quality = 0u;
-	resource.Width = totalSize;
-
-	D3D12_HEAP_PROPERTIES property{};
-	property.Type				  = D3D12_HEAP_TYPE_UPLOAD;
-	property.CPUPageProperty	  = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-	property.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-	property.CreationNodeMask	  = 1u;
-	property.VisibleNodeMask	  = 1u;
-
-	THROW_DX_IF_FAILS(device->CreateCommittedResource(
-		&property, D3D12_HEAP_FLAG_NONE,
-		&resource, D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr, IID_PPV_ARGS(&ConstantBuffer)));
-
-	BYTE* mapped{ nullptr };
-	THROW_DX_IF_FAILS(ConstantBuffer->Map(
-		0u, nullptr,
-		reinterpret_cast<void**>(&mapped)));
-
-	//~ init views
-	PerObject.Size	  = perObjSize;
-	PassConstant.Size = passSize;
-
-	std::uint32_t offset = 0;
-	for (int i = 0; i < FrameCount; i++)
-	{
-		const std::uint32_t base = heap.Allocate(2u);
-		auto cpuHandle = heap.GetCPUHandle(base);
-		auto gpuHandle = heap.GetGPUHandle(base);
-
-		BaseCBHandle.push_back(gpuHandle);
-
-		//~ init per object cb
-		D3D12_CONSTANT_BUFFER_VIEW_DESC perView{};
-		perView.BufferLocation = ConstantBuffer->GetGPUVirtualAddress() + offset;
-		perView.SizeInBytes = perObjSize;
-		device->CreateConstantBufferView(&perView, cpuHandle);
-		PerObject.Views.push_back(perView);
-		PerObject.Mapped.emplace_back(mapped + offset);
-
-		//~ step
-		offset += perObjSize;
-		cpuHandle = heap.GetCPUHandle(base + 1u);
-
-		//~ init per object cb
-		D3D12_CONSTANT_BUFFER_VIEW_DESC passView{};
-		passView.BufferLocation = ConstantBuffer->GetGPUVirtualAddress() + offset;
-		passView.SizeInBytes = passSize;
-		device->CreateConstantBufferView(&passView, cpuHandle);
-		PassConstant.Views.push_back(passView);
-		PassConstant.Mapped.emplace_back(mapped + offset);
-
-		//~ step
-		offset += passSize;
-	}
-}
-
 void RenderItem::ImguiView()
 {
 	ImGui::PushID(this);
@@ -765,12 +583,6 @@ void RenderItem::ImguiView()
 			}
 		}
 
-		// Frames
-		{
-			ImGui::Text("Frame Index: %u", FrameIndex);
-			ImGui::Text("Frame Count: %u", FrameCount);
-		}
-
 		// Transform
 		{
 			ImGui::PushID("Transform");
@@ -802,7 +614,6 @@ void Material::ImguiView()
 				Name = nameBuffer;
 
 			ImGui::InputScalar("SRV Heap Index", ImGuiDataType_U32, &SrvHeapIndex);
-			ImGui::InputScalar("Num Frames", ImGuiDataType_U32, &FrameCount);
 		}
 
 		ImGui::Separator();
@@ -992,65 +803,3 @@ void Material::RebuildUVTransformIfDirty()
 
 	m_UVDirty = false;
 }
-
-void Material::InitPixelConstantBuffer(
-	const std::uint32_t frameCount,
-	ID3D12Device *device,
-	framework::DescriptorHeap &heap)
-{
-	constexpr std::uint32_t resourceSize = (sizeof(Material::MaterialConstants) + 255u) & ~255u;
-	const std::uint32_t totalSize		 = resourceSize * frameCount;
-	if (!totalSize) return;
-
-	D3D12_RESOURCE_DESC resource{};
-	resource.Alignment			= 0u;
-	resource.DepthOrArraySize	= 1u;
-	resource.Dimension			= D3D12_RESOURCE_DIMENSION_BUFFER;
-	resource.Flags				= D3D12_RESOURCE_FLAG_NONE;
-	resource.Format				= DXGI_FORMAT_UNKNOWN;
-	resource.Height				= 1u;
-	resource.Layout				= D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-	resource.MipLevels			= 1u;
-	resource.SampleDesc.Count	= 1u;
-	resource.SampleDesc.Quality = 0u;
-	resource.Width				= totalSize;
-
-	D3D12_HEAP_PROPERTIES properties{};
-	properties.Type					= D3D12_HEAP_TYPE_UPLOAD;
-	properties.CPUPageProperty		= D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-	properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-	properties.CreationNodeMask		= 1u;
-	properties.VisibleNodeMask		= 1u;
-
-	THROW_DX_IF_FAILS(device->CreateCommittedResource(
-			&properties, D3D12_HEAP_FLAG_NONE, &resource,
-			D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
-			IID_PPV_ARGS(&PixelConstantBuffer)
-		));
-
-	BYTE* mapped{ nullptr };
-	THROW_DX_IF_FAILS(PixelConstantBuffer->Map(0u, nullptr,
-		reinterpret_cast<void**>(&mapped)));
-
-	std::uint32_t offset = 0;
-	std::uint32_t startIndex = heap.Allocate(frameCount);
-	for (int i = 0; i < frameCount; i++)
-	{
-		D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = heap.GetGPUHandle(startIndex);
-		BasePCBHandle.push_back(gpuHandle); //~ one of each iter
-
-		const D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = heap.GetCPUHandle(startIndex);
-		D3D12_CONSTANT_BUFFER_VIEW_DESC view{};
-		view.BufferLocation = PixelConstantBuffer->GetGPUVirtualAddress() + offset;
-		view.SizeInBytes	= resourceSize;
-
-		device->CreateConstantBufferView(&view, cpuHandle);
-		PixelConstantMap.Mapped.push_back(mapped + offset);
-		PixelConstantMap.Views .push_back(view);
-		PixelConstantMap.GPUHandle.push_back(gpuHandle);
-
-		//~ step
-		offset += resourceSize;
-		++startIndex;
-	}
-}
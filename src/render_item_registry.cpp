@@ -0,0 +1,132 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/render_item_registry.h"
+
+#include <utility>
+
+#include "imgui.h"
+
+using namespace framework;
+
+RenderItemHandle RenderItemRegistry::Add(RenderItem&& item, const std::uint32_t meshId, const std::uint32_t materialId)
+{
+	const RenderItemHandle handle = m_slots.Add();
+
+	m_meshIds	  .push_back(meshId);
+	m_materialIds .push_back(materialId);
+	m_worldIndices.push_back(item.ObjectSlot);
+	m_flags		  .push_back(RenderItemFlags::Make(item.Visible, item.PrimitiveMode));
+	m_items		  .push_back(std::move(item));
+
+	return handle;
+}
+
+bool RenderItemRegistry::Remove(const RenderItemHandle handle)
+{
+	std::uint32_t removed, moved;
+	if (!m_slots.Remove(handle, removed, moved)) return false;
+
+	if (removed != moved)
+	{
+		m_meshIds	  [removed] = m_meshIds		[moved];
+		m_materialIds [removed] = m_materialIds [moved];
+		m_worldIndices[removed] = m_worldIndices[moved];
+		m_flags		  [removed] = m_flags		[moved];
+		m_items		  [removed] = std::move(m_items[moved]);
+	}
+
+	m_meshIds	  .pop_back();
+	m_materialIds .pop_back();
+	m_worldIndices.pop_back();
+	m_flags		  .pop_back();
+	m_items		  .pop_back();
+	return true;
+}
+
+void RenderItemRegistry::Clear()
+{
+	m_slots.Clear();
+	m_meshIds	  .clear();
+	m_materialIds .clear();
+	m_worldIndices.clear();
+	m_flags		  .clear();
+	m_items		  .clear();
+}
+
+RenderItem* RenderItemRegistry::Get(const RenderItemHandle handle)
+{
+	const std::uint32_t index = m_slots.GetDense(handle);
+	return index != SlotHandle::InvalidIndex ? &m_items[index] : nullptr;
+}
+
+const RenderItem* RenderItemRegistry::Get(const RenderItemHandle handle) const
+{
+	const std::uint32_t index = m_slots.GetDense(handle);
+	return index != SlotHandle::InvalidIndex ? &m_items[index] : nullptr;
+}
+
+void RenderItemRegistry::GatherByMaterial(const std::uint32_t materialId, std::vector<std::uint32_t>& out) const
+{
+	out.clear();
+	for (std::uint32_t i = 0; i < GetCount(); ++i)
+		if (m_materialIds[i] == materialId) out.push_back(i);
+}
+
+void RenderItemRegistry::SetWorldIndex(const std::uint32_t index, const std::uint32_t worldIndex)
+{
+	m_worldIndices[index]	   = worldIndex;
+	m_items[index].ObjectSlot = worldIndex;
+}
+
+void RenderItemRegistry::Refresh(const std::uint32_t index)
+{
+	const RenderItem& item = m_items[index];
+	m_flags[index] = RenderItemFlags::Make(item.Visible, item.PrimitiveMode);
+}
+
+void RenderItemRegistry::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Render Item Registry"))
+	{
+		ImGui::BulletText("Items: %u", GetCount());
+		ImGui::BulletText("Slots: %u", m_slots.GetSlotCount());
+		ImGui::BulletText("Hot Bytes / Item: %u", static_cast<std::uint32_t>(4u * sizeof(std::uint32_t)));
+		ImGui::BulletText("Cold Bytes / Item: %u", static_cast<std::uint32_t>(sizeof(RenderItem)));
+	}
+
+	ImGui::PopID();
+}
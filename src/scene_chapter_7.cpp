@@ -34,6 +34,9 @@
 // -----------------------------------------------------------------------------
 #include "application/scene/scene_chapter_7.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <ranges>
 
 #include "framework/exception/dx_exception.h"
@@ -136,6 +139,17 @@ bool SceneChapter7::Initialize()
 
 void SceneChapter7::Shutdown()
 {
+	//~ wait for everything submitted so far, after that nothing queued can still be read
+	const UINT64 fence = Render.FenceValue;
+	THROW_DX_IF_FAILS(Render.GfxQueue->Signal(Render.Fence.Get(), fence));
+	Render.IncrementFenceValue();
+
+	if (Render.Fence->GetCompletedValue() < fence)
+	{
+		THROW_DX_IF_FAILS(Render.Fence->SetEventOnCompletion(fence, m_waitEvent));
+		WaitForSingleObject(m_waitEvent, INFINITE);
+	}
+	m_releases.Flush();
 }
 
 void SceneChapter7::FrameBegin(float deltaTime)
@@ -159,6 +173,11 @@ void SceneChapter7::FrameBegin(float deltaTime)
 		WaitForSingleObject(m_waitEvent, INFINITE);
 	}else ++m_gpuIdleCount;
 
+	//~ frames the gpu has retired give their constant space back
+	m_uploadAllocator.BeginFrame(Render.Fence->GetCompletedValue());
+	m_releases.Retire(Render.Fence->GetCompletedValue());
+	m_objectConstants.BeginFrame(fi);
+
 	if (m_lastPrinted <= 0.0f)
 	{
 		m_lastPrinted = 5.0f;
@@ -173,6 +192,11 @@ void SceneChapter7::FrameBegin(float deltaTime)
 		m_pipeline.Initialize(&Render);
 	}
 
+	if (m_instancedPipeline.IsInitialized() && m_instancedPipeline.IsDirty())
+	{
+		m_instancedPipeline.Initialize(&Render);
+	}
+
 	auto* alloc = m_commandAllocators[fi].Get();
 	THROW_DX_IF_FAILS(alloc->Reset());
 	THROW_DX_IF_FAILS(Render.GfxCmd->Reset(alloc,
@@ -238,6 +262,7 @@ void SceneChapter7::FrameEnd(float deltaTime)
 	THROW_DX_IF_FAILS(Render.GfxQueue->Signal(Render.Fence.Get(), Render.FenceValue));
 
 	m_rtProtectedFenceValue[frameIndex] = Render.FenceValue; //~ Cache last attached fence
+	m_uploadAllocator.EndFrame(Render.FenceValue);
 
 	Render.IncrementFenceValue();
 	Render.IncrementFrameIndex();
@@ -248,6 +273,16 @@ void SceneChapter7::ImguiView(const float deltaTime)
 	(void)deltaTime;
 
 	m_descriptorHeap.ImguiView();
+	m_uploadAllocator.ImguiView();
+	m_releases.ImguiView();
+	m_objectConstants.ImguiView();
+	m_transforms.ImguiView();
+
+	ImGui::Checkbox("Instancing", &m_bInstancing);
+	ImGui::SameLine();
+	ImGui::Text("Draw Calls: %u", m_lastDrawCalls);
+	ImGui::Checkbox("Frustum Culling", &m_bFrustumCulling);
+	m_culler.ImguiView();
 
 	constexpr EShape kShapes[] =
 	{
@@ -414,6 +449,14 @@ void SceneChapter7::CreateAllocators()
 		m_commandAllocators.emplace_back(std::move(alloc));
 	}
 
+	//~ every per-draw constant of every frame in flight is carved from here
+	m_uploadAllocator.Initialize(Render.Device.Get(), 4u * 1024u * 1024u);
+
+	//~ object matrices persist, only the ones that move get rewritten
+	m_objectConstants.Initialize(Render.Device.Get(), Render.BackBufferCount, 1024u);
+	m_transforms.Initialize(Render.BackBufferCount);
+	m_transforms.SetJobSystem(Jobs);
+
 	logger::success("Created Command Allocations Count: {}", Render.BackBufferCount);
 }
 
@@ -424,17 +467,22 @@ void SceneChapter7::CreateShaders()
 
 	const std::string vertexPath = "shaders/chapter_7/vertex_shader.hlsl";
 	const auto wVP = std::wstring(vertexPath.begin(), vertexPath.end());
+	const std::string instancedPath = "shaders/chapter_7/instanced_vertex_shader.hlsl";
+	const auto wIP = std::wstring(instancedPath.begin(), instancedPath.end());
 	const std::string pixelPath  = "shaders/chapter_7/pixel_shader.hlsl";
 	const auto wPP = std::wstring(pixelPath.begin(), pixelPath.end());
 
-	if (!helpers::IsFile(vertexPath) || !helpers::IsFile(pixelPath))
+	if (!helpers::IsFile(vertexPath) || !helpers::IsFile(instancedPath) || !helpers::IsFile(pixelPath))
 	{
-		THROW_MSG("Either Vertex or Pixel Path is not valid!");
+		THROW_MSG("Either the Vertex, Instanced Vertex or Pixel Path is not valid!");
 	}
 
 	m_vertexShaderBlob = framework::DxRenderManager::CompileShader(
 			wVP, nullptr, "main", "vs_5_0");
 
+	m_instancedVertexShaderBlob = framework::DxRenderManager::CompileShader(
+			wIP, nullptr, "main", "vs_5_0");
+
 	m_pixelShaderBlob = framework::DxRenderManager::CompileShader(
 		wPP, nullptr, "main", "ps_5_0");
 
@@ -461,22 +509,28 @@ void SceneChapter7::CreateRootSignature()
 	if (m_bRootSignatureInitialized) return;
 	m_bRootSignatureInitialized = true;
 
-	D3D12_DESCRIPTOR_RANGE range{};
-	range.NumDescriptors					= 2u;
-	range.BaseShaderRegister				= 0u;
-	range.RegisterSpace						= 0u;
-	range.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
-	range.RangeType							= D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-
-	D3D12_ROOT_PARAMETER param[1]{};
-	param[0].ParameterType						 = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-	param[0].ShaderVisibility					 = D3D12_SHADER_VISIBILITY_VERTEX;
-	param[0].DescriptorTable.NumDescriptorRanges = 1u;
-	param[0].DescriptorTable.pDescriptorRanges	 = &range;
+	D3D12_ROOT_PARAMETER param[3]{};
+	//~ per object constants, sub allocated each frame
+	param[0].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_CBV;
+	param[0].ShaderVisibility			= D3D12_SHADER_VISIBILITY_VERTEX;
+	param[0].Descriptor.ShaderRegister	= 0u;
+	param[0].Descriptor.RegisterSpace	= 0u;
+
+	//~ pass constants, one shared block per frame
+	param[1].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_CBV;
+	param[1].ShaderVisibility			= D3D12_SHADER_VISIBILITY_VERTEX;
+	param[1].Descriptor.ShaderRegister	= 1u;
+	param[1].Descriptor.RegisterSpace	= 0u;
+
+	//~ instance world matrices of the current batch
+	param[2].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_SRV;
+	param[2].ShaderVisibility			= D3D12_SHADER_VISIBILITY_VERTEX;
+	param[2].Descriptor.ShaderRegister	= 0u;
+	param[2].Descriptor.RegisterSpace	= 0u;
 
 	D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc{};
 	rootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-	rootSignatureDesc.NumParameters = 1u;
+	rootSignatureDesc.NumParameters = 3u;
 	rootSignatureDesc.pParameters = param;
 	rootSignatureDesc.NumStaticSamplers = 0u;
 	rootSignatureDesc.pStaticSamplers = nullptr;
@@ -519,6 +573,26 @@ void SceneChapter7::CreatePipeline()
 	m_pipeline.SetCullMode(ECullMode::None);
 
 	m_pipeline.Initialize(&Render);
+
+	//~ same state, world from the instance buffer
+	m_instancedPipeline.SetRootSignature(m_rootSignature.Get());
+
+	m_instancedPipeline.SetVertexShader(D3D12_SHADER_BYTECODE{
+		m_instancedVertexShaderBlob->GetBufferPointer(),
+		m_instancedVertexShaderBlob->GetBufferSize()
+	});
+
+	m_instancedPipeline.SetPixelShader(D3D12_SHADER_BYTECODE{
+		m_pixelShaderBlob->GetBufferPointer(),
+		m_pixelShaderBlob->GetBufferSize()
+	});
+
+	m_instancedPipeline.SetInputLayout(MeshVertex::GetInputLayout());
+
+	m_instancedPipeline.SetFillMode(EFillMode::Solid);
+	m_instancedPipeline.SetCullMode(ECullMode::None);
+
+	m_instancedPipeline.Initialize(&Render);
 }
 
 void SceneChapter7::CreateGeometry()
@@ -598,10 +672,6 @@ void SceneChapter7::CreateRenderItems()
 	{
 		RenderItem item{};
 		item.Mesh = &m_geometries[EShape::Box];
-		item.InitConstantBuffer(
-			Render.BackBufferCount,
-			Render.Device.Get(),
-			m_descriptorHeap);
 		m_renderItems[EShape::Box].emplace_back(std::move(item));
 	}
 	m_nBoxCounts = 0;
@@ -610,10 +680,6 @@ void SceneChapter7::CreateRenderItems()
 	{
 		RenderItem item{};
 		item.Mesh = &m_geometries[EShape::Cylinder];
-		item.InitConstantBuffer(
-			Render.BackBufferCount,
-			Render.Device.Get(),
-			m_descriptorHeap);
 		m_renderItems[EShape::Cylinder].emplace_back(std::move(item));
 	}
 	m_nCylinderCount = 0;
@@ -622,20 +688,12 @@ void SceneChapter7::CreateRenderItems()
 	{
 		RenderItem item{};
 		item.Mesh = &m_geometries[EShape::Sphere];
-		item.InitConstantBuffer(
-			Render.BackBufferCount,
-			Render.Device.Get(),
-			m_descriptorHeap);
 		m_renderItems[EShape::Sphere].emplace_back(std::move(item));
 	}
 	m_nSphereCount = 0;
 
 	RenderItem item{};
 	item.Mesh = &m_geometries[EShape::Mountain];
-	item.InitConstantBuffer(
-		Render.BackBufferCount,
-		Render.Device.Get(),
-		m_descriptorHeap);
 	m_renderItems[EShape::Mountain].emplace_back(std::move(item));
 
 	LoadData();
@@ -646,6 +704,11 @@ void SceneChapter7::CreateMountain()
 	if (!m_bMountainDirty) return;
 	m_bMountainDirty = false;
 
+	//~ frames still in flight may draw the old mountain, its buffers live until they are done
+	auto& mountain = m_geometries[EShape::Mountain];
+	if (mountain.GeometryBuffer)   m_releases.Keep(Render.FenceValue, std::move(mountain.GeometryBuffer));
+	if (mountain.GeometryUploader) m_releases.Keep(Render.FenceValue, std::move(mountain.GeometryUploader));
+
 	m_geometries[EShape::Mountain] = MeshGeometry{};
 	const MeshData data = MeshGenerator::GenerateMountain(m_mountainConfig);
 	m_geometries[EShape::Mountain].InitGeometryBuffer(
@@ -700,28 +763,111 @@ void SceneChapter7::UpdateConstantBuffer(const float deltaTime)
 	m_globalPassConstant.DeltaTime = deltaTime;
 	m_globalPassConstant.TotalTime = m_totalTime;
 
+	//~ newcomers join the transform store, their constant slot follows the store index
 	for (auto &vec: m_renderItems | std::views::values)
 	{
 		for (auto& renderItem : vec)
 		{
-			const auto index = renderItem.FrameIndex;
-			PerObjectConstantsCPU per{};
-			const auto world = renderItem.Transform.GetTransform();
-
-			DirectX::XMStoreFloat4x4(
-				&per.World,
-				DirectX::XMMatrixTranspose(
-					DirectX::XMLoadFloat4x4(&world)
-				)
-			);
+			if (renderItem.ObjectSlot == framework::ObjectConstantTable::InvalidSlot)
+			{
+				renderItem.ObjectSlot = m_transforms.Add();
+				renderItem.Transform.BindStore(&m_transforms, renderItem.ObjectSlot);
+			}
 
-			BYTE* dst = renderItem.PerObject.Mapped[index];
-			std::memcpy(dst, &per, sizeof(per));
+			renderItem.ObjectConstants = m_objectConstants.GetAddress(renderItem.ObjectSlot);
+		}
+	}
+
+	//~ only moved objects are rebuilt, only stale frame copies are written
+	m_transforms.Flush(
+		m_objectConstants.GetFrameData(m_transforms.GetCount()),
+		framework::ObjectConstantTable::SlotSize);
+
+	//~ once per frame, every draw binds the same block
+	m_passAddress = m_uploadAllocator.Push(m_globalPassConstant).GPU;
+
+	GatherVisibleItems();
+	if (m_bInstancing) BuildInstanceBatches();
+}
+
+void SceneChapter7::GatherVisibleItems()
+{
+	m_visibleItems.clear();
 
-			dst = renderItem.PassConstant.Mapped[index];
-			std::memcpy(dst, &m_globalPassConstant, sizeof(m_globalPassConstant));
+	for (auto &items: m_renderItems | std::views::values)
+	{
+		for (auto& item : items)
+		{
+			if (item.Visible && item.Mesh) m_visibleItems.push_back(&item);
 		}
 	}
+
+	if (m_bFrustumCulling)
+	{
+		using namespace DirectX;
+
+		m_culler.Clear();
+		for (std::uint32_t i = 0; i < m_visibleItems.size(); ++i)
+		{
+			const RenderItem* item = m_visibleItems[i];
+			m_culler.Add(i, item->Mesh->BoundsCenter, item->Mesh->BoundsExtents,
+						 m_transforms.GetWorldTransposed(item->ObjectSlot));
+		}
+
+		XMFLOAT4X4 viewProjection;
+		XMStoreFloat4x4(&viewProjection, XMMatrixMultiply(XMLoadFloat4x4(&m_view), XMLoadFloat4x4(&m_proj)));
+		m_culler.SetViewProjection(viewProjection);
+		m_culler.Cull();
+
+		//~ visible ids come back in order, compact in place
+		std::uint32_t kept = 0u;
+		for (const std::uint32_t index : m_culler.GetVisible())
+			m_visibleItems[kept++] = m_visibleItems[index];
+		m_visibleItems.resize(kept);
+	}
+}
+
+void SceneChapter7::BuildInstanceBatches()
+{
+	m_instanceBatches.clear();
+
+	const auto sameBatch = [](const RenderItem* a, const RenderItem* b)
+	{
+		return a->Mesh == b->Mesh && a->PrimitiveMode == b->PrimitiveMode;
+	};
+
+	std::ranges::sort(m_visibleItems, [](const RenderItem* a, const RenderItem* b)
+	{
+		if (a->Mesh != b->Mesh) return std::less<>{}(a->Mesh, b->Mesh);
+		return a->PrimitiveMode < b->PrimitiveMode;
+	});
+
+	for (size_t first = 0; first < m_visibleItems.size(); )
+	{
+		size_t last = first + 1u;
+		while (last < m_visibleItems.size() && sameBatch(m_visibleItems[first], m_visibleItems[last]))
+			++last;
+
+		const auto count = static_cast<std::uint32_t>(last - first);
+		const auto instances = m_uploadAllocator.Allocate(count * sizeof(DirectX::XMFLOAT4X4));
+
+		//~ the store already holds the world transposed, same layout the shader reads
+		auto* worlds = reinterpret_cast<DirectX::XMFLOAT4X4*>(instances.CPU);
+		for (std::uint32_t k = 0; k < count; ++k)
+		{
+			const auto slot = m_visibleItems[first + k]->ObjectSlot;
+			std::memcpy(&worlds[k], &m_transforms.GetWorldTransposed(slot), sizeof(DirectX::XMFLOAT4X4));
+		}
+
+		InstanceBatch batch{};
+		batch.Mesh			= m_visibleItems[first]->Mesh;
+		batch.PrimitiveMode = m_visibleItems[first]->PrimitiveMode;
+		batch.Count			= count;
+		batch.Instances		= instances.GPU;
+		m_instanceBatches.push_back(batch);
+
+		first = last;
+	}
 }
 
 void SceneChapter7::DrawRenderItems()
@@ -731,32 +877,49 @@ void SceneChapter7::DrawRenderItems()
 
 	Render.GfxCmd->SetGraphicsRootSignature(m_rootSignature.Get());
 	Render.GfxCmd->SetPipelineState(m_pipeline.GetNative());
+	Render.GfxCmd->SetGraphicsRootConstantBufferView(1u, m_passAddress);
 
-	for (auto &items: m_renderItems | std::views::values)
-	{
-		for (auto& item : items)
-		{
-			const std::uint32_t index = item.FrameIndex;
+	m_lastDrawCalls = 0u;
 
-			if (item.Visible)
-			{
-				Render.GfxCmd->SetGraphicsRootDescriptorTable(
-						0u, item.BaseCBHandle[index]);
-				const auto prim = GetTopologyType(item.PrimitiveMode);
-				Render.GfxCmd->IASetPrimitiveTopology(prim);
-				Render.GfxCmd->IASetIndexBuffer(&item.Mesh->IndexViews);
-				Render.GfxCmd->IASetVertexBuffers(0u, item.Mesh->VertexViews.size(),
-					item.Mesh->VertexViews.data());
-
-				Render.GfxCmd->DrawIndexedInstanced(
-						item.Mesh->IndexCount,
-						1u, item.Mesh->StartIndexLocation,
-						item.Mesh->BaseVertexLocation,
-						0u
-					);
-			}
+	if (m_bInstancing)
+	{
+		Render.GfxCmd->SetPipelineState(m_instancedPipeline.GetNative());
 
-			item.FrameIndex = (index + 1u) % Render.BackBufferCount;
+		for (const auto& batch : m_instanceBatches)
+		{
+			Render.GfxCmd->SetGraphicsRootShaderResourceView(2u, batch.Instances);
+			Render.GfxCmd->IASetPrimitiveTopology(GetTopologyType(batch.PrimitiveMode));
+			Render.GfxCmd->IASetIndexBuffer(&batch.Mesh->IndexViews);
+			Render.GfxCmd->IASetVertexBuffers(0u, static_cast<UINT>(batch.Mesh->VertexViews.size()),
+				batch.Mesh->VertexViews.data());
+
+			Render.GfxCmd->DrawIndexedInstanced(
+					batch.Mesh->IndexCount,
+					batch.Count, batch.Mesh->StartIndexLocation,
+					batch.Mesh->BaseVertexLocation,
+					0u
+				);
+			++m_lastDrawCalls;
 		}
+		return;
+	}
+
+	//~ same survivors as the batches, one draw each
+	for (const RenderItem* item : m_visibleItems)
+	{
+		Render.GfxCmd->SetGraphicsRootConstantBufferView(0u, item->ObjectConstants);
+		const auto prim = GetTopologyType(item->PrimitiveMode);
+		Render.GfxCmd->IASetPrimitiveTopology(prim);
+		Render.GfxCmd->IASetIndexBuffer(&item->Mesh->IndexViews);
+		Render.GfxCmd->IASetVertexBuffers(0u, static_cast<UINT>(item->Mesh->VertexViews.size()),
+			item->Mesh->VertexViews.data());
+
+		Render.GfxCmd->DrawIndexedInstanced(
+				item->Mesh->IndexCount,
+				1u, item->Mesh->StartIndexLocation,
+				item->Mesh->BaseVertexLocation,
+				0u
+			);
+		++m_lastDrawCalls;
 	}
 }
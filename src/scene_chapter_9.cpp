@@ -40,8 +40,9 @@
 #include "utility/logger.h"
 
 #include <ranges>
-#include <thread>
 #include <array>
+#include <algorithm>
+#include <cstring>
 
 #include "imgui.h"
 #include "utility/json_loader.h"
@@ -128,12 +129,23 @@ bool SceneChapter9::Initialize()
 
 void SceneChapter9::Shutdown()
 {
+	ReleaseTextures();
+
+	//~ wait for everything submitted so far, after that nothing queued can still be read
+	const UINT64 fence = Render.FenceValue;
+	THROW_DX_IF_FAILS(Render.GfxQueue->Signal(Render.Fence.Get(), fence));
+	Render.IncrementFenceValue();
+
+	if (Render.Fence->GetCompletedValue() < fence)
+	{
+		THROW_DX_IF_FAILS(Render.Fence->SetEventOnCompletion(fence, m_waitEvent));
+		WaitForSingleObject(m_waitEvent, INFINITE);
+	}
+	m_releases.Flush();
 }
 
 void SceneChapter9::FrameBegin(float deltaTime)
 {
-	m_totalTime += deltaTime;
-
 	//~ Create resources
 	CreateAllocators();
 	CreateSRVHeap	();
@@ -151,6 +163,21 @@ void SceneChapter9::FrameBegin(float deltaTime)
 		WaitForSingleObject(m_waitEvent, INFINITE);
 	}else ++m_gpuIdleCount;
 
+	//~ frames the gpu has retired give their constant space back
+	m_uploadAllocator.BeginFrame(Render.Fence->GetCompletedValue());
+	m_descriptorRing.BeginFrame(Render.Fence->GetCompletedValue());
+	m_releases.Retire(Render.Fence->GetCompletedValue());
+
+	//~ the staging heap is cpu only, the ring already holds every copy a frame in flight reads
+	if (m_bCompactStaging && m_releases.GetPendingDescriptors() == 0u)
+	{
+		m_bCompactStaging = false;
+		logger::info("Staging heap compacted, {} ranges moved", m_stagingHeap.Compact());
+	}
+	m_objectConstants.BeginFrame(fi);
+	m_materialTable.BeginFrame(fi);
+	m_commandLists.BeginFrame(fi);
+
 	if (m_lastPrinted <= 0.0f)
 	{
 		m_lastPrinted = 5.0f;
@@ -165,6 +192,11 @@ void SceneChapter9::FrameBegin(float deltaTime)
 		m_pipeline.Initialize(&Render);
 	}
 
+	if (m_riverPipeline.IsInitialized() && m_riverPipeline.IsDirty())
+	{
+		m_riverPipeline.Initialize(&Render);
+	}
+
 	auto* alloc = m_commandAllocators[fi].Get();
 	THROW_DX_IF_FAILS(alloc->Reset());
 	THROW_DX_IF_FAILS(Render.GfxCmd->Reset(alloc,
@@ -206,7 +238,7 @@ void SceneChapter9::FrameBegin(float deltaTime)
 		&rtvHandle, TRUE,
 		&dsvHandle);
 
-	UpdateRiver(deltaTime);
+	UploadRiver();
 	DrawRenderItems();
 }
 
@@ -223,8 +255,18 @@ void SceneChapter9::FrameEnd(float deltaTime)
 	Render.GfxCmd->ResourceBarrier(1u, &barrier);
 
 	THROW_DX_IF_FAILS(Render.GfxCmd->Close());
-	ID3D12CommandList* cmdLists[] = { Render.GfxCmd.Get() };
-	Render.GfxQueue->ExecuteCommandLists(1u, cmdLists);
+	if (m_recordedChunks)
+	{
+		//~ frame head back in place, then head | chunks | tail in one submit
+		m_commandLists.Swap(m_recordedChunks, Render.GfxCmd);
+		m_commandLists.Execute(Render.GfxQueue.Get(), Render.GfxCmd.Get(), m_recordedChunks + 1u);
+		m_recordedChunks = 0u;
+	}
+	else
+	{
+		ID3D12CommandList* cmdLists[] = { Render.GfxCmd.Get() };
+		Render.GfxQueue->ExecuteCommandLists(1u, cmdLists);
+	}
 
 	THROW_DX_IF_FAILS(Render.SwapChain->Present(0u, 0u));
 
@@ -232,17 +274,76 @@ void SceneChapter9::FrameEnd(float deltaTime)
 	THROW_DX_IF_FAILS(Render.GfxQueue->Signal(Render.Fence.Get(), Render.FenceValue));
 
 	m_rtProtectedFenceValue[frameIndex] = Render.FenceValue; //~ Cache last attached fence
+	m_uploadAllocator.EndFrame(Render.FenceValue);
+	m_descriptorRing.EndFrame(Render.FenceValue);
 
 	Render.IncrementFenceValue();
 	Render.IncrementFrameIndex();
 }
 
+void SceneChapter9::Simulate(const float deltaTime)
+{
+	m_simTime += deltaTime;
+
+	//~ only the uv animation state, Config is rebuilt when publishing
+	for (auto& mat : m_materials | std::views::values)
+	{
+		mat.TickUV(deltaTime);
+	}
+
+	SimulateRiver();
+}
+
+void SceneChapter9::PublishSimulation()
+{
+	m_totalTime = m_simTime;
+
+	for (auto& mat : m_materials | std::views::values)
+	{
+		mat.RebuildUVTransformIfDirty();
+	}
+
+	PublishRiver();
+
+	//~ inputs for the next simulation step
+	m_simEye = m_globalPassConstant.EyePositionW;
+
+	if (const auto* river = m_renderItems.Get(m_riverItem))
+	{
+		m_simRiverWorld = river->Transform.GetTransform();
+	}
+}
+
 void SceneChapter9::ImguiView(const float deltaTime)
 {
 	(void)deltaTime;
 
 	m_lightManager  .ImguiView();
 	m_descriptorHeap.ImguiView();
+	m_stagingHeap.ImguiView();
+	m_descriptorRing.ImguiView();
+	m_releases.ImguiView();
+	if (ImGui::Button("Reload Textures")) ReleaseTextures();
+	m_uploadAllocator.ImguiView();
+	m_objectConstants.ImguiView();
+	m_materialTable.ImguiView();
+	m_transforms.ImguiView();
+	m_renderItems.ImguiView();
+	m_drawList.ImguiView();
+	ImGui::Checkbox("Frustum Culling", &m_bFrustumCulling);
+	m_culler.ImguiView();
+	ImGui::Text("Lighting Path:");
+	for (const auto path : { ELightingPath::Global, ELightingPath::Clustered, ELightingPath::PerObject })
+	{
+		ImGui::SameLine();
+		if (ImGui::RadioButton(ToString(path).c_str(), m_lightingPath == path)) m_lightingPath = path;
+	}
+	m_lightClusters.ImguiView();
+	m_objectLights.ImguiView();
+	ImGui::Text("State Calls: %u issued, %u filtered", m_lastIssuedCalls.load(), m_lastFilteredCalls.load());
+	ImGui::Checkbox("Parallel Recording", &m_bParallelRecording);
+	m_recorder.ImguiView();
+	m_commandLists.ImguiView();
 
 	constexpr ERenderType kShapes[] =
 	{
@@ -251,6 +352,18 @@ void SceneChapter9::ImguiView(const float deltaTime)
 	};
 
 	m_riverParam.ImguiView();
+	m_riverScheduler.ImguiView();
+
+	ImGui::Checkbox("River Uses FFT Tile", &m_bRiverUseFFT);
+	if (m_bRiverUseFFT) m_ocean.ImguiView();
+
+	{
+		const std::uint32_t stride = m_bRiverSplitStream
+			? static_cast<std::uint32_t>(sizeof(MeshDynamicStreamVertex))
+			: static_cast<std::uint32_t>(sizeof(MeshVertex));
+		ImGui::Text("River Stream: %s (%u bytes / vertex / tick)",
+			m_bRiverSplitStream ? "Split" : "Full", stride);
+	}
 
 	for (ERenderType shape : kShapes)
 	{
@@ -260,12 +373,11 @@ void SceneChapter9::ImguiView(const float deltaTime)
 			m_materials[shape].ImguiView();
 		}else THROW_MSG("LOGIC ERROR MATERIAL ISN'T THERE!");
 
-		auto it = m_renderItems.find(shape);
-		if (it == m_renderItems.end() || it->second.empty())
+		std::vector<std::uint32_t> items;
+		m_renderItems.GatherByMaterial(static_cast<std::uint32_t>(shape), items);
+		if (items.empty())
 			continue;
 
-		auto& items = it->second;
-
 		const std::string header =
 			ToString(shape) + " (" + std::to_string(items.size()) + ")";
 
@@ -277,10 +389,11 @@ void SceneChapter9::ImguiView(const float deltaTime)
 
 			for (size_t i = 0; i < items.size(); ++i)
 			{
-				auto& item = items[i];
+				auto& item = m_renderItems.GetItems()[items[i]];
 
 				ImGui::PushID(static_cast<int>(i));
 				item.ImguiView();
+				m_renderItems.Refresh(items[i]);
 				ImGui::PopID();
 			}
 
@@ -368,20 +481,21 @@ void SceneChapter9::LoadData()
 		const std::string shapeKey = ToString(shape);
 		if (!loader.Contains(shapeKey)) continue;
 
-		auto it = m_renderItems.find(shape);
-		if (it == m_renderItems.end()) continue;
-
-		auto& items = it->second;
+		std::vector<std::uint32_t> items;
+		m_renderItems.GatherByMaterial(static_cast<std::uint32_t>(shape), items);
 
 		for (size_t i = 0; i < items.size(); ++i)
 		{
 			const std::string itemKey = "Item_" + std::to_string(i);
 			if (!loader[shapeKey].Contains(itemKey)) continue;
 
-			auto& item = items[i];
+			auto& item = m_renderItems.GetItems()[items[i]];
 
 			if (loader[shapeKey][itemKey].Contains("Visible"))
+			{
 				item.Visible = loader[shapeKey][itemKey]["Visible"].AsBool();
+				m_renderItems.Refresh(items[i]);
+			}
 
 			if (loader[shapeKey][itemKey].Contains("Transform"))
 			{
@@ -474,14 +588,12 @@ void SceneChapter9::SaveData() const
 	{
 		const std::string shapeKey = ToString(shape);
 
-		auto it = m_renderItems.find(shape);
-		if (it == m_renderItems.end()) continue;
-
-		const auto& items = it->second;
+		std::vector<std::uint32_t> items;
+		m_renderItems.GatherByMaterial(static_cast<std::uint32_t>(shape), items);
 
 		for (size_t i = 0; i < items.size(); ++i)
 		{
-			const auto& item = items[i];
+			const auto& item = m_renderItems.GetItems()[items[i]];
 			const std::string itemKey = "Item_" + std::to_string(i);
 
 			saver[shapeKey][itemKey]["Visible"] = item.Visible ? 1 : 0;
@@ -517,6 +629,31 @@ void SceneChapter9::CreateAllocators()
 
 		m_commandAllocators.emplace_back(std::move(alloc));
 	}
+
+	//~ every per-draw constant of every frame in flight is carved from here
+	m_uploadAllocator.Initialize(Render.Device.Get(), 16u * 1024u * 1024u);
+
+	//~ object matrices persist, only the ones that move get rewritten
+	m_objectConstants.Initialize(Render.Device.Get(), Render.BackBufferCount, 1024u);
+	m_transforms.Initialize(Render.BackBufferCount);
+
+	//~ room for a few thousand materials behind a single root srv
+	m_materialTable.Initialize(Render.Device.Get(), Render.BackBufferCount, 4096u);
+	m_transforms.SetJobSystem(Jobs);
+	m_lightClusters.SetJobSystem(Jobs);
+	m_objectLights.SetJobSystem(Jobs);
+
+	//~ one list per chunk plus the one lent out as Render.GfxCmd
+	m_commandLists.Initialize(Render.Device.Get(), Render.BackBufferCount,
+		framework::ParallelRecorder::ChunkLimit + 1u);
+	m_commandLists.SetRecorder(
+		[this](framework::CommandStateCache& cmd) { BindFrameState(cmd); },
+		[this](framework::CommandStateCache& cmd, const std::span<const framework::DrawPacket> packets)
+		{
+			RecordPackets(cmd, packets);
+			TallyStateCalls(cmd);
+		});
+	m_recorder.SetJobSystem(Jobs);
 }
 
 void SceneChapter9::CreateShaders()
@@ -540,6 +677,15 @@ void SceneChapter9::CreateShaders()
 	m_pixelShaderBlob = framework::DxRenderManager::CompileShader(
 		wPP, nullptr, "main", "ps_5_0");
 
+	const std::string riverPath = "shaders/chapter_9/river_vertex_shader.hlsl";
+	if (!helpers::IsFile(riverPath))
+	{
+		THROW_MSG("River Vertex Path is not valid!");
+	}
+
+	m_riverVertexShaderBlob = framework::DxRenderManager::CompileShader(
+		std::wstring(riverPath.begin(), riverPath.end()), nullptr, "main", "vs_5_0");
+
 	logger::success("Compiled Shader Resources!");
 }
 
@@ -555,6 +701,19 @@ void SceneChapter9::CreateSRVHeap()
 	desc.pDevice		= Render.Device.Get();
 	m_descriptorHeap.Initialize(desc);
 
+	//~ staging for views, nothing in it is ever bound directly
+	framework::InitDescriptorHeap staging{};
+	staging.Flags		   = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+	staging.Type		   = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+	staging.AllocationSize = 64u;
+	staging.pDevice		   = Render.Device.Get();
+	staging.szDebugName	   = "Staging";
+	m_stagingHeap.Initialize(staging);
+	//~ texture views can be created from any loader thread, whole tables still fit in the rest
+	m_stagingHeap.EnableConcurrentAllocation(48u, 8u);
+
+	m_descriptorRing.Initialize(Render.Device.Get(), m_descriptorHeap, 96u);
+
 	logger::success("Created Descriptor Heap Descriptor!");
 }
 
@@ -563,20 +722,6 @@ void SceneChapter9::CreateRootSignature()
 	if (m_bRootSignatureInitialized) return;
 	m_bRootSignatureInitialized = true;
 
-	D3D12_DESCRIPTOR_RANGE range{};
-	range.NumDescriptors					= 2u;
-	range.BaseShaderRegister				= 0u;
-	range.RegisterSpace						= 0u;
-	range.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
-	range.RangeType							= D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-
-	D3D12_DESCRIPTOR_RANGE psRange{};
-	psRange.NumDescriptors					    = 1u;
-	psRange.BaseShaderRegister				    = 2u;
-	psRange.RegisterSpace						= 0u;
-	psRange.OffsetInDescriptorsFromTableStart   = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
-	psRange.RangeType							= D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-
 	D3D12_DESCRIPTOR_RANGE textureRange{};
 	textureRange.NumDescriptors						= 3u;
 	textureRange.BaseShaderRegister					= 0u;
@@ -584,22 +729,31 @@ void SceneChapter9::CreateRootSignature()
 	textureRange.RegisterSpace						= 0u;
 	textureRange.RangeType							= D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
 
-	D3D12_ROOT_PARAMETER param[3]{};
-	param[0].ParameterType						 = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-	param[0].ShaderVisibility					 = D3D12_SHADER_VISIBILITY_ALL;
-	param[0].DescriptorTable.NumDescriptorRanges = 1u;
-	param[0].DescriptorTable.pDescriptorRanges	 = &range;
+	D3D12_ROOT_PARAMETER param[9]{};
+	//~ per object constants, sub allocated each frame
+	param[0].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_CBV;
+	param[0].ShaderVisibility			= D3D12_SHADER_VISIBILITY_ALL;
+	param[0].Descriptor.ShaderRegister	= 0u;
+	param[0].Descriptor.RegisterSpace	= 0u;
 
-	param[1].ParameterType						 = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-	param[1].ShaderVisibility					 = D3D12_SHADER_VISIBILITY_PIXEL;
-	param[1].DescriptorTable.NumDescriptorRanges = 1u;
-	param[1].DescriptorTable.pDescriptorRanges	 = &psRange;
+	//~ material table entry
+	param[1].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	param[1].ShaderVisibility			= D3D12_SHADER_VISIBILITY_PIXEL;
+	param[1].Constants.ShaderRegister	= 2u;
+	param[1].Constants.RegisterSpace	= 0u;
+	param[1].Constants.Num32BitValues	= 1u;
 
 	param[2].ParameterType						 = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
 	param[2].ShaderVisibility					 = D3D12_SHADER_VISIBILITY_PIXEL;
 	param[2].DescriptorTable.NumDescriptorRanges = 1u;
 	param[2].DescriptorTable.pDescriptorRanges	 = &textureRange;
 
+	//~ river shading block for the split stream river
+	param[3].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_CBV;
+	param[3].ShaderVisibility			= D3D12_SHADER_VISIBILITY_VERTEX;
+	param[3].Descriptor.ShaderRegister	= 3u;
+	param[3].Descriptor.RegisterSpace	= 0u;
+
 	//~ static samplers of all types
 	const std::array<D3D12_STATIC_SAMPLER_DESC, 5> samplers =
 	{
@@ -610,9 +764,30 @@ void SceneChapter9::CreateRootSignature()
 		StaticSampler_EnvMap(4),
 	};
 
+	//~ pass constants, one shared block per frame
+	param[4].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_CBV;
+	param[4].ShaderVisibility			= D3D12_SHADER_VISIBILITY_ALL;
+	param[4].Descriptor.ShaderRegister	= 1u;
+	param[4].Descriptor.RegisterSpace	= 0u;
+
+	//~ material table, the whole frame region as one structured buffer
+	param[5].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_SRV;
+	param[5].ShaderVisibility			= D3D12_SHADER_VISIBILITY_PIXEL;
+	param[5].Descriptor.ShaderRegister	= 0u;
+	param[5].Descriptor.RegisterSpace	= 1u;
+
+	//~ clustered lights, cluster ranges and the light index list
+	for (UINT i = 0; i < 3u; ++i)
+	{
+		param[6u + i].ParameterType				= D3D12_ROOT_PARAMETER_TYPE_SRV;
+		param[6u + i].ShaderVisibility			= D3D12_SHADER_VISIBILITY_PIXEL;
+		param[6u + i].Descriptor.ShaderRegister	= 1u + i;
+		param[6u + i].Descriptor.RegisterSpace	= 1u;
+	}
+
 	D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc{};
 	rootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-	rootSignatureDesc.NumParameters		= 3u;
+	rootSignatureDesc.NumParameters		= 9u;
 	rootSignatureDesc.pParameters	    = param;
 	rootSignatureDesc.NumStaticSamplers = static_cast<UINT>(samplers.size());
 	rootSignatureDesc.pStaticSamplers	= samplers.data();
@@ -655,6 +830,26 @@ void SceneChapter9::CreatePipeline()
 	m_pipeline.SetCullMode(ECullMode::None);
 
 	m_pipeline.Initialize(&Render);
+
+	//~ same state, split stream input
+	m_riverPipeline.SetRootSignature(m_rootSignature.Get());
+
+	m_riverPipeline.SetVertexShader(D3D12_SHADER_BYTECODE{
+		m_riverVertexShaderBlob->GetBufferPointer(),
+		m_riverVertexShaderBlob->GetBufferSize()
+	});
+
+	m_riverPipeline.SetPixelShader(D3D12_SHADER_BYTECODE{
+		m_pixelShaderBlob->GetBufferPointer(),
+		m_pixelShaderBlob->GetBufferSize()
+	});
+
+	m_riverPipeline.SetInputLayout(MeshDynamicStreamVertex::GetSplitInputLayout());
+
+	m_riverPipeline.SetFillMode(EFillMode::Solid);
+	m_riverPipeline.SetCullMode(ECullMode::None);
+
+	m_riverPipeline.Initialize(&Render);
 }
 
 void SceneChapter9::CreateGeometry()
@@ -674,14 +869,40 @@ void SceneChapter9::CreateGeometry()
 
 		m_riverBase  = MeshGenerator::GenerateGrid(cfg);
 		m_riverFrame = m_riverBase;
+		m_riverColumns = cfg.SubdivisionsX + 1u;
+
+		framework::DynamicMeshSchedulerConfig schedule{};
+		schedule.RowCount = cfg.SubdivisionsZ + 1u;
+		m_riverScheduler.Initialize(schedule);
+		m_riverScheduler.SetJobSystem(Jobs);
+
+		framework::OceanFFTConfig ocean{};
+		ocean.Size		  = 64u;
+		ocean.PatchLength = 16.0f;
+		m_ocean.SetJobSystem(Jobs);
+		m_ocean.Initialize(ocean);
 
 		m_geometries[ERenderType::River] = MeshGeometry{};
-		m_geometries[ERenderType::River].InitGeometryBuffer(
-			Render.Device.Get(),
-			Render.GfxCmd.Get(),
-			m_riverBase,
-			true
-		);
+		if (m_bRiverSplitStream)
+		{
+			m_geometries[ERenderType::River].InitSplitStreamBuffer(
+				Render.Device.Get(),
+				Render.GfxCmd.Get(),
+				m_riverBase
+			);
+		}
+		else
+		{
+			m_geometries[ERenderType::River].InitGeometryBuffer(
+				Render.Device.Get(),
+				Render.GfxCmd.Get(),
+				m_riverBase,
+				true
+			);
+		}
+		//~ heights move every tick, leave the waves room inside the culling box
+		const float margin = m_riverParam.halfWidth;
+		m_geometries[ERenderType::River].InflateBounds({ margin, margin, margin });
 	}
 	// mountain
 	{
@@ -699,9 +920,14 @@ void SceneChapter9::CreateGeometry()
 			Render.GfxCmd.Get(),
 			data, false);
 
-		if (!m_renderItems[ERenderType::Mountain].empty())
-			m_renderItems[ERenderType::Mountain][0].Mesh = &m_geometries[ERenderType::Mountain];
+		if (auto* mountain = m_renderItems.Get(m_mountainItem))
+			mountain->Mesh = &m_geometries[ERenderType::Mountain];
 	}
+
+	//~ map nodes keep their address, the table survives geometry rebuilds
+	m_meshTable.assign(2u, nullptr);
+	m_meshTable[static_cast<std::uint32_t>(ERenderType::River)]	   = &m_geometries[ERenderType::River];
+	m_meshTable[static_cast<std::uint32_t>(ERenderType::Mountain)] = &m_geometries[ERenderType::Mountain];
 }
 
 void SceneChapter9::CreateRenderItems()
@@ -712,21 +938,15 @@ void SceneChapter9::CreateRenderItems()
 	{
 		RenderItem item{};
 		item.Mesh = &m_geometries[ERenderType::River];
-		item.InitConstantBuffer(
-			framework::DxRenderManager::BackBufferCount,
-			Render.Device.Get(),
-			m_descriptorHeap);
-		m_renderItems[ERenderType::River].emplace_back(std::move(item));
+		const auto id = static_cast<std::uint32_t>(ERenderType::River);
+		m_riverItem = m_renderItems.Add(std::move(item), id, id);
 	}
 
 	{
 		RenderItem item{};
 		item.Mesh = &m_geometries[ERenderType::Mountain];
-		item.InitConstantBuffer(
-			framework::DxRenderManager::BackBufferCount,
-			Render.Device.Get(),
-			m_descriptorHeap);
-		m_renderItems[ERenderType::Mountain].emplace_back(std::move(item));
+		const auto id = static_cast<std::uint32_t>(ERenderType::Mountain);
+		m_mountainItem = m_renderItems.Add(std::move(item), id, id);
 	}
 
 	LoadData();
@@ -741,21 +961,17 @@ void SceneChapter9::CreateMaterials()
 	//~ grass
 	auto& grass = m_materials[ERenderType::Mountain];
 	grass.Name			 = "grass";
-	grass.FrameCount = framework::DxRenderManager::BackBufferCount;
-
-	grass.InitPixelConstantBuffer(framework::DxRenderManager::BackBufferCount,
-		Render.Device.Get(),
-		m_descriptorHeap);
 
 	auto& water = m_materials[ERenderType::River];
 	water.Name = "water";
 	water.Config.DiffuseAlbedo = { 0.0f, 0.2f, 0.6f, 1.0f };
 	water.Config.Roughness = 0.f;
-	water.FrameCount = framework::DxRenderManager::BackBufferCount;
 
-	water.InitPixelConstantBuffer(framework::DxRenderManager::BackBufferCount,
-		Render.Device.Get(),
-		m_descriptorHeap);
+	m_materialSlots.assign(2u, framework::MaterialTable::InvalidIndex);
+	for (auto& [type, material] : m_materials)
+	{
+		m_materialSlots[static_cast<std::uint32_t>(type)] = m_materialTable.Add(material);
+	}
 }
 
 void SceneChapter9::CreateTextures()
@@ -768,14 +984,26 @@ void SceneChapter9::CreateTextures()
 	mountain.TexturePaths[ETextureType::Albedo] = L"assets/textures/mountain/diffuse.dds";
 	mountain.TexturePaths[ETextureType::Normal] = L"assets/textures/mountain/normal.dds";
 	mountain.TexturePaths[ETextureType::ARM]    = L"assets/textures/mountain/arm.dds";
-	mountain.Init(Render.Device.Get(), Render.GfxQueue.Get(), m_descriptorHeap);
+	mountain.Init(Render.Device.Get(), Render.GfxQueue.Get(), m_stagingHeap);
 
 	auto& water = m_textures[ERenderType::River];
 	water.Name = "water";
 	water.TexturePaths[ETextureType::Albedo] = L"assets/textures/water/diffuse.dds";
 	water.TexturePaths[ETextureType::Normal] = L"assets/textures/water/normal.dds";
 	water.TexturePaths[ETextureType::ARM]    = L"assets/textures/water/arm.dds";
-	water.Init(Render.Device.Get(), Render.GfxQueue.Get(), m_descriptorHeap);
+	water.Init(Render.Device.Get(), Render.GfxQueue.Get(), m_stagingHeap);
+}
+
+void SceneChapter9::ReleaseTextures()
+{
+	//~ the frame being recorded may still sample them, CreateTextures loads them again next frame
+	for (auto& texture : m_textures | std::views::values)
+	{
+		texture.Release(Render.FenceValue, m_stagingHeap, m_releases);
+	}
+	m_textureTables.clear();
+	m_bTexturesInitialized = false;
+	m_bCompactStaging	   = true;
 }
 
 void SceneChapter9::UpdateConstantBuffer(const float deltaTime)
@@ -784,280 +1012,378 @@ void SceneChapter9::UpdateConstantBuffer(const float deltaTime)
 	m_globalPassConstant.TotalTime = m_totalTime;
 
 	m_lightManager.FillPassConstants(m_globalPassConstant);
+	AssignLightClusters();
 
-	for (auto &vec: m_renderItems | std::views::values)
+	//~ newcomers join the transform store, their constant slot follows the store index
+	const auto& worlds = m_renderItems.GetWorldIndices();
+	for (std::uint32_t i = 0; i < m_renderItems.GetCount(); ++i)
 	{
-		for (auto& renderItem : vec)
-		{
-			const auto index = renderItem.FrameIndex;
-			PerObjectConstantsCPU per{};
-			const auto world = renderItem.Transform.GetTransform();
-
-			DirectX::XMStoreFloat4x4(
-				&per.World,
-				DirectX::XMMatrixTranspose(
-					DirectX::XMLoadFloat4x4(&world)
-				)
-			);
+		if (worlds[i] != framework::ObjectConstantTable::InvalidSlot) continue;
 
-			BYTE* dst = renderItem.PerObject.Mapped[index];
-			std::memcpy(dst, &per, sizeof(per));
-
-			dst = renderItem.PassConstant.Mapped[index];
-			std::memcpy(dst, &m_globalPassConstant, sizeof(m_globalPassConstant));
-		}
+		auto& renderItem = m_renderItems.GetItems()[i];
+		m_renderItems.SetWorldIndex(i, m_transforms.Add());
+		renderItem.Transform.BindStore(&m_transforms, renderItem.ObjectSlot);
 	}
 
-	//~ update material constant buffer
-	for (auto& [name, mat] : m_materials)
-	{
-		mat.TickUV(deltaTime);
-		mat.RebuildUVTransformIfDirty();
-		const auto index = mat.FrameIndex;
-		BYTE* dst				= mat.PixelConstantMap.Mapped[index];
-		std::memcpy(dst, &mat.Config, sizeof(mat.Config));
-	}
+	//~ only moved objects are rebuilt, only stale frame copies are written
+	m_transforms.Flush(
+		m_objectConstants.GetFrameData(m_transforms.GetCount()),
+		framework::ObjectConstantTable::SlotSize);
+
+	//~ once per frame, every draw binds the same block
+	m_passAddress = m_uploadAllocator.Push(m_globalPassConstant).GPU;
+
+	//~ river shading block
+	m_riverShadingAddress = m_uploadAllocator.Push(m_riverParam.GetShadingConstants()).GPU;
+
+	//~ only materials whose config changed are written again
+	m_materialTable.Flush();
 }
 
-void SceneChapter9::DrawRenderItems()
+void SceneChapter9::AssignLightClusters()
 {
-	ID3D12DescriptorHeap* heaps[] = { m_descriptorHeap.GetNative() };
-	Render.GfxCmd->SetDescriptorHeaps(_countof(heaps), heaps);
+	auto& pass = m_globalPassConstant;
 
-	Render.GfxCmd->SetGraphicsRootSignature(m_rootSignature.Get());
-	Render.GfxCmd->SetPipelineState(m_pipeline.GetNative());
+	//~ the grid and the object lists only hand out ids, the shader reads the lights themselves in the same order
+	const std::uint32_t pointCount = m_lightManager.GatherLocal(m_localLights);
+	m_objectLights.SetLights(m_localLights, pointCount);
 
-	for (auto &[type, items]: m_renderItems)
+	m_lightClusters.Clear();
+	if (m_lightingPath == ELightingPath::Clustered)
 	{
-		for (auto& item : items)
-		{
-			const std::uint32_t index = item.FrameIndex;
+		m_lightClusters.SetView(m_view, m_proj, pass.NearZ, pass.FarZ);
+		m_lightClusters.Reserve(static_cast<std::uint32_t>(m_localLights.size()));
 
-			if (item.Visible)
-			{
-				//~ constant buffer vertex
-				Render.GfxCmd->SetGraphicsRootDescriptorTable(
-						0u, item.BaseCBHandle[index]);
-
-				//~ constant buffer pixel
-				//~ set material based on type
-				const auto matGpuHandle = m_materials[type].PixelConstantMap.GPUHandle[index];
-				Render.GfxCmd->SetGraphicsRootDescriptorTable(1u, matGpuHandle);
-
-				//~ texture
-				const auto& texHandle = m_textures[type].baseGpuHandle;
-				Render.GfxCmd->SetGraphicsRootDescriptorTable(2u, texHandle);
-
-				const auto prim = GetTopologyType(item.PrimitiveMode);
-				Render.GfxCmd->IASetPrimitiveTopology(prim);
-				Render.GfxCmd->IASetIndexBuffer(&item.Mesh->IndexViews);
-				Render.GfxCmd->IASetVertexBuffers(0u, item.Mesh->VertexViews.size(),
-					item.Mesh->VertexViews.data());
-
-				Render.GfxCmd->DrawIndexedInstanced(
-						item.Mesh->IndexCount,
-						1u, item.Mesh->StartIndexLocation,
-						item.Mesh->BaseVertexLocation,
-						0u
-					);
-				m_materials[type].FrameIndex = (index + 1u) % framework::DxRenderManager::BackBufferCount;
-				item.FrameIndex				 = (index + 1u) % framework::DxRenderManager::BackBufferCount;
-			}
+		for (std::uint32_t i = 0; i < m_localLights.size(); ++i)
+		{
+			const auto& light = m_localLights[i];
+			if (i < pointCount) m_lightClusters.AddPoint(light.Position, light.FalloffEnd);
+			else				m_lightClusters.AddSpot (light.Position, light.Direction, light.FalloffEnd, light.SpotPower);
 		}
+
+		m_lightClusters.Assign();
 	}
+
+	pass.ClusterCountX		= m_lightClusters.GetCountX();
+	pass.ClusterCountY		= m_lightClusters.GetCountY();
+	pass.ClusterCountZ		= m_lightClusters.GetCountZ();
+	pass.LocalPointLights	= pointCount;
+	pass.ClusterDepthScale	= m_lightClusters.GetDepthScale();
+	pass.ClusterDepthBias	= m_lightClusters.GetDepthBias();
+	pass.LightingPath		= m_lightingPath;
+
+	//~ root srvs need a live address even when there is nothing to read
+	const auto upload = [&](const std::size_t bytes)
+	{
+		return m_uploadAllocator.Allocate(static_cast<std::uint32_t>(std::max<std::size_t>(bytes, 16u)), 16u);
+	};
+
+	const auto& ranges	= m_lightClusters.GetRanges();
+	const auto& indices = m_lightClusters.GetIndices();
+	const bool bClustered = m_lightingPath == ELightingPath::Clustered;
+	const bool bLocal	  = m_lightingPath != ELightingPath::Global;
+	const std::size_t lightBytes = bLocal	  ? m_localLights.size() * sizeof(LightCPU)				  : 0u;
+	const std::size_t rangeBytes = bClustered ? ranges.size()		 * sizeof(framework::ClusterRange) : 0u;
+	const std::size_t indexBytes = bClustered ? indices.size()		 * sizeof(std::uint32_t)			 : 0u;
+
+	const auto lights	 = upload(lightBytes);
+	const auto rangeData = upload(rangeBytes);
+	const auto indexData = upload(indexBytes);
+	if (lightBytes) std::memcpy(lights.CPU,	   m_localLights.data(), lightBytes);
+	if (rangeBytes) std::memcpy(rangeData.CPU, ranges.data(),		 rangeBytes);
+	if (indexBytes) std::memcpy(indexData.CPU, indices.data(),		 indexBytes);
+
+	m_localLightsAddress	= lights.GPU;
+	m_clusterRangesAddress	= rangeData.GPU;
+	m_clusterIndicesAddress = indexData.GPU;
 }
 
-void SceneChapter9::UpdateRiver(const float deltaTime)
+void SceneChapter9::BuildDrawList()
 {
-	constexpr float kHz		   = 24.0f;
-	constexpr float kStep	   = 1.0f / kHz;
-	constexpr int   kMaxCatchUp = 2;
+	using namespace DirectX;
 
-	m_riverUpdateAccum += deltaTime;
+	m_drawList.Clear();
+	m_drawItems.clear();
 
-	if (m_riverUpdateAccum < kStep)
-		return;
+	const XMVECTOR eye = XMLoadFloat3(&m_globalPassConstant.EyePositionW);
 
-	int steps = 0;
-	while (m_riverUpdateAccum >= kStep && steps < kMaxCatchUp)
+	//~ hot arrays only, the cold items are not touched here
+	const auto& meshIds = m_renderItems.GetMeshIds();
+	const auto& worlds	= m_renderItems.GetWorldIndices();
+	const auto& flags	= m_renderItems.GetFlags();
+
+	m_culler.Clear();
+	m_objectLights.ClearObjects();
+	m_objectLightSlots.clear();
+	for (std::uint32_t i = 0; i < m_renderItems.GetCount(); ++i)
 	{
-		m_riverUpdateAccum -= kStep;
-		++steps;
+		const MeshGeometry* mesh = meshIds[i] < m_meshTable.size() ? m_meshTable[meshIds[i]] : nullptr;
+		if (!(flags[i] & framework::RenderItemFlags::Visible) || !mesh) continue;
+
+		m_culler.Add(static_cast<std::uint32_t>(m_drawItems.size()),
+					 mesh->BoundsCenter,
+					 mesh->BoundsExtents,
+					 m_transforms.GetWorldTransposed(worlds[i]));
+		m_drawItems.push_back(i);
 	}
 
-	const float t = m_totalTime;
-
-	auto& rivers = m_renderItems[ERenderType::River];
-	if (rivers.empty() || m_riverBase.vertices.empty())
-		return;
-
-	const auto& p = m_riverParam;
+	if (m_bFrustumCulling)
+	{
+		XMFLOAT4X4 viewProjection;
+		XMStoreFloat4x4(&viewProjection, XMMatrixMultiply(XMLoadFloat4x4(&m_view), XMLoadFloat4x4(&m_proj)));
+		m_culler.SetViewProjection(viewProjection);
+		m_culler.Cull();
+	}
 
-	for (auto& river : rivers)
+	const auto emit = [&](const std::uint32_t index)
 	{
-		if (!river.Visible || !river.Mesh)
-			continue;
+		const std::uint32_t item = m_drawItems[index];
 
-		auto* geo = river.Mesh;
-		if (!geo->Mapped)
-			continue;
+		//~ translation sits in the last column of the transposed world
+		const auto& world = m_transforms.GetWorldTransposed(worlds[item]);
+		const XMVECTOR position = XMVectorSet(world._14, world._24, world._34, 1.0f);
+		const float distance = XMVectorGetX(XMVector3Length(XMVectorSubtract(position, eye)));
 
-		geo->Data = m_riverBase;
+		const std::uint32_t material = m_renderItems.GetMaterialIds()[item];
+		const std::uint32_t mesh	 = meshIds[item];
+		const std::uint64_t key = framework::DrawKey::Make(
+			0u, m_meshTable[mesh]->bSplitStream ? 1u : 0u, material, mesh,
+			framework::DrawKey::QuantizeDepth(distance, m_globalPassConstant.FarZ));
 
-		const size_t count = geo->Data.vertices.size();
-		if (count == 0)
-			continue;
+		m_drawList.Add(key, index);
 
-		uint32_t tc = std::thread::hardware_concurrency();
-		if (tc == 0) tc = 4;
-		tc = std::min<uint32_t>(tc, 8);
-		if (count < 4096) tc = 1;
+		if (m_lightingPath == ELightingPath::PerObject)
+		{
+			XMFLOAT3 center, extents;
+			m_culler.GetWorldBounds(index, center, extents);
+			m_objectLights.AddObject(center, extents);
+			m_objectLightSlots.push_back(worlds[item]);
+		}
+	};
 
-		const size_t chunk = (count + tc - 1) / tc;
+	if (m_bFrustumCulling)
+	{
+		for (const std::uint32_t index : m_culler.GetVisible()) emit(index);
+	}
+	else
+	{
+		for (std::uint32_t index = 0u; index < m_culler.GetCount(); ++index) emit(index);
+	}
 
-		auto worker = [&](size_t begin, size_t end)
+	//~ only drawn objects get a list, hidden ones keep whatever their slot had
+	if (m_lightingPath == ELightingPath::PerObject)
+	{
+		m_objectLights.Build();
+		for (std::uint32_t i = 0; i < m_objectLightSlots.size(); ++i)
 		{
-			for (size_t i = begin; i < end; ++i)
-			{
-				auto& v = geo->Data.vertices[i];
-				const auto& b = m_riverBase.vertices[i];
+			m_objectConstants.Write<sizeof(PerObjectConstantsCPU)>(m_objectLightSlots[i], m_objectLights.Get(i));
+		}
+	}
 
-				const float x = b.Position.x;
-				const float z = b.Position.z;
+	m_drawList.Sort();
+}
 
-				float bank = 1.0f;
-				if (p.halfWidth > 0.0001f)
-				{
-					const float ax = std::abs(x);
-					bank = 1.0f - (ax / p.halfWidth);
-					bank = (bank < 0.0f) ? 0.0f : bank;
-					bank *= bank;
-				}
+void SceneChapter9::BuildTextureTables()
+{
+	//~ once per frame before recording, every draw of a material binds the same copy.
+	//~ views are looked up through their handles since the staging heap may have been compacted
+	for (auto& [type, texture] : m_textures)
+	{
+		if (!texture.IsValid()) continue;
+		m_textureTables[type] = m_descriptorRing.CopyTable(
+			m_stagingHeap.GetCPUHandle(texture.heapHandle), static_cast<std::uint32_t>(texture.Resources.size()));
+	}
+}
 
-				float mask = bank;
-				if (p.edgeNoiseStrength > 0.0f)
-				{
-					const float edge = 1.0f - bank;
-					mask = bank + edge * p.edgeNoiseStrength;
-				}
+void SceneChapter9::DrawRenderItems()
+{
+	BuildTextureTables();
+	BuildDrawList();
 
-				float height = 0.0f;
+	const std::span<const framework::DrawPacket> packets = m_drawList.GetPackets();
+	m_lastIssuedCalls	= 0u;
+	m_lastFilteredCalls = 0u;
+	m_recordedChunks	= 0u;
 
-				{
-					const float w1 = std::sinf((z * p.waveLen1) + (t * p.freq1) + (x * 0.15f));
-					const float w2 = std::sinf((z * p.waveLen2) - (t * p.freq2) + (x * 0.40f));
-					const float flow = std::sinf((z * 0.55f) + (t * p.flowSpeed));
-					height += (p.amp1 * w1 + p.amp2 * w2) * bank + (0.015f * flow * bank);
-				}
+	if (!m_bParallelRecording || !m_commandLists.IsInitialized())
+	{
+		framework::CommandStateCache cmd{ Render.GfxCmd.Get() };
+		BindFrameState(cmd);
+		RecordPackets(cmd, packets);
+		TallyStateCalls(cmd);
+		return;
+	}
 
-				{
-					float a  = p.octaveBaseAmp;
-					float f  = p.octaveBaseFreq;
-					float wl = p.octaveBaseWaveLen;
-
-					for (int o = 0; o < p.octaves; ++o)
-					{
-						const float phase = float(o) * 13.37f;
-						const float r1 = std::sinf((z * wl * f) + (t * f) + (x * 0.31f) + phase);
-						const float r2 = std::sinf((x * wl * 0.75f * f) - (t * 1.35f * f) + (z * 0.17f) + phase * 0.7f);
-						height += (r1 * 0.65f + r2 * 0.35f) * a * mask;
-
-						a *= 0.55f;
-						f *= 1.85f;
-						wl *= 1.15f;
-					}
-				}
+	m_recordedChunks = m_recorder.Record(packets, [this](const std::uint32_t chunk) -> framework::ICommandEncoder&
+	{
+		return m_commandLists.GetEncoder(chunk);
+	});
 
-				height = (height * p.heightScale) + p.heightBias;
-				height = std::clamp(height, -p.maxHeight, p.maxHeight);
+	//~ close the frame head and lend the next pool list out as Render.GfxCmd,
+	//~ whatever gets recorded after the scene lands behind the chunks
+	THROW_DX_IF_FAILS(Render.GfxCmd->Close());
+	m_commandLists.Open(m_recordedChunks);
+	m_commandLists.Swap(m_recordedChunks, Render.GfxCmd);
 
-				v.Position.y = b.Position.y + height;
-				v.Position.x = b.Position.x + (0.01f * bank * std::sinf((z * 0.6f) + t * 1.2f));
+	framework::CommandStateCache tail{ Render.GfxCmd.Get() };
+	BindFrameState(tail);
+}
 
-				const float x01 = (p.halfWidth > 0.0001f)
-					? std::clamp((x / (p.halfWidth * 2.0f)) + 0.5f, 0.0f, 1.0f)
-					: 0.5f;
+void SceneChapter9::BindFrameState(framework::CommandStateCache& cmd) const
+{
+	const auto rtvHandle = Render.GetBackBufferHandle(Render.FrameIndex);
+	const auto dsvHandle = Render.GetDSVBaseHandle();
 
-				const float zDen = (p.maxZ - p.minZ);
-				const float z01 = (std::abs(zDen) > 0.0001f)
-					? std::clamp((z - p.minZ) / zDen, 0.0f, 1.0f)
-					: 0.5f;
+	cmd.GetNative()->RSSetViewports(1u, &Render.Viewport);
+	cmd.GetNative()->RSSetScissorRects(1u, &Render.ScissorRect);
+	cmd.GetNative()->OMSetRenderTargets(1u, &rtvHandle, TRUE, &dsvHandle);
 
-				const auto top  = Lerp(p.leftColor,     p.rightColor,     x01);
-				const auto bot  = Lerp(p.downLeftColor, p.downRightColor, x01);
-				const auto quad = Lerp(bot, top, z01);
+	ID3D12DescriptorHeap* heaps[] = { m_descriptorHeap.GetNative() };
+	cmd.SetDescriptorHeaps(_countof(heaps), heaps);
+	cmd.SetGraphicsRootSignature(m_rootSignature.Get());
+	cmd.SetPipelineState(m_pipeline.GetNative());
+	cmd.SetGraphicsRootConstantBufferView(4u, m_passAddress);
+	cmd.SetGraphicsRootShaderResourceView(5u, m_materialTable.GetAddress());
+	cmd.SetGraphicsRootShaderResourceView(6u, m_localLightsAddress);
+	cmd.SetGraphicsRootShaderResourceView(7u, m_clusterRangesAddress);
+	cmd.SetGraphicsRootShaderResourceView(8u, m_clusterIndicesAddress);
+
+	cmd.SetGraphicsRootConstantBufferView(3u, m_riverShadingAddress);
+}
+
+void SceneChapter9::RecordPackets(
+	framework::CommandStateCache& cmd,
+	const std::span<const framework::DrawPacket> packets) const
+{
+	const auto& meshIds		= m_renderItems.GetMeshIds();
+	const auto& materialIds = m_renderItems.GetMaterialIds();
+	const auto& worlds		= m_renderItems.GetWorldIndices();
+	const auto& flags		= m_renderItems.GetFlags();
+
+	//~ packets come sorted, the cache drops whatever repeats the previous draw
+	for (const auto& packet : packets)
+	{
+		const std::uint32_t item = m_drawItems[packet.Item];
+		const MeshGeometry* mesh = m_meshTable[meshIds[item]];
+		const auto			type = static_cast<ERenderType>(materialIds[item]);
+
+		cmd.SetPipelineState(mesh->bSplitStream ? m_riverPipeline.GetNative() : m_pipeline.GetNative());
+		cmd.SetGraphicsRootConstantBufferView(0u, m_objectConstants.GetAddress(worlds[item]));
+		cmd.SetGraphicsRoot32BitConstant(1u, m_materialSlots[materialIds[item]], 0u);
+		cmd.SetGraphicsRootDescriptorTable(2u, m_textureTables.at(type));
+		cmd.IASetPrimitiveTopology(GetTopologyType(framework::RenderItemFlags::GetPrimitiveMode(flags[item])));
+		cmd.IASetIndexBuffer(&mesh->IndexViews);
+		cmd.IASetVertexBuffers(0u, static_cast<UINT>(mesh->VertexViews.size()),
+			mesh->VertexViews.data());
+
+		cmd.DrawIndexedInstanced(
+				mesh->IndexCount,
+				1u, mesh->StartIndexLocation,
+				mesh->BaseVertexLocation,
+				0u
+			);
+	}
+}
 
-				const float denom = (p.maxHeight > 0.0001f) ? p.maxHeight : 0.0001f;
-				float h01 = height / denom;
-				h01 = std::clamp(h01 * 0.5f + 0.5f, 0.0f, 1.0f);
+void SceneChapter9::TallyStateCalls(const framework::CommandStateCache& cmd)
+{
+	m_lastIssuedCalls  .fetch_add(cmd.GetIssued(),	 std::memory_order_relaxed);
+	m_lastFilteredCalls.fetch_add(cmd.GetFiltered(), std::memory_order_relaxed);
+}
 
-				const auto depthTint = Lerp(p.deepColor, p.shallowColor, h01);
+void SceneChapter9::SimulateRiver()
+{
+	if (m_riverBase.vertices.empty() || !m_riverScheduler.IsInitialized())
+		return;
 
-				float crest = (height - p.foamHeightThreshold) / (p.maxHeight - p.foamHeightThreshold + 0.0001f);
-				crest = std::clamp(crest, 0.0f, 1.0f);
-				float foam = std::clamp((crest * crest) * p.foamStrength, 0.0f, 1.0f);
+	//~ handle lookup only reads the slot table, safe next to the recorder
+	if (!m_renderItems.IsAlive(m_riverItem))
+		return;
 
-				const auto foamed = Lerp(depthTint, p.foamColor, foam);
+	const float t = m_simTime;
+	const auto& p = m_riverParam;
 
-				const float shimmer = p.shimmerStrength * std::sinf((z * 0.8f) + t * p.flowSpeed) * mask;
-				const DirectX::XMFLOAT3 shimmer3{ shimmer, shimmer, shimmer };
+	const std::uint32_t columns = m_riverColumns;
+	const std::uint32_t rows	= m_riverScheduler.GetRowCount();
+	const bool split			= m_bRiverSplitStream;
 
-				v.Color = Clamp01(Add3(Mul3(quad, foamed), shimmer3));
-			}
-		};
+	//~ one tile per tick, every river row samples it with wrap around
+	const framework::OceanFFT* ocean = nullptr;
+	if (m_bRiverUseFFT && m_ocean.IsInitialized())
+	{
+		m_ocean.Update(t);
+		ocean = &m_ocean;
+	}
 
-		if (tc == 1)
+	//~ row priority by camera distance of the row center
+	{
+		using namespace DirectX;
+		const XMMATRIX W   = XMLoadFloat4x4(&m_simRiverWorld);
+		const XMVECTOR eye = XMLoadFloat3(&m_simEye);
+
+		m_riverRowDistances.resize(rows);
+		for (std::uint32_t row = 0; row < rows; ++row)
 		{
-			worker(0, count);
+			const auto& b = m_riverBase.vertices[static_cast<size_t>(row) * columns];
+			const XMVECTOR center = XMVector3TransformCoord(XMVectorSet(0.f, b.Position.y, b.Position.z, 1.f), W);
+			m_riverRowDistances[row] = XMVectorGetX(XMVector3Length(XMVectorSubtract(center, eye)));
 		}
-		else
-		{
-			std::vector<std::jthread> threads;
-			threads.reserve(tc);
+	}
 
-			for (uint32_t ti = 0; ti < tc; ++ti)
+	auto& frame = m_riverFrame.vertices;
+	m_riverScheduler.Update(m_riverRowDistances, [&](const std::uint32_t row)
+	{
+		const size_t begin = static_cast<size_t>(row) * columns;
+		for (size_t i = begin; i < begin + columns; ++i)
+		{
+			const auto& b = m_riverBase.vertices[i];
+			if (split)
 			{
-				const size_t begin = size_t(ti) * chunk;
-				const size_t end   = std::min(begin + chunk, count);
-				if (begin >= end) break;
-
-				threads.emplace_back([&, begin, end]()
-				{
-					worker(begin, end);
-				});
+				//~ colour and sway are rebuilt in the river vertex shader
+				frame[i].Position.y = b.Position.y +
+					EvaluateRiverHeight(p, b.Position.x, b.Position.z, t, ocean);
 			}
+			else EvaluateRiverVertex(p, b, frame[i], t, ocean);
 		}
+	});
 
-		MeshGenerator::ComputeNormals(geo->Data);
-		for (auto& v : geo->Data.vertices)
-		{
-			v.Normal.x = -v.Normal.x;
-			v.Normal.y = -v.Normal.y;
-			v.Normal.z = -v.Normal.z;
-		}
+	//~ normals read the neighbour rows too
+	for (const std::uint32_t row : m_riverScheduler.GetUpdatedRows())
+	{
+		const std::uint32_t first = row > 0u ? row - 1u : 0u;
+		const std::uint32_t last  = std::min(row + 1u, rows - 1u);
+		MeshGenerator::ComputeGridNormals(m_riverFrame, columns, first, last - first + 1u);
+		m_riverScheduler.MarkDirty(first, last - first + 1u);
+	}
+
+	m_riverScheduler.CollectDirtyRanges(m_riverSimulatedRanges);
+}
+
+void SceneChapter9::PublishRiver()
+{
+	const auto geoIt = m_geometries.find(ERenderType::River);
+	if (geoIt == m_geometries.end() || m_riverSimulatedRanges.empty())
+		return;
 
-		const auto vbSize = static_cast<uint32_t>(sizeof(MeshVertex) * geo->Data.vertices.size());
-		std::memcpy(geo->Mapped, geo->Data.vertices.data(), vbSize);
-
-		auto* cmdList = Render.GfxCmd.Get();
-
-		D3D12_RESOURCE_BARRIER br{};
-		br.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-		br.Transition.pResource   = geo->GeometryBuffer.Get();
-		br.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-		br.Transition.StateBefore = D3D12_RESOURCE_STATE_GENERIC_READ;
-		br.Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_DEST;
-		cmdList->ResourceBarrier(1, &br);
-
-		cmdList->CopyBufferRegion(
-			geo->GeometryBuffer.Get(),
-			0,
-			geo->GeometryUploader.Get(),
-			0,
-			vbSize);
-
-		std::swap(br.Transition.StateBefore, br.Transition.StateAfter);
-		br.Transition.StateAfter = D3D12_RESOURCE_STATE_GENERIC_READ;
-		cmdList->ResourceBarrier(1, &br);
+	//~ only the refreshed rows travel from the simulation copy to the recorder copy
+	auto& dst = geoIt->second.Data.vertices;
+	const auto& src = m_riverFrame.vertices;
+	for (const auto& range : m_riverSimulatedRanges)
+	{
+		const size_t first = static_cast<size_t>(range.FirstRow) * m_riverColumns;
+		const size_t count = static_cast<size_t>(range.RowCount) * m_riverColumns;
+		std::copy_n(src.begin() + first, count, dst.begin() + first);
+		m_riverDirtyRanges.push_back(range);
 	}
+	m_riverSimulatedRanges.clear();
+}
+
+void SceneChapter9::UploadRiver()
+{
+	const auto geoIt = m_geometries.find(ERenderType::River);
+	if (geoIt == m_geometries.end() || m_riverDirtyRanges.empty())
+		return;
+
+	geoIt->second.UploadRows(Render.GfxCmd.Get(), m_riverColumns, m_riverDirtyRanges);
+	m_riverDirtyRanges.clear();
 }
@@ -0,0 +1,110 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/slot_map.h"
+
+using namespace framework;
+
+SlotHandle SlotMapCore::Add()
+{
+	std::uint32_t slot;
+	if (m_freeHead != SlotHandle::InvalidIndex)
+	{
+		slot	   = m_freeHead;
+		m_freeHead = m_slotDense[slot];
+	}
+	else
+	{
+		slot = static_cast<std::uint32_t>(m_slotDense.size());
+		m_slotDense		.push_back(0u);
+		m_slotGeneration.push_back(0u);
+	}
+
+	m_slotDense[slot] = static_cast<std::uint32_t>(m_denseSlot.size());
+	m_denseSlot.push_back(slot);
+
+	return { slot, m_slotGeneration[slot] };
+}
+
+bool SlotMapCore::Remove(const SlotHandle handle, std::uint32_t& removed, std::uint32_t& moved)
+{
+	if (!IsAlive(handle)) return false;
+
+	const std::uint32_t slot = handle.Index;
+	removed = m_slotDense[slot];
+	moved	= static_cast<std::uint32_t>(m_denseSlot.size()) - 1u;
+
+	//~ last dense entry fills the hole
+	const std::uint32_t movedSlot = m_denseSlot[moved];
+	m_denseSlot[removed]  = movedSlot;
+	m_slotDense[movedSlot] = removed;
+	m_denseSlot.pop_back();
+
+	++m_slotGeneration[slot];
+	m_slotDense[slot] = m_freeHead;
+	m_freeHead		  = slot;
+	return true;
+}
+
+void SlotMapCore::Clear()
+{
+	//~ every live slot goes stale, generations survive so old handles keep failing
+	for (const std::uint32_t slot : m_denseSlot)
+	{
+		++m_slotGeneration[slot];
+		m_slotDense[slot] = m_freeHead;
+		m_freeHead		  = slot;
+	}
+	m_denseSlot.clear();
+}
+
+bool SlotMapCore::IsAlive(const SlotHandle handle) const noexcept
+{
+	//~ free slots already carry the next generation, no handle matches them
+	return handle.Index < m_slotGeneration.size() &&
+		   m_slotGeneration[handle.Index] == handle.Generation;
+}
+
+std::uint32_t SlotMapCore::GetDense(const SlotHandle handle) const noexcept
+{
+	return IsAlive(handle) ? m_slotDense[handle.Index] : SlotHandle::InvalidIndex;
+}
+
+SlotHandle SlotMapCore::GetHandle(const std::uint32_t dense) const noexcept
+{
+	if (dense >= m_denseSlot.size()) return {};
+
+	const std::uint32_t slot = m_denseSlot[dense];
+	return { slot, m_slotGeneration[slot] };
+}
@@ -0,0 +1,425 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/14/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/transform_store.h"
+#include "framework/jobs/job_system.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#include "imgui.h"
+
+using namespace framework;
+using namespace DirectX;
+
+void TransformStore::Initialize(const std::uint32_t frameCount)
+{
+	m_frameCount = std::clamp(frameCount, 1u, 255u);
+	m_count		 = 0u;
+
+	for (auto* v : { &m_positionX, &m_positionY, &m_positionZ,
+					 &m_rotationX, &m_rotationY, &m_rotationZ,
+					 &m_scaleX,	   &m_scaleY,	 &m_scaleZ })
+	{
+		v->clear();
+	}
+
+	m_dirty		 .clear();
+	m_changed	 .clear();
+	m_framesDirty.clear();
+	m_local		 .clear();
+	m_world		 .clear();
+	m_parent	 .clear();
+	m_depth		 .clear();
+	m_order		 .clear();
+	m_levelStart .assign(1u, 0u);
+	m_free		 .clear();
+	m_bOrderDirty = true;
+
+	m_lastRebuilt	 = 0u;
+	m_lastPropagated = 0u;
+	m_lastWritten	 = 0u;
+}
+
+std::uint32_t TransformStore::Add()
+{
+	//~ a removed index is already a root, it only needs its values back to identity
+	if (!m_free.empty())
+	{
+		const std::uint32_t index = m_free.back();
+		m_free.pop_back();
+
+		Set(index, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+		return index;
+	}
+
+	const std::uint32_t index = m_count++;
+
+	if (index / 64u >= m_dirty.size())
+	{
+		const size_t padded = (m_dirty.size() + 1u) * 64u;
+
+		for (auto* v : { &m_positionX, &m_positionY, &m_positionZ,
+						 &m_rotationX, &m_rotationY, &m_rotationZ })
+		{
+			v->resize(padded, 0.0f);
+		}
+		m_scaleX.resize(padded, 1.0f);
+		m_scaleY.resize(padded, 1.0f);
+		m_scaleZ.resize(padded, 1.0f);
+
+		m_changed	 .resize(padded, 0u);
+		m_framesDirty.resize(padded, 0u);
+		m_local		 .resize(padded);
+		m_world		 .resize(padded);
+		m_dirty		 .push_back(0u);
+	}
+
+	m_parent.push_back(InvalidIndex);
+	m_bOrderDirty = true;
+
+	Set(index, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+	return index;
+}
+
+void TransformStore::Set(
+	const std::uint32_t index,
+	const XMFLOAT3& position,
+	const XMFLOAT3& rotation,
+	const XMFLOAT3& scale)
+{
+	m_positionX[index] = position.x; m_positionY[index] = position.y; m_positionZ[index] = position.z;
+	m_rotationX[index] = rotation.x; m_rotationY[index] = rotation.y; m_rotationZ[index] = rotation.z;
+	m_scaleX   [index] = scale.x;	 m_scaleY	[index] = scale.y;	  m_scaleZ	 [index] = scale.z;
+
+	m_dirty[index / 64u] |= 1ull << (index % 64u);
+}
+
+void TransformStore::Remove(const std::uint32_t index)
+{
+	if (index >= m_count || std::ranges::find(m_free, index) != m_free.end()) return;
+
+	for (std::uint32_t i = 0; i < m_count; ++i)
+	{
+		if (m_parent[i] == index) SetParent(i, InvalidIndex);
+	}
+
+	//~ nothing reads a free slot, its pending frame copies can be dropped
+	m_parent[index]		 = InvalidIndex;
+	m_framesDirty[index] = 0u;
+	m_dirty[index / 64u] &= ~(1ull << (index % 64u));
+	m_bOrderDirty		 = true;
+
+	m_free.push_back(index);
+}
+
+bool TransformStore::SetParent(const std::uint32_t index, const std::uint32_t parent)
+{
+	if (index >= m_count) return false;
+	if (parent != InvalidIndex && parent >= m_count) return false;
+	if (m_parent[index] == parent) return true;
+
+	//~ the new parent must not sit below index
+	for (std::uint32_t p = parent; p != InvalidIndex; p = m_parent[p])
+	{
+		if (p == index) return false;
+	}
+
+	m_parent[index]		  = parent;
+	m_dirty[index / 64u] |= 1ull << (index % 64u);
+	m_bOrderDirty		  = true;
+	return true;
+}
+
+bool TransformStore::UseJobs(const std::uint32_t count) const
+{
+	return m_jobs && m_jobs->IsInitialized() && m_jobs->GetWorkerCount() > 0u
+		   && count >= ParallelThreshold;
+}
+
+std::uint32_t TransformStore::Flush(void* dst, const std::uint32_t stride)
+{
+	auto* bytes = static_cast<std::uint8_t*>(dst);
+	const auto words = static_cast<std::uint32_t>(m_dirty.size());
+
+	if (m_bOrderDirty) RebuildOrder();
+
+	m_bLastParallel = UseJobs(m_count);
+
+	std::uint32_t rebuilt	 = 0u;
+	std::uint32_t propagated = 0u;
+	std::uint32_t written	 = 0u;
+
+	if (m_bLastParallel)
+	{
+		std::atomic<std::uint32_t> total{ 0u };
+
+		m_jobs->ParallelFor(words, ParallelGrain, [&](const std::uint32_t begin, const std::uint32_t end)
+		{
+			total.fetch_add(RebuildLocals(begin, end), std::memory_order_relaxed);
+		});
+		rebuilt = total.exchange(0u);
+
+		//~ a level only depends on the ones above it, nothing to do when no local changed
+		for (size_t level = 0; rebuilt && level + 1u < m_levelStart.size(); ++level)
+		{
+			const std::uint32_t begin = m_levelStart[level];
+			const std::uint32_t end	  = m_levelStart[level + 1u];
+
+			if (UseJobs(end - begin))
+			{
+				m_jobs->ParallelFor(end - begin, ParallelGrain * 64u, [&, begin](const std::uint32_t b, const std::uint32_t e)
+				{
+					total.fetch_add(Propagate(begin + b, begin + e), std::memory_order_relaxed);
+				});
+			}
+			else total.fetch_add(Propagate(begin, end), std::memory_order_relaxed);
+		}
+		propagated = total.exchange(0u);
+
+		m_jobs->ParallelFor(words, ParallelGrain, [&](const std::uint32_t begin, const std::uint32_t end)
+		{
+			total.fetch_add(WriteWorlds(begin, end, bytes, stride), std::memory_order_relaxed);
+		});
+		written = total.load();
+	}
+	else
+	{
+		rebuilt	   = RebuildLocals(0u, words);
+		propagated = rebuilt ? Propagate(0u, m_count) : 0u;
+		written	   = WriteWorlds(0u, words, bytes, stride);
+	}
+
+	m_lastRebuilt	 = rebuilt;
+	m_lastPropagated = propagated;
+	m_lastWritten	 = written;
+	return written;
+}
+
+std::uint32_t TransformStore::RebuildLocals(const std::uint32_t beginWord, const std::uint32_t endWord)
+{
+	std::uint32_t rebuilt = 0u;
+
+	for (std::uint32_t w = beginWord; w < endWord; ++w)
+	{
+		//~ any dirty bit in a nibble rebuilds its whole group of four
+		std::uint64_t bits = m_dirty[w];
+		m_dirty[w] = 0u;
+
+		while (bits)
+		{
+			const auto group = static_cast<std::uint32_t>(std::countr_zero(bits)) & ~3u;
+			RebuildGroup(w * 64u + group);
+
+			for (std::uint64_t lanes = bits & (0xFull << group); lanes; lanes &= lanes - 1u)
+			{
+				m_changed[w * 64u + static_cast<std::uint32_t>(std::countr_zero(lanes))] = 1u;
+				++rebuilt;
+			}
+			bits &= ~(0xFull << group);
+		}
+	}
+
+	return rebuilt;
+}
+
+void TransformStore::RebuildGroup(const std::uint32_t first)
+{
+	//~ lane k of every vector belongs to object first + k
+	XMVECTOR sinP, cosP, sinY, cosY, sinR, cosR;
+	XMVectorSinCos(&sinP, &cosP, XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_rotationX[first])));
+	XMVectorSinCos(&sinY, &cosY, XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_rotationY[first])));
+	XMVectorSinCos(&sinR, &cosR, XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_rotationZ[first])));
+
+	const XMVECTOR sx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_scaleX[first]));
+	const XMVECTOR sy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_scaleY[first]));
+	const XMVECTOR sz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_scaleZ[first]));
+
+	//~ roll pitch yaw rotation, same element layout as XMMatrixRotationRollPitchYaw
+	const XMVECTOR sPsY = XMVectorMultiply(sinP, sinY);
+	const XMVECTOR sPcY = XMVectorMultiply(sinP, cosY);
+
+	const XMVECTOR r00 = XMVectorMultiplyAdd(cosR, cosY, XMVectorMultiply(sinR, sPsY));
+	const XMVECTOR r01 = XMVectorMultiply(sinR, cosP);
+	const XMVECTOR r02 = XMVectorSubtract(XMVectorMultiply(sinR, sPcY), XMVectorMultiply(cosR, sinY));
+
+	const XMVECTOR r10 = XMVectorSubtract(XMVectorMultiply(cosR, sPsY), XMVectorMultiply(sinR, cosY));
+	const XMVECTOR r11 = XMVectorMultiply(cosR, cosP);
+	const XMVECTOR r12 = XMVectorMultiplyAdd(sinR, sinY, XMVectorMultiply(cosR, sPcY));
+
+	const XMVECTOR r20 = XMVectorMultiply(cosP, sinY);
+	const XMVECTOR r21 = XMVectorNegate(sinP);
+	const XMVECTOR r22 = XMVectorMultiply(cosP, cosY);
+
+	//~ local = S * R * T, transposed: row j holds column j of the local matrix
+	XMMATRIX rows[3];
+	rows[0] = XMMATRIX(XMVectorMultiply(sx, r00), XMVectorMultiply(sy, r10), XMVectorMultiply(sz, r20),
+					   XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_positionX[first])));
+	rows[1] = XMMATRIX(XMVectorMultiply(sx, r01), XMVectorMultiply(sy, r11), XMVectorMultiply(sz, r21),
+					   XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_positionY[first])));
+	rows[2] = XMMATRIX(XMVectorMultiply(sx, r02), XMVectorMultiply(sy, r12), XMVectorMultiply(sz, r22),
+					   XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_positionZ[first])));
+
+	//~ lanes -> objects
+	for (int j = 0; j < 3; ++j)
+		rows[j] = XMMatrixTranspose(rows[j]);
+
+	for (std::uint32_t k = 0; k < 4u; ++k)
+	{
+		XMFLOAT4X4A& out = m_local[first + k];
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(out.m[0]), rows[0].r[k]);
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(out.m[1]), rows[1].r[k]);
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(out.m[2]), rows[2].r[k]);
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(out.m[3]), g_XMIdentityR3);
+	}
+}
+
+std::uint32_t TransformStore::Propagate(const std::uint32_t begin, const std::uint32_t end)
+{
+	std::uint32_t propagated = 0u;
+
+	for (std::uint32_t k = begin; k < end; ++k)
+	{
+		const std::uint32_t index  = m_order[k];
+		const std::uint32_t parent = m_parent[index];
+
+		//~ clean node under a clean parent, whole subtree below stays as is
+		if (parent != InvalidIndex && m_changed[parent]) m_changed[index] = 1u;
+		if (!m_changed[index]) continue;
+
+		if (parent == InvalidIndex)
+		{
+			m_world[index] = m_local[index];
+		}
+		else
+		{
+			//~ transposed: (local * parentWorld)^T = parentWorld^T * local^T
+			const XMMATRIX world = XMMatrixMultiply(
+				XMLoadFloat4x4A(&m_world[parent]),
+				XMLoadFloat4x4A(&m_local[index]));
+			XMStoreFloat4x4A(&m_world[index], world);
+		}
+
+		m_framesDirty[index] = static_cast<std::uint8_t>(m_frameCount);
+		++propagated;
+	}
+
+	return propagated;
+}
+
+std::uint32_t TransformStore::WriteWorlds(
+	const std::uint32_t beginWord, const std::uint32_t endWord,
+	std::uint8_t* dst, const std::uint32_t stride)
+{
+	std::uint32_t written = 0u;
+
+	const std::uint32_t first = beginWord * 64u;
+	const std::uint32_t last  = std::min(endWord * 64u, m_count);
+
+	for (std::uint32_t i = first; i < last; ++i)
+	{
+		m_changed[i] = 0u;
+		if (m_framesDirty[i] == 0u) continue;
+
+		std::memcpy(dst + static_cast<size_t>(i) * stride, &m_world[i], sizeof(XMFLOAT4X4));
+		--m_framesDirty[i];
+		++written;
+	}
+
+	return written;
+}
+
+void TransformStore::RebuildOrder()
+{
+	m_bOrderDirty = false;
+
+	//~ depth of every node, walking up until a known depth is found
+	constexpr std::uint32_t unknown = InvalidIndex;
+	m_depth.assign(m_count, unknown);
+
+	std::vector<std::uint32_t> chain;
+	std::uint32_t maxDepth = 0u;
+
+	for (std::uint32_t i = 0; i < m_count; ++i)
+	{
+		std::uint32_t node = i;
+		while (node != InvalidIndex && m_depth[node] == unknown)
+		{
+			chain.push_back(node);
+			node = m_parent[node];
+		}
+
+		std::uint32_t depth = node == InvalidIndex ? 0u : m_depth[node] + 1u;
+		for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+		{
+			m_depth[*it] = depth++;
+		}
+		chain.clear();
+
+		maxDepth = std::max(maxDepth, m_depth[i]);
+	}
+
+	//~ counting sort keeps index order inside a level, neighbours stay neighbours in memory
+	m_levelStart.assign(m_count ? maxDepth + 2u : 1u, 0u);
+	for (std::uint32_t i = 0; i < m_count; ++i)
+		++m_levelStart[m_depth[i] + 1u];
+
+	for (size_t level = 1; level < m_levelStart.size(); ++level)
+		m_levelStart[level] += m_levelStart[level - 1u];
+
+	std::vector<std::uint32_t> cursor(m_levelStart.begin(), m_levelStart.end() - 1);
+	m_order.resize(m_count);
+	for (std::uint32_t i = 0; i < m_count; ++i)
+		m_order[cursor[m_depth[i]]++] = i;
+}
+
+void TransformStore::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Transform Store"))
+	{
+		ImGui::BulletText("Transforms: %u in %u levels", m_count, GetLevelCount());
+		ImGui::BulletText("Free: %u", static_cast<std::uint32_t>(m_free.size()));
+		ImGui::BulletText("Rebuilt: %u", m_lastRebuilt);
+		ImGui::BulletText("Propagated: %u", m_lastPropagated);
+		ImGui::BulletText("Written: %u", GetWrittenCount());
+		ImGui::BulletText("Skipped: %u", GetSkippedCount());
+		ImGui::BulletText("Parallel: %s", m_bLastParallel ? "yes" : "no");
+	}
+
+	ImGui::PopID();
+}
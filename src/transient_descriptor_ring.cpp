@@ -0,0 +1,109 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/transient_descriptor_ring.h"
+
+#include "framework/exception/dx_exception.h"
+#include "framework/render_manager/components/decriptor_heap.h"
+
+#include "imgui.h"
+
+using namespace framework;
+
+void TransientDescriptorRing::Initialize(ID3D12Device* device, DescriptorHeap& heap, const std::uint32_t count)
+{
+	if (IsInitialized()) return;
+
+	if (!heap.IsShaderVisible()) THROW_MSG("TransientDescriptorRing needs a shader visible heap");
+
+	m_device = device;
+	m_type	 = heap.GetType();
+	m_base	 = heap.Allocate(count);
+	m_count	 = count;
+	m_core.Initialize(count);
+	m_heap	 = &heap;
+}
+
+void TransientDescriptorRing::BeginFrame(const std::uint64_t completedFenceValue)
+{
+	m_core.Reclaim(completedFenceValue);
+}
+
+void TransientDescriptorRing::EndFrame(const std::uint64_t fenceValue)
+{
+	m_lastFrameCount  = m_core.GetFrameBytes();
+	m_lastFrameTables = m_frameTables;
+	m_frameTables	  = 0u;
+	m_core.FinishFrame(fenceValue);
+}
+
+std::uint32_t TransientDescriptorRing::Allocate(const std::uint32_t count)
+{
+	if (!IsInitialized()) THROW_MSG("TransientDescriptorRing not initialized");
+
+	const std::uint64_t offset = m_core.Allocate(count, 1u);
+	if (offset == LinearAllocatorCore::InvalidOffset)
+	{
+		THROW_MSG("TransientDescriptorRing is full, frames in flight still hold every descriptor");
+	}
+
+	return m_base + static_cast<std::uint32_t>(offset);
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE TransientDescriptorRing::CopyTable(const D3D12_CPU_DESCRIPTOR_HANDLE source, const std::uint32_t count)
+{
+	const std::uint32_t index = Allocate(count);
+	m_device->CopyDescriptorsSimple(count, m_heap->GetCPUHandle(index), source, m_type);
+	++m_frameTables;
+	return m_heap->GetGPUHandle(index);
+}
+
+void TransientDescriptorRing::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Transient Descriptors"))
+	{
+		ImGui::BulletText("Ring: %u descriptors at %u", m_count, m_base);
+		ImGui::BulletText("In Use: %llu (peak %llu), Frames In Flight: %u",
+			static_cast<unsigned long long>(m_core.GetUsed()),
+			static_cast<unsigned long long>(m_core.GetPeak()),
+			m_core.GetFramesInFlight());
+		ImGui::BulletText("Last Frame: %u tables, %llu descriptors",
+			m_lastFrameTables, static_cast<unsigned long long>(m_lastFrameCount));
+		ImGui::BulletText("Wraps: %llu", static_cast<unsigned long long>(m_core.GetWraps()));
+	}
+
+	ImGui::PopID();
+}
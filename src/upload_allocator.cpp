@@ -0,0 +1,133 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/13/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "framework/render_manager/components/upload_allocator.h"
+
+#include "framework/exception/base_exception.h"
+#include "framework/exception/dx_exception.h"
+
+#include "imgui.h"
+
+using namespace framework;
+
+UploadAllocator::~UploadAllocator()
+{
+	if (m_buffer && m_mapped)
+	{
+		m_buffer->Unmap(0u, nullptr);
+		m_mapped = nullptr;
+	}
+}
+
+void UploadAllocator::Initialize(ID3D12Device *device, const std::uint64_t capacity)
+{
+	D3D12_RESOURCE_DESC resource{};
+	resource.Flags				= D3D12_RESOURCE_FLAG_NONE;
+	resource.Format				= DXGI_FORMAT_UNKNOWN;
+	resource.Alignment			= 0u;
+	resource.DepthOrArraySize	= 1u;
+	resource.Dimension			= D3D12_RESOURCE_DIMENSION_BUFFER;
+	resource.Height				= 1u;
+	resource.Layout				= D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	resource.MipLevels			= 1u;
+	resource.SampleDesc.Count	= 1u;
+	resource.SampleDesc.Quality = 0u;
+	resource.Width				= capacity;
+
+	D3D12_HEAP_PROPERTIES property{};
+	property.Type				  = D3D12_HEAP_TYPE_UPLOAD;
+	property.CPUPageProperty	  = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	property.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+	property.CreationNodeMask	  = 1u;
+	property.VisibleNodeMask	  = 1u;
+
+	THROW_DX_IF_FAILS(device->CreateCommittedResource(
+		&property, D3D12_HEAP_FLAG_NONE,
+		&resource, D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr, IID_PPV_ARGS(&m_buffer)));
+
+	THROW_DX_IF_FAILS(m_buffer->Map(
+		0u, nullptr,
+		reinterpret_cast<void**>(&m_mapped)));
+
+	m_gpuBase = m_buffer->GetGPUVirtualAddress();
+	m_core.Initialize(capacity);
+}
+
+void UploadAllocator::BeginFrame(const std::uint64_t completedFenceValue)
+{
+	m_core.Reclaim(completedFenceValue);
+	m_frameAllocations = 0u;
+}
+
+void UploadAllocator::EndFrame(const std::uint64_t fenceValue)
+{
+	m_lastFrameBytes	   = m_core.GetFrameBytes();
+	m_lastFrameAllocations = m_frameAllocations;
+	m_core.FinishFrame(fenceValue);
+}
+
+UploadAllocation UploadAllocator::Allocate(const std::uint32_t size, const std::uint32_t alignment)
+{
+	const std::uint64_t offset = m_core.Allocate(size, alignment);
+	if (offset == LinearAllocatorCore::InvalidOffset)
+	{
+		THROW_MSG("Upload allocator is out of memory!");
+	}
+
+	++m_frameAllocations;
+
+	UploadAllocation allocation{};
+	allocation.CPU	= m_mapped + offset;
+	allocation.GPU	= m_gpuBase + offset;
+	allocation.Size = size;
+	return allocation;
+}
+
+void UploadAllocator::ImguiView()
+{
+	ImGui::PushID(this);
+
+	if (ImGui::CollapsingHeader("Upload Allocator"))
+	{
+		const auto kb = [](const std::uint64_t bytes) { return static_cast<double>(bytes) / 1024.0; };
+
+		ImGui::BulletText("Capacity: %.1f KB", kb(m_core.GetCapacity()));
+		ImGui::BulletText("In Use: %.1f KB (peak %.1f KB)", kb(m_core.GetUsed()), kb(m_core.GetPeak()));
+		ImGui::BulletText("Last Frame: %.1f KB in %u allocations", kb(m_lastFrameBytes), m_lastFrameAllocations);
+		ImGui::BulletText("Frames In Flight: %u", m_core.GetFramesInFlight());
+	}
+
+	ImGui::PopID();
+}
@@ -0,0 +1,202 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/command_encoder.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	//~ stands in for a command list, keeps what it was told and in which order
+	class RecordingEncoder final : public ICommandEncoder
+	{
+	public:
+		void Begin() override
+		{
+			++m_begins;
+			m_bInOrder &= !m_bOpen;
+			m_bOpen = true;
+		}
+
+		void Record(const std::span<const DrawPacket> packets) override
+		{
+			++m_records;
+			m_bInOrder &= m_bOpen;
+			m_packets.insert(m_packets.end(), packets.begin(), packets.end());
+		}
+
+		void End() override
+		{
+			++m_ends;
+			m_bInOrder &= m_bOpen;
+			m_bOpen = false;
+		}
+
+		bool IsClosedOnce() const { return m_begins == 1u && m_ends == 1u && m_records == 1u && m_bInOrder && !m_bOpen; }
+		const std::vector<DrawPacket>& GetPackets() const { return m_packets; }
+
+	private:
+		std::vector<DrawPacket> m_packets;
+		std::uint32_t m_begins { 0u };
+		std::uint32_t m_records{ 0u };
+		std::uint32_t m_ends   { 0u };
+		bool m_bOpen   { false };
+		bool m_bInOrder{ true };
+	};
+
+	std::vector<DrawPacket> MakePackets(const std::uint32_t count)
+	{
+		std::vector<DrawPacket> packets(count);
+		for (std::uint32_t i = 0; i < count; ++i) packets[i] = { static_cast<std::uint64_t>(i) * 3u, i, 0u };
+		return packets;
+	}
+
+	void RecordAndCheck(ParallelRecorder& recorder, const std::uint32_t count)
+	{
+		const auto packets = MakePackets(count);
+		std::vector<RecordingEncoder> encoders(ParallelRecorder::ChunkLimit);
+		std::vector<std::uint32_t> acquired;
+
+		const std::uint32_t used = recorder.Record(packets, [&](const std::uint32_t chunk) -> ICommandEncoder&
+		{
+			acquired.push_back(chunk);
+			return encoders[chunk];
+		});
+
+		//~ one encoder per chunk, asked for in order, an empty list still opens and closes one
+		const std::uint32_t expected = std::max(recorder.GetChunkCount(count), 1u);
+		CHECK(used == expected);
+		CHECK(used <= recorder.GetMaxChunks());
+		CHECK(acquired.size() == used);
+		for (std::uint32_t chunk = 0; chunk < acquired.size(); ++chunk) CHECK(acquired[chunk] == chunk);
+
+		//~ submitting the encoders in order replays the input exactly
+		std::vector<DrawPacket> replay;
+		std::uint32_t smallest = count, largest = 0u;
+		for (std::uint32_t chunk = 0; chunk < used; ++chunk)
+		{
+			const auto& encoder = encoders[chunk];
+			CHECK(encoder.IsClosedOnce());
+
+			const auto size = static_cast<std::uint32_t>(encoder.GetPackets().size());
+			smallest = std::min(smallest, size);
+			largest	 = std::max(largest, size);
+			replay.insert(replay.end(), encoder.GetPackets().begin(), encoder.GetPackets().end());
+
+			std::uint32_t begin, end;
+			recorder.GetChunkRange(count, chunk, begin, end);
+			CHECK(end - begin == size);
+		}
+
+		CHECK(std::ranges::equal(replay, packets, [](const DrawPacket& a, const DrawPacket& b)
+		{
+			return a.Key == b.Key && a.Item == b.Item;
+		}));
+		CHECK(largest - std::min(smallest, largest) <= 1u);
+
+		for (std::uint32_t chunk = used; chunk < encoders.size(); ++chunk) CHECK(encoders[chunk].GetPackets().empty());
+	}
+
+	void TestChunking()
+	{
+		ParallelRecorder recorder;
+		recorder.SetMinPacketsPerChunk(64u);
+		recorder.SetMaxChunks(4u);
+
+		CHECK(recorder.GetChunkCount(0u)	== 0u);
+		CHECK(recorder.GetChunkCount(1u)	== 1u);
+		CHECK(recorder.GetChunkCount(64u)	== 1u);
+		CHECK(recorder.GetChunkCount(65u)	== 2u);
+		CHECK(recorder.GetChunkCount(10'000u) == 4u);
+
+		//~ settings are clamped
+		recorder.SetMaxChunks(0u);
+		CHECK(recorder.GetMaxChunks() == 1u);
+		recorder.SetMaxChunks(1000u);
+		CHECK(recorder.GetMaxChunks() == ParallelRecorder::ChunkLimit);
+		recorder.SetMinPacketsPerChunk(0u);
+		CHECK(recorder.GetChunkCount(5u) == 5u);
+
+		//~ ranges tile [0, count) with no gap or overlap
+		recorder.SetMinPacketsPerChunk(1u);
+		for (const std::uint32_t count : { 1u, 7u, 16u, 17u, 1001u })
+		{
+			std::uint32_t next = 0u;
+			for (std::uint32_t chunk = 0; chunk < recorder.GetChunkCount(count); ++chunk)
+			{
+				std::uint32_t begin, end;
+				recorder.GetChunkRange(count, chunk, begin, end);
+				CHECK(begin == next && end > begin);
+				next = end;
+			}
+			CHECK(next == count);
+		}
+	}
+
+	void TestRecord(JobSystem* jobs)
+	{
+		ParallelRecorder recorder;
+		recorder.SetJobSystem(jobs);
+
+		for (const std::uint32_t maxChunks : { 1u, 3u, 4u, 16u })
+		{
+			recorder.SetMaxChunks(maxChunks);
+			for (const std::uint32_t minPackets : { 1u, 8u, 64u })
+			{
+				recorder.SetMinPacketsPerChunk(minPackets);
+				for (const std::uint32_t count : { 0u, 1u, 5u, 63u, 64u, 65u, 200u, 1000u, 4099u })
+					RecordAndCheck(recorder, count);
+			}
+		}
+	}
+} // namespace
+
+int main()
+{
+	TestChunking();
+	TestRecord(nullptr);
+
+	JobSystem jobs;
+	jobs.Initialize(3u);
+	TestRecord(&jobs);
+	jobs.Shutdown();
+
+	return tests::Finish("command encoder");
+}
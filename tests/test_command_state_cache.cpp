@@ -0,0 +1,225 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/command_state_cache.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	//~ same calls as a graphics command list, writes down the ones that reach it
+	struct FakeList
+	{
+		std::vector<std::string> Calls;
+		std::uint32_t Draws{ 0u };
+
+		void SetDescriptorHeaps(UINT, ID3D12DescriptorHeap* const*)					   { Calls.emplace_back("heaps"); }
+		void SetGraphicsRootSignature(ID3D12RootSignature*)							   { Calls.emplace_back("signature"); }
+		void SetPipelineState(ID3D12PipelineState*)									   { Calls.emplace_back("pipeline"); }
+		void SetGraphicsRootConstantBufferView(const UINT p, D3D12_GPU_VIRTUAL_ADDRESS) { Calls.emplace_back("cbv" + std::to_string(p)); }
+		void SetGraphicsRootShaderResourceView(const UINT p, D3D12_GPU_VIRTUAL_ADDRESS) { Calls.emplace_back("srv" + std::to_string(p)); }
+		void SetGraphicsRootDescriptorTable(const UINT p, D3D12_GPU_DESCRIPTOR_HANDLE)  { Calls.emplace_back("table" + std::to_string(p)); }
+		void SetGraphicsRoot32BitConstant(const UINT p, UINT, UINT)					   { Calls.emplace_back("constant" + std::to_string(p)); }
+		void IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY)							   { Calls.emplace_back("topology"); }
+		void IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW*)						   { Calls.emplace_back("ib"); }
+		void IASetVertexBuffers(UINT, UINT, const D3D12_VERTEX_BUFFER_VIEW*)		   { Calls.emplace_back("vb"); }
+		void DrawIndexedInstanced(UINT, UINT, UINT, INT, UINT)						   { ++Draws; }
+
+		//~ calls since the last Take
+		std::vector<std::string> Take() { return std::exchange(Calls, {}); }
+	};
+
+	using Cache = BasicCommandStateCache<FakeList>;
+	using Calls = std::vector<std::string>;
+
+	//~ only identity matters, the cache never dereferences these
+	template<typename T>
+	T* Fake(const std::uintptr_t id) { return reinterpret_cast<T*>(id * 16u); }
+
+	void TestRepeatedBindsDropped()
+	{
+		FakeList list;
+		Cache cache{ &list };
+
+		ID3D12DescriptorHeap* heaps[2] = { Fake<ID3D12DescriptorHeap>(1u), Fake<ID3D12DescriptorHeap>(2u) };
+		for (int pass = 0; pass < 3; ++pass)
+		{
+			cache.SetDescriptorHeaps(2u, heaps);
+			cache.SetGraphicsRootSignature(Fake<ID3D12RootSignature>(3u));
+			cache.SetPipelineState(Fake<ID3D12PipelineState>(4u));
+			cache.SetGraphicsRootConstantBufferView(0u, 0x1000u);
+			cache.SetGraphicsRootShaderResourceView(1u, 0x2000u);
+			cache.SetGraphicsRootDescriptorTable(2u, { 0x3000u });
+			cache.SetGraphicsRoot32BitConstant(3u, 7u, 0u);
+			cache.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		}
+
+		CHECK((list.Take() == Calls{ "heaps", "signature", "pipeline", "cbv0", "srv1", "table2", "constant3", "topology" }));
+		CHECK(cache.GetIssued() == 8u && cache.GetFiltered() == 16u);
+
+		//~ draws always go through and are counted apart
+		cache.DrawIndexedInstanced(3u, 1u, 0u, 0, 0u);
+		cache.DrawIndexedInstanced(3u, 1u, 0u, 0, 0u);
+		CHECK(list.Draws == 2u && cache.GetDraws() == 2u);
+
+		//~ Reset clears the counters and what was bound
+		cache.Reset(&list);
+		CHECK(cache.GetIssued() == 0u && cache.GetFiltered() == 0u && cache.GetDraws() == 0u);
+		cache.SetPipelineState(Fake<ID3D12PipelineState>(4u));
+		CHECK((list.Take() == Calls{ "pipeline" }));
+	}
+
+	void TestChangesReachTheList()
+	{
+		FakeList list;
+		Cache cache{ &list };
+
+		cache.SetGraphicsRootConstantBufferView(0u, 0x1000u);
+		cache.SetGraphicsRootConstantBufferView(0u, 0x1100u);
+		cache.SetGraphicsRootConstantBufferView(1u, 0x1100u);
+
+		//~ same value, other kind of argument
+		cache.SetGraphicsRootShaderResourceView(0u, 0x1100u);
+		cache.SetGraphicsRootShaderResourceView(0u, 0x1100u);
+		CHECK((list.Take() == Calls{ "cbv0", "cbv0", "cbv1", "srv0" }));
+
+		//~ constants past offset 0 are not tracked and forget what offset 0 held
+		cache.SetGraphicsRoot32BitConstant(4u, 1u, 0u);
+		cache.SetGraphicsRoot32BitConstant(4u, 1u, 2u);
+		cache.SetGraphicsRoot32BitConstant(4u, 1u, 2u);
+		cache.SetGraphicsRoot32BitConstant(4u, 1u, 0u);
+		CHECK((list.Take() == Calls{ "constant4", "constant4", "constant4", "constant4" }));
+
+		//~ parameters past the tracked range always go through
+		cache.SetGraphicsRootConstantBufferView(Cache::MaxRootParameters, 0x10u);
+		cache.SetGraphicsRootConstantBufferView(Cache::MaxRootParameters, 0x10u);
+		CHECK(list.Take().size() == 2u);
+
+		//~ heaps compare count and every pointer
+		ID3D12DescriptorHeap* one[1] = { Fake<ID3D12DescriptorHeap>(1u) };
+		ID3D12DescriptorHeap* two[2] = { Fake<ID3D12DescriptorHeap>(1u), Fake<ID3D12DescriptorHeap>(2u) };
+		cache.SetDescriptorHeaps(1u, one);
+		cache.SetDescriptorHeaps(2u, two);
+		cache.SetDescriptorHeaps(2u, two);
+		cache.SetDescriptorHeaps(1u, one);
+		CHECK((list.Take() == Calls{ "heaps", "heaps", "heaps" }));
+	}
+
+	void TestViews()
+	{
+		FakeList list;
+		Cache cache{ &list };
+
+		D3D12_INDEX_BUFFER_VIEW index{ 0x100u, 600u, DXGI_FORMAT_R32_UINT };
+		cache.IASetIndexBuffer(&index);
+		cache.IASetIndexBuffer(&index);
+		index.SizeInBytes = 300u;
+		cache.IASetIndexBuffer(&index);
+		cache.IASetIndexBuffer(nullptr);
+		cache.IASetIndexBuffer(nullptr);
+		CHECK((list.Take() == Calls{ "ib", "ib", "ib", "ib" }));
+
+		D3D12_VERTEX_BUFFER_VIEW views[2] = { { 0x200u, 960u, 32u }, { 0x400u, 480u, 16u } };
+		cache.IASetVertexBuffers(0u, 2u, views);
+		cache.IASetVertexBuffers(0u, 2u, views);
+		cache.IASetVertexBuffers(1u, 1u, &views[1]); // slot 1 already holds it
+		cache.IASetVertexBuffers(0u, 1u, &views[1]); // slot 0 does not
+		cache.IASetVertexBuffers(0u, 2u, views);
+		CHECK((list.Take() == Calls{ "vb", "vb", "vb" }));
+
+		//~ an untracked range forgets the slots it touched
+		cache.IASetVertexBuffers(1u, 1u, nullptr);
+		cache.IASetVertexBuffers(0u, 2u, views);
+		cache.IASetVertexBuffers(0u, 1u, views);
+		CHECK((list.Take() == Calls{ "vb", "vb" }));
+
+		cache.Invalidate();
+		cache.IASetVertexBuffers(0u, 1u, views);
+		cache.IASetIndexBuffer(&index);
+		CHECK((list.Take() == Calls{ "vb", "ib" }));
+	}
+
+	void TestInvalidation()
+	{
+		FakeList list;
+		Cache cache{ &list };
+
+		ID3D12DescriptorHeap* first [1] = { Fake<ID3D12DescriptorHeap>(1u) };
+		ID3D12DescriptorHeap* second[1] = { Fake<ID3D12DescriptorHeap>(2u) };
+
+		cache.SetDescriptorHeaps(1u, first);
+		cache.SetGraphicsRootSignature(Fake<ID3D12RootSignature>(1u));
+		cache.SetGraphicsRootDescriptorTable(0u, { 0x10u });
+		cache.SetGraphicsRootConstantBufferView(1u, 0x20u);
+		list.Take();
+
+		//~ a heap change forgets the tables but keeps the other root arguments
+		cache.SetDescriptorHeaps(1u, second);
+		cache.SetGraphicsRootDescriptorTable(0u, { 0x10u });
+		cache.SetGraphicsRootConstantBufferView(1u, 0x20u);
+		CHECK((list.Take() == Calls{ "heaps", "table0" }));
+
+		//~ a new root signature forgets every root argument, the same one again changes nothing
+		cache.SetGraphicsRootSignature(Fake<ID3D12RootSignature>(1u));
+		cache.SetGraphicsRootConstantBufferView(1u, 0x20u);
+		cache.SetGraphicsRootSignature(Fake<ID3D12RootSignature>(2u));
+		cache.SetGraphicsRootDescriptorTable(0u, { 0x10u });
+		cache.SetGraphicsRootConstantBufferView(1u, 0x20u);
+		CHECK((list.Take() == Calls{ "signature", "table0", "cbv1" }));
+
+		//~ Invalidate after recording into the list directly
+		cache.SetPipelineState(Fake<ID3D12PipelineState>(9u));
+		cache.Invalidate();
+		cache.SetPipelineState(Fake<ID3D12PipelineState>(9u));
+		cache.SetGraphicsRootSignature(Fake<ID3D12RootSignature>(2u));
+		cache.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_UNDEFINED);
+		CHECK((list.Take() == Calls{ "pipeline", "pipeline", "signature" }));
+	}
+} // namespace
+
+int main()
+{
+	TestRepeatedBindsDropped();
+	TestChangesReachTheList();
+	TestViews();
+	TestInvalidation();
+	return tests::Finish("command state cache");
+}
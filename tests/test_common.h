@@ -0,0 +1,76 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#ifndef DIRECTX12_TEST_COMMON_H
+#define DIRECTX12_TEST_COMMON_H
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+//~ Minimal checks for the device free tests. A failed CHECK prints where it failed and keeps
+//~ going, Finish turns the failure count into the exit code ctest looks at.
+namespace tests
+{
+	inline int g_failures = 0;
+
+	inline void Check(const bool bPassed, const char* expression, const char* file, const int line)
+	{
+		if (bPassed) return;
+
+		++g_failures;
+		std::fprintf(stderr, "%s(%d): CHECK(%s) failed\n", file, line, expression);
+	}
+
+	//~ wall time of one call in microseconds
+	template<typename Fn>
+	float TimeMicro(Fn&& fn)
+	{
+		using Clock = std::chrono::steady_clock;
+		const auto start = Clock::now();
+		std::forward<Fn>(fn)();
+		return std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+	}
+
+	inline int Finish(const char* name)
+	{
+		if (g_failures) std::fprintf(stderr, "%s: %d check(s) failed\n", name, g_failures);
+		else			std::printf("%s: passed\n", name);
+		return g_failures ? 1 : 0;
+	}
+} // namespace tests
+
+#define CHECK(expression) ::tests::Check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#endif //DIRECTX12_TEST_COMMON_H
@@ -0,0 +1,203 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/concurrent_descriptor_allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	using Allocator = ConcurrentDescriptorAllocator;
+
+	void TestSingleThread()
+	{
+		Allocator allocator;
+		allocator.Initialize(100u, 70u, 16u);
+
+		//~ the 6 slot tail is left out, indices start at the base
+		CHECK(allocator.GetBlockCount() == 4u && allocator.GetFreeBlocks() == 4u);
+		CHECK(allocator.Owns(100u) && allocator.Owns(163u) && !allocator.Owns(164u) && !allocator.Owns(99u));
+
+		CHECK(allocator.Allocate(0u)  == Allocator::InvalidIndex);
+		CHECK(allocator.Allocate(17u) == Allocator::InvalidIndex);
+
+		//~ bump allocation inside one block until the next request does not fit
+		const std::uint32_t a = allocator.Allocate(10u);
+		const std::uint32_t b = allocator.Allocate(6u);
+		const std::uint32_t c = allocator.Allocate(1u);
+		CHECK(a == 100u && b == 110u);
+		CHECK(c == 116u);
+		CHECK(allocator.GetFreeBlocks() == 2u && allocator.GetAllocated() == 17u);
+
+		//~ the first block is no longer owned, freeing all of it puts it back on the stack
+		allocator.Free(a, 10u);
+		CHECK(allocator.GetFreeBlocks() == 2u);
+		allocator.Free(b, 6u);
+		CHECK(allocator.GetFreeBlocks() == 3u);
+
+		//~ the owned block stays out while it has live slots or an owner
+		allocator.Free(c, 1u);
+		CHECK(allocator.GetFreeBlocks() == 3u);
+		allocator.ReleaseThreadCache();
+		CHECK(allocator.GetFreeBlocks() == 4u && allocator.GetAllocated() == 0u);
+
+		//~ foreign indices are ignored
+		allocator.Free(5u, 3u);
+		CHECK(allocator.GetAllocated() == 0u);
+
+		//~ a full block per request drains the stack, then allocation fails
+		std::vector<std::uint32_t> blocks;
+		for (std::uint32_t i = 0; i < 4u; ++i) blocks.push_back(allocator.Allocate(16u));
+		CHECK(std::ranges::none_of(blocks, [](const std::uint32_t index) { return index == Allocator::InvalidIndex; }));
+		CHECK(allocator.Allocate(1u) == Allocator::InvalidIndex);
+
+		std::ranges::sort(blocks);
+		CHECK(std::ranges::adjacent_find(blocks) == blocks.end());
+		for (const std::uint32_t index : blocks) allocator.Free(index, 16u);
+		allocator.ReleaseThreadCache();
+		CHECK(allocator.GetFreeBlocks() == 4u);
+	}
+
+	//~ threads hammering one allocator with allocate / free, half the frees cross threads. Every
+	//~ slot is claimed in a shared array, a slot handed out twice or lost shows up there
+	void TestStress(const std::uint32_t threads, const std::uint32_t operationsPerThread, const bool bPrint)
+	{
+		constexpr std::uint32_t BlockSize = 16u;
+		constexpr std::uint32_t Batch	  = 64u; // ranges a thread holds per round
+
+		//~ room for every thread's batch at the largest size, plus the tails parked in retired blocks
+		const std::uint32_t capacity = threads * (Batch * 4u + 2u * BlockSize) * 2u;
+
+		Allocator allocator;
+		allocator.Initialize(0u, capacity, BlockSize);
+
+		std::vector<std::atomic<std::uint8_t>> claims(capacity);
+		for (auto& claim : claims) claim.store(0u, std::memory_order_relaxed);
+
+		std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> live(threads);
+		std::atomic<std::uint32_t> operations{ 0u };
+		std::atomic<std::uint32_t> failed	 { 0u };
+		std::atomic<std::uint32_t> errors	 { 0u };
+
+		const std::uint32_t rounds = std::max(operationsPerThread / (Batch * 2u), 1u);
+		std::barrier sync{ static_cast<std::ptrdiff_t>(threads) };
+
+		const auto worker = [&](const std::uint32_t self)
+		{
+			std::mt19937 rng{ 1337u + self };
+			std::uint32_t localOps = 0u, localFailed = 0u, localErrors = 0u;
+
+			const auto release = [&](const std::uint32_t index, const std::uint32_t count)
+			{
+				for (std::uint32_t k = index; k < index + count; ++k)
+					localErrors += claims[k].exchange(0u, std::memory_order_relaxed) != 1u ? 1u : 0u;
+				allocator.Free(index, count);
+				++localOps;
+			};
+
+			for (std::uint32_t round = 0; round < rounds; ++round)
+			{
+				auto& mine = live[self];
+				for (std::uint32_t i = 0; i < Batch; ++i)
+				{
+					const std::uint32_t count = 1u + rng() % 4u;
+					const std::uint32_t index = allocator.Allocate(count);
+					++localOps;
+
+					if (index == Allocator::InvalidIndex) { ++localFailed; continue; }
+					if (index + count > capacity)		  { ++localErrors; continue; }
+
+					for (std::uint32_t k = index; k < index + count; ++k)
+						localErrors += claims[k].exchange(1u, std::memory_order_relaxed) != 0u ? 1u : 0u;
+					mine.emplace_back(index, count);
+				}
+
+				//~ everyone frees the front half of its own batch and the back half of its neighbour's
+				sync.arrive_and_wait();
+				auto& other = live[(self + 1u) % threads];
+				const size_t split = other.size() / 2u;
+				for (size_t i = split; i < other.size(); ++i) release(other[i].first, other[i].second);
+				for (size_t i = 0; i < mine.size() / 2u; ++i) release(mine[i].first, mine[i].second);
+
+				sync.arrive_and_wait();
+				mine.clear();
+			}
+
+			allocator.ReleaseThreadCache();
+			operations.fetch_add(localOps, std::memory_order_relaxed);
+			failed	  .fetch_add(localFailed, std::memory_order_relaxed);
+			errors	  .fetch_add(localErrors, std::memory_order_relaxed);
+		};
+
+		const float micro = tests::TimeMicro([&]
+		{
+			std::vector<std::thread> pool;
+			pool.reserve(threads);
+			for (std::uint32_t t = 0; t < threads; ++t) pool.emplace_back(worker, t);
+			for (auto& thread : pool) thread.join();
+		});
+
+		CHECK(errors.load() == 0u);
+		CHECK(failed.load() == 0u);
+
+		//~ with every range freed and every cache let go, the whole range has to be back on the stack
+		CHECK(allocator.GetAllocated() == 0u);
+		CHECK(allocator.GetFreeBlocks() == allocator.GetBlockCount());
+
+		if (bPrint)
+		{
+			std::printf("concurrent descriptors: %u threads, %u ops in %.1f ms (%.0f ns/op)\n",
+				threads, operations.load(), micro / 1000.0f, micro * 1000.0f / static_cast<float>(operations.load()));
+		}
+	}
+} // namespace
+
+int main()
+{
+	TestSingleThread();
+	TestStress(1u, 20'000u, false);
+	TestStress(3u, 50'000u, false);
+	TestStress(8u, 250'000u, true);
+	return tests::Finish("concurrent descriptor allocator");
+}
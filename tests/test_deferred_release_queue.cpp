@@ -0,0 +1,181 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/deferred_release_queue.h"
+
+#include <map>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	//~ stands in for a buffer, counts how many are still alive
+	struct Tracked
+	{
+		static inline int Alive = 0;
+
+		 Tracked() { ++Alive; }
+		 Tracked(Tracked&&) noexcept { ++Alive; }
+		~Tracked() { --Alive; }
+	};
+
+	//~ stands in for DescriptorHeap, handles resolve through a table that a compaction may rewrite
+	struct FakeHeap
+	{
+		std::vector<bool>						 Used = std::vector<bool>(64u, false);
+		std::map<std::uint32_t, std::uint32_t> Handles; // handle -> index
+		std::uint32_t							 Freed{ 0u };
+
+		void Deallocate(const std::uint32_t index, const std::uint32_t count)
+		{
+			for (std::uint32_t i = index; i < index + count; ++i) Used[i] = false;
+			Freed += count;
+		}
+
+		void Deallocate(const std::uint32_t handle)
+		{
+			const auto it = Handles.find(handle);
+			if (it == Handles.end()) return;
+			Deallocate(it->second, 1u);
+			Handles.erase(it);
+		}
+	};
+
+	void TestFakeFence()
+	{
+		DeferredReleaseQueue releases;
+		FakeHeap heap;
+
+		//~ every frame replaces one buffer and four descriptors, the gpu lags two frames behind
+		std::uint64_t completed = 0u;
+		bool bEarly = false;
+		for (std::uint64_t fence = 1u; fence <= 100u; ++fence)
+		{
+			releases.Retire(completed);
+
+			const std::uint32_t base = static_cast<std::uint32_t>(fence % 16u) * 4u;
+			for (std::uint32_t i = 0; i < 4u; ++i)
+			{
+				//~ the slot must have come back before it is handed out again
+				bEarly = bEarly || heap.Used[base + i];
+				heap.Used[base + i] = true;
+			}
+
+			releases.Keep(fence, Tracked{});
+			releases.FreeDescriptors(fence, heap, base, 4u);
+
+			//~ this frame, the one before and the one the gpu is on
+			CHECK(Tracked::Alive == static_cast<int>(fence - completed));
+			CHECK(releases.GetPendingDescriptors() == (fence - completed) * 4u);
+
+			completed = fence >= 2u ? fence - 2u : 0u;
+		}
+
+		CHECK(!bEarly);
+		CHECK(releases.GetPeakPending() == 2u * 3u);
+
+		releases.Flush();
+		CHECK(Tracked::Alive == 0);
+		CHECK(releases.GetPendingCount() == 0u && releases.GetPendingDescriptors() == 0u);
+		CHECK(heap.Freed == 400u);
+		CHECK(releases.GetRetiredCount() == 200u);
+	}
+
+	void TestOutOfOrderWaits()
+	{
+		DeferredReleaseQueue releases;
+		std::vector<int> order;
+
+		releases.Defer(5u, [&] { order.push_back(5); });
+		releases.Defer(3u, [&] { order.push_back(3); });
+
+		//~ 3 completed but the entry in front of it has not
+		CHECK(releases.Retire(4u) == 0u);
+		CHECK(order.empty());
+
+		CHECK(releases.Retire(5u) == 2u);
+		CHECK((order == std::vector<int>{ 5, 3 }));
+	}
+
+	void TestHandleResolvesAtRetire()
+	{
+		DeferredReleaseQueue releases;
+		FakeHeap heap;
+
+		heap.Used[40] = true;
+		heap.Handles[7u] = 40u;
+		releases.FreeHandle(1u, heap, 7u, 1u);
+		CHECK(releases.GetPendingDescriptors() == 1u);
+
+		//~ compacted before the fence passed, the free follows the range
+		heap.Used[40] = false;
+		heap.Used[2]  = true;
+		heap.Handles[7u] = 2u;
+
+		releases.Retire(1u);
+		CHECK(!heap.Used[2]);
+		CHECK(heap.Handles.empty());
+		CHECK(releases.GetPendingDescriptors() == 0u);
+	}
+
+	void TestReleaseMayQueue()
+	{
+		DeferredReleaseQueue releases;
+		int ran = 0;
+
+		//~ a release that queues another entry sees a queue it can push to
+		releases.Defer(1u, [&]
+		{
+			++ran;
+			releases.Defer(2u, [&] { ++ran; });
+		});
+
+		CHECK(releases.Retire(1u) == 1u && ran == 1);
+		CHECK(releases.GetPendingCount() == 1u);
+		releases.Flush();
+		CHECK(ran == 2 && releases.GetPendingCount() == 0u);
+	}
+} // namespace
+
+int main()
+{
+	TestFakeFence();
+	TestOutOfOrderWaits();
+	TestHandleResolvesAtRetire();
+	TestReleaseMayQueue();
+	return tests::Finish("deferred release queue");
+}
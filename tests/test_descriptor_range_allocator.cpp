@@ -0,0 +1,399 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/descriptor_range_allocator.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	using Allocator = DescriptorRangeAllocator;
+
+	//~ a plain bit map next to the allocator, every call is checked against it
+	class Shadowed
+	{
+	public:
+		explicit Shadowed(const std::uint32_t capacity)
+			: m_used(capacity, 0u)
+		{
+			m_allocator.Reset(capacity);
+		}
+
+		std::uint32_t Allocate(const std::uint32_t count)
+		{
+			const std::uint32_t index = m_allocator.Allocate(count);
+			if (index == Allocator::InvalidIndex)
+			{
+				//~ only allowed to fail when no free stretch is long enough
+				CHECK(LongestFree() < count);
+				return index;
+			}
+
+			CHECK(index + count <= Capacity());
+			Mark(index, count, true);
+			return index;
+		}
+
+		bool AllocateAt(const std::uint32_t index, const std::uint32_t count)
+		{
+			const bool bFree = index + count <= Capacity()
+				&& std::all_of(m_used.begin() + index, m_used.begin() + index + count, [](const std::uint8_t u) { return u == 0u; });
+
+			const bool bClaimed = m_allocator.AllocateAt(index, count);
+			CHECK(bClaimed == (bFree && count > 0u));
+			if (bClaimed) Mark(index, count, true);
+			return bClaimed;
+		}
+
+		void Free(const std::uint32_t index, const std::uint32_t count)
+		{
+			std::uint32_t expected = 0u;
+			for (std::uint32_t k = index; k < std::min(index + count, Capacity()); ++k) expected += m_used[k];
+
+			CHECK(m_allocator.Free(index, count) == expected);
+			if (index < Capacity()) Mark(index, std::min(count, Capacity() - index), false);
+		}
+
+		//~ the whole state against the bit map, free lists included
+		void Verify() const
+		{
+			std::uint32_t used = 0u, runs = 0u, largest = 0u;
+			bool bSame = true;
+
+			for (std::uint32_t k = 0, run = 0u; k < Capacity(); ++k)
+			{
+				used  += m_used[k];
+				bSame &= m_allocator.IsAllocated(k) == (m_used[k] != 0u);
+
+				run = m_used[k] ? 0u : run + 1u;
+				if (run == 1u) ++runs;
+				largest = std::max(largest, run);
+			}
+
+			CHECK(bSame);
+			CHECK(m_allocator.GetAllocatedCount() == used);
+			CHECK(m_allocator.GetFreeRunCount() == runs);
+			CHECK(m_allocator.GetLargestFreeRun() == largest);
+
+			const auto stats = m_allocator.GetFragmentation();
+			CHECK(stats.FreeSlots == Capacity() - used);
+			CHECK(stats.FreeRuns == runs);
+			CHECK(stats.LargestFreeRun == largest);
+
+			std::uint32_t histogram = 0u;
+			for (const std::uint32_t bucket : stats.Histogram) histogram += bucket;
+			CHECK(histogram == runs);
+		}
+
+		std::uint32_t LongestFree() const
+		{
+			std::uint32_t largest = 0u;
+			for (std::uint32_t k = 0, run = 0u; k < Capacity(); ++k)
+			{
+				run		= m_used[k] ? 0u : run + 1u;
+				largest = std::max(largest, run);
+			}
+			return largest;
+		}
+
+		std::uint32_t Capacity() const { return static_cast<std::uint32_t>(m_used.size()); }
+		const Allocator& Get() const { return m_allocator; }
+		const std::vector<std::uint8_t>& Used() const { return m_used; }
+
+	private:
+		void Mark(const std::uint32_t index, const std::uint32_t count, const bool bUsed)
+		{
+			for (std::uint32_t k = index; k < index + count; ++k) m_used[k] = bUsed ? 1u : 0u;
+		}
+
+	private:
+		Allocator m_allocator;
+		std::vector<std::uint8_t> m_used;
+	};
+
+	void TestEdges()
+	{
+		Allocator allocator;
+		allocator.Reset(100u);
+
+		CHECK(allocator.Allocate(0u) == Allocator::InvalidIndex);
+		CHECK(allocator.Allocate(101u) == Allocator::InvalidIndex);
+		CHECK(allocator.Allocate(100u) == 0u);
+		CHECK(allocator.Allocate(1u) == Allocator::InvalidIndex);
+		CHECK(allocator.GetFreeRunCount() == 0u);
+		CHECK(allocator.Free(0u, 100u) == 100u);
+		CHECK(allocator.GetFreeRunCount() == 1u && allocator.GetLargestFreeRun() == 100u);
+
+		//~ freeing what was never handed out, or past the end, is ignored
+		CHECK(allocator.Free(10u, 5u) == 0u);
+		CHECK(allocator.Free(200u, 5u) == 0u);
+		CHECK(allocator.Free(0u, 0u) == 0u);
+
+		//~ a free covering two separate allocations returns both and merges around them
+		const std::uint32_t a = allocator.Allocate(10u);
+		const std::uint32_t b = allocator.Allocate(10u);
+		const std::uint32_t c = allocator.Allocate(10u);
+		CHECK(a == 0u && b == 10u && c == 20u);
+		CHECK(allocator.Free(b, 10u) == 10u);
+		CHECK(allocator.GetFreeRunCount() == 2u);
+		CHECK(allocator.Free(0u, 30u) == 20u);
+		CHECK(allocator.GetFreeRunCount() == 1u && allocator.GetAllocatedCount() == 0u);
+
+		//~ AllocateAt splits a run on both sides and refuses anything taken or out of range
+		CHECK(allocator.AllocateAt(40u, 20u));
+		CHECK(allocator.GetFreeRunCount() == 2u);
+		CHECK(!allocator.AllocateAt(50u, 1u));
+		CHECK(!allocator.AllocateAt(30u, 11u));
+		CHECK(!allocator.AllocateAt(95u, 6u));
+		CHECK(!allocator.AllocateAt(100u, 1u));
+		CHECK(allocator.AllocateAt(30u, 10u));
+
+		//~ first fit: lowest start at or below the limit
+		CHECK(allocator.FindFirstFit(30u, 99u) == 0u);
+		CHECK(allocator.FindFirstFit(31u, 99u) == 60u);
+		CHECK(allocator.FindFirstFit(41u, 99u) == Allocator::InvalidIndex);
+		CHECK(allocator.FindFirstFit(40u, 99u) == 60u);
+		CHECK(allocator.FindFirstFit(40u, 59u) == Allocator::InvalidIndex);
+		CHECK(allocator.FindFirstFit(0u, 99u) == Allocator::InvalidIndex);
+
+		CHECK(allocator.NextUsed(0u) == 30u && allocator.NextFree(30u) == 60u);
+		CHECK(allocator.NextUsed(60u) == 100u && allocator.NextFree(100u) == 100u);
+
+		std::vector<Allocator::Run> runs;
+		allocator.CollectRuns(runs);
+		CHECK(runs.size() == 3u);
+		CHECK(runs[0].Start == 0u  && runs[0].Count == 30u && !runs[0].bUsed);
+		CHECK(runs[1].Start == 30u && runs[1].Count == 30u &&  runs[1].bUsed);
+		CHECK(runs[2].Start == 60u && runs[2].Count == 40u && !runs[2].bUsed);
+
+		const auto stats = allocator.GetFragmentation();
+		CHECK(stats.FreeSlots == 70u && stats.FreeRuns == 2u && stats.LargestFreeRun == 40u);
+		CHECK(stats.Fragmentation > 0.42f && stats.Fragmentation < 0.43f);
+		CHECK(stats.Histogram[4] == 1u && stats.Histogram[5] == 1u);
+
+		//~ a capacity that is not a multiple of 64 keeps the bits past the end out of every answer
+		allocator.Reset(70u);
+		CHECK(allocator.AllocateAt(0u, 70u));
+		CHECK(allocator.NextFree(0u) == 70u);
+		CHECK(allocator.FindFirstFit(1u, 1000u) == Allocator::InvalidIndex);
+	}
+
+	void TestRelocate()
+	{
+		Allocator allocator;
+		allocator.Reset(100u);
+
+		CHECK(allocator.Allocate(10u) == 0u);
+		CHECK(allocator.Allocate(20u) == 10u);
+		CHECK(allocator.Allocate(20u) == 30u);
+		CHECK(allocator.Free(0u, 10u) == 10u);
+
+		//~ the hole below is shorter than the range, it only fits counting the range's own slots
+		CHECK(allocator.Relocate(10u, 20u) == 0u);
+		CHECK(allocator.IsAllocated(0u) && allocator.IsAllocated(19u) && !allocator.IsAllocated(20u));
+		CHECK(allocator.Relocate(30u, 20u) == 20u);
+		CHECK(allocator.NextFree(0u) == 40u && allocator.GetFreeRunCount() == 1u);
+
+		//~ nothing lower fits, the range is claimed back where it was
+		CHECK(allocator.Relocate(20u, 20u) == 20u);
+		CHECK(allocator.GetAllocatedCount() == 40u && allocator.NextFree(0u) == 40u);
+
+		//~ a hole far below wins over sliding a little
+		CHECK(allocator.Allocate(10u) == 40u);
+		CHECK(allocator.Allocate(5u) == 50u);
+		CHECK(allocator.Free(0u, 20u) == 20u);
+		CHECK(allocator.Relocate(50u, 5u) == 0u);
+		CHECK(allocator.GetAllocatedCount() == 35u && !allocator.IsAllocated(50u));
+
+		//~ random ranges only ever move down and keep every slot accounted for
+		allocator.Reset(4096u);
+		std::uint32_t state = 17u;
+		auto next = [&state] { state = state * 1664525u + 1013904223u; return state >> 8u; };
+
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> live;
+		for (int i = 0; i < 400; ++i)
+		{
+			const std::uint32_t count = 1u + next() % 12u;
+			if (const std::uint32_t index = allocator.Allocate(count); index != Allocator::InvalidIndex)
+				live.emplace_back(index, count);
+		}
+		for (size_t i = 0; i < live.size(); i += 3u) allocator.Free(live[i].first, live[i].second);
+
+		std::erase_if(live, [&allocator](const auto& range) { return !allocator.IsAllocated(range.first); });
+		std::ranges::sort(live);
+
+		const std::uint32_t allocated = allocator.GetAllocatedCount();
+		bool bDown = true, bClaimed = true;
+		std::uint32_t moved = 0u;
+		for (auto& [index, count] : live)
+		{
+			const std::uint32_t target = allocator.Relocate(index, count);
+			bDown	 = bDown && target <= index;
+			moved	+= target < index ? 1u : 0u;
+			bClaimed = bClaimed && allocator.NextFree(target) >= target + count;
+			index	 = target;
+		}
+
+		CHECK(bDown && bClaimed && moved > 0u);
+		CHECK(allocator.GetAllocatedCount() == allocated);
+		CHECK(allocator.GetFreeRunCount() == 1u && allocator.NextFree(0u) == allocated);
+	}
+
+	void TestRandomAgainstBitmap()
+	{
+		//~ capacities around the word size and the size class edges
+		for (const std::uint32_t capacity : { 1u, 63u, 64u, 65u, 1000u, 4096u, 70'000u })
+		{
+			Shadowed shadow(capacity);
+			std::mt19937 rng{ capacity };
+			std::vector<std::pair<std::uint32_t, std::uint32_t>> live;
+
+			for (std::uint32_t op = 0; op < 20'000u; ++op)
+			{
+				const std::uint32_t roll = rng();
+				const std::uint32_t kind = roll % 100u;
+
+				if (kind < 50u || live.empty())
+				{
+					const std::uint32_t count = (roll >> 8u) % 16u == 0u ? 1u + (roll >> 12u) % 300u : 1u + (roll >> 12u) % 8u;
+					const std::uint32_t index = shadow.Allocate(count);
+					if (index != Allocator::InvalidIndex) live.emplace_back(index, count);
+				}
+				else if (kind < 60u)
+				{
+					//~ a fixed spot, same as compaction picks its target
+					const std::uint32_t count = 1u + (roll >> 8u) % 12u;
+					const std::uint32_t limit = (roll >> 12u) % capacity;
+					const std::uint32_t index = shadow.Get().FindFirstFit(count, limit);
+
+					if (index != Allocator::InvalidIndex)
+					{
+						CHECK(index <= limit);
+						CHECK(shadow.AllocateAt(index, count));
+						live.emplace_back(index, count);
+					}
+					else
+					{
+						//~ nothing long enough may start at or below the limit
+						bool bAnyFits = false;
+						for (std::uint32_t k = 0, run = 0u; k < capacity && !bAnyFits; ++k)
+						{
+							run = shadow.Used()[k] ? 0u : run + 1u;
+							bAnyFits = run >= count && k + 1u - run <= limit;
+						}
+						CHECK(!bAnyFits);
+					}
+				}
+				else if (kind < 63u)
+				{
+					//~ random spot, taken or not
+					shadow.AllocateAt((roll >> 8u) % capacity, 1u + (roll >> 20u) % 6u);
+				}
+				else
+				{
+					const size_t pick = (roll >> 8u) % live.size();
+					const auto [index, count] = live[pick];
+					live[pick] = live.back();
+					live.pop_back();
+					shadow.Free(index, count);
+				}
+
+				if (op % 997u == 0u) shadow.Verify();
+			}
+
+			//~ AllocateAt claims are not in `live`, a full sweep gets everything back
+			shadow.Free(0u, capacity);
+			shadow.Verify();
+			CHECK(shadow.Get().GetFreeRunCount() == 1u);
+		}
+	}
+
+	void BenchmarkChurn()
+	{
+		//~ mostly small tables with the odd big one, frees pick a random live range
+		constexpr std::uint32_t capacity   = 1u << 20u;
+		constexpr std::uint32_t operations = 1'000'000u;
+
+		Allocator allocator;
+		allocator.Reset(capacity);
+
+		std::mt19937 rng{ 42u };
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> live;
+		live.reserve(operations);
+		std::uint32_t failed = 0u;
+
+		const float micro = tests::TimeMicro([&]
+		{
+			for (std::uint32_t op = 0; op < operations; ++op)
+			{
+				const std::uint32_t roll = rng();
+
+				if (live.empty() || (roll & 0xFFu) < 140u)
+				{
+					const std::uint32_t count = (roll >> 8u) % 16u == 0u ? 1u + (roll >> 12u) % 256u : 1u + (roll >> 12u) % 8u;
+					const std::uint32_t index = allocator.Allocate(count);
+
+					if (index == Allocator::InvalidIndex) ++failed;
+					else live.emplace_back(index, count);
+				}
+				else
+				{
+					const size_t pick = (roll >> 8u) % live.size();
+					allocator.Free(live[pick].first, live[pick].second);
+					live[pick] = live.back();
+					live.pop_back();
+				}
+			}
+		});
+
+		std::printf("descriptor ranges: %u ops over %u slots in %.1f ms, %u failed\n",
+			operations, capacity, micro / 1000.0f, failed);
+	}
+} // namespace
+
+int main()
+{
+	TestEdges();
+	TestRelocate();
+	TestRandomAgainstBitmap();
+	BenchmarkChurn();
+	return tests::Finish("descriptor range allocator");
+}
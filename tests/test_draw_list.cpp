@@ -0,0 +1,161 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/draw_list.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	//~ few layers and pipelines, a handful of materials and meshes, spread depth
+	std::vector<DrawPacket> MakePackets(const std::uint32_t count, const std::uint32_t seed)
+	{
+		std::mt19937_64 rng{ seed };
+		std::uniform_int_distribution<std::uint32_t> small(0u, 7u);
+		std::uniform_int_distribution<std::uint32_t> depth(0u, (1u << DrawKey::DepthBits) - 1u);
+
+		std::vector<DrawPacket> packets(count);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			packets[i].Key	= DrawKey::Make(small(rng) & 1u, small(rng), small(rng) * 37u, small(rng) * 911u, depth(rng));
+			packets[i].Item = i;
+		}
+		return packets;
+	}
+
+	bool SameOrder(const std::vector<DrawPacket>& a, const std::vector<DrawPacket>& b)
+	{
+		return std::ranges::equal(a, b, [](const DrawPacket& x, const DrawPacket& y)
+		{
+			return x.Key == y.Key && x.Item == y.Item;
+		});
+	}
+
+	void TestKeyLayout()
+	{
+		//~ fields land in their own bits and mask off what does not fit
+		CHECK(DrawKey::Make(1u, 0u, 0u, 0u, 0u) == 1ull << DrawKey::LayerShift);
+		CHECK(DrawKey::Make(0u, 0u, 0u, 0u, 1u) == 1ull);
+		CHECK(DrawKey::Make(0u, 0u, 0u, 1u << DrawKey::MeshBits, 0u) == 0ull);
+		CHECK(DrawKey::Make(0u, 1u, 0u, 0u, 0u) > DrawKey::Make(0u, 0u, 0xFFFu, 0xFFFFu, 0xFFFFFFu));
+
+		CHECK(DrawKey::QuantizeDepth(-1.0f, 100.0f) == 0u);
+		CHECK(DrawKey::QuantizeDepth(500.0f, 100.0f) == (1u << DrawKey::DepthBits) - 1u);
+		CHECK(DrawKey::QuantizeDepth(10.0f, 100.0f) < DrawKey::QuantizeDepth(20.0f, 100.0f));
+		CHECK(DrawKey::QuantizeDepth(10.0f, 0.0f) == 0u);
+	}
+
+	void TestMatchesStableSort()
+	{
+		std::vector<DrawPacket> scratch;
+		for (const std::uint32_t count : { 0u, 1u, 2u, 3u, 17u, 256u, 1000u, 4097u, 100'000u })
+		{
+			auto packets  = MakePackets(count, 7u + count);
+			auto expected = packets;
+			std::ranges::stable_sort(expected, {}, &DrawPacket::Key);
+
+			DrawList::RadixSort(packets, scratch);
+			CHECK(SameOrder(packets, expected));
+		}
+	}
+
+	void TestSkippedDigits()
+	{
+		//~ every key equal, and keys that differ in a single byte: both skip passes
+		std::vector<DrawPacket> scratch;
+
+		std::vector<DrawPacket> equal(500, DrawPacket{ 0x1234'5678'9ABC'DEF0ull, 0u, 0u });
+		for (std::uint32_t i = 0; i < equal.size(); ++i) equal[i].Item = i;
+		auto expected = equal;
+		DrawList::RadixSort(equal, scratch);
+		CHECK(SameOrder(equal, expected));
+
+		for (const std::uint32_t shift : { 0u, 24u, 56u })
+		{
+			std::vector<DrawPacket> packets(300);
+			for (std::uint32_t i = 0; i < packets.size(); ++i)
+				packets[i] = { static_cast<std::uint64_t>((i * 97u) & 0xFFu) << shift, i, 0u };
+
+			expected = packets;
+			std::ranges::stable_sort(expected, {}, &DrawPacket::Key);
+			DrawList::RadixSort(packets, scratch);
+			CHECK(SameOrder(packets, expected));
+		}
+	}
+
+	void TestDrawList()
+	{
+		DrawList list;
+		list.Reserve(4u);
+		list.Add(DrawKey::Make(0u, 2u, 0u, 0u, 0u), 0u);
+		list.Add(DrawKey::Make(0u, 1u, 0u, 0u, 5u), 1u);
+		list.Add(DrawKey::Make(0u, 1u, 0u, 0u, 2u), 2u);
+		list.Sort();
+
+		const auto& packets = list.GetPackets();
+		CHECK(packets.size() == 3u);
+		CHECK(packets[0].Item == 2u && packets[1].Item == 1u && packets[2].Item == 0u);
+
+		list.Clear();
+		CHECK(list.GetPackets().empty());
+	}
+
+	void BenchmarkSort()
+	{
+		constexpr std::uint32_t count = 100'000u;
+
+		auto packets = MakePackets(count, 1234u);
+		std::vector<DrawPacket> scratch;
+		scratch.reserve(count);
+
+		const float micro = tests::TimeMicro([&] { DrawList::RadixSort(packets, scratch); });
+		std::printf("radix sort: %u packets in %.1f us\n", count, micro);
+	}
+} // namespace
+
+int main()
+{
+	TestKeyLayout();
+	TestMatchesStableSort();
+	TestSkippedDigits();
+	TestDrawList();
+	BenchmarkSort();
+	return tests::Finish("draw list");
+}
@@ -0,0 +1,185 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/dynamic_mesh_scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	//~ rows come around like a queue: any run of frames shorter than a cycle updates a row at most
+	//~ once, any run of a whole cycle updates every row at least once
+	void CheckCycles(DynamicMeshScheduler& scheduler, const std::uint32_t rows, const std::uint32_t perFrame)
+	{
+		const std::vector<float> distances(rows, 0.0f);
+		std::vector<std::atomic<std::uint32_t>> hits(rows);
+		std::vector<std::vector<std::uint32_t>> frames;
+
+		const std::uint32_t cycle = (rows + perFrame - 1u) / perFrame;
+		for (std::uint32_t frame = 0; frame < cycle * 4u; ++frame)
+		{
+			const std::uint32_t updated = scheduler.Update(distances, [&](const std::uint32_t row) { hits[row].fetch_add(1u); });
+			CHECK(updated == perFrame);
+			frames.push_back(scheduler.GetUpdatedRows());
+		}
+
+		bool bAtMostOnce = true, bAtLeastOnce = true;
+		for (size_t first = 0; first < frames.size(); ++first)
+		{
+			std::vector<std::uint32_t> seen(rows, 0u);
+			for (size_t frame = first; frame < frames.size() && frame - first < cycle; ++frame)
+			{
+				for (const std::uint32_t row : frames[frame]) ++seen[row];
+
+				const size_t length = frame - first + 1u;
+				if (length * perFrame <= rows) bAtMostOnce = bAtMostOnce && std::ranges::max(seen) <= 1u;
+				if (length == cycle)		   bAtLeastOnce = bAtLeastOnce && std::ranges::min(seen) >= 1u;
+			}
+		}
+		CHECK(bAtMostOnce);
+		CHECK(bAtLeastOnce);
+
+		std::uint32_t total = 0u;
+		for (const auto& hit : hits) total += hit.load();
+		CHECK(total == cycle * 4u * perFrame);
+	}
+
+	void TestQuotaCycles()
+	{
+		//~ 103 rows at 10% is 11 a frame, the tenth frame wraps into the next cycle
+		DynamicMeshSchedulerConfig config{};
+		config.RowCount			  = 103u;
+		config.RowFraction		  = 0.1f;
+		config.BudgetMicroseconds = 1e9f;
+
+		DynamicMeshScheduler scheduler;
+		scheduler.Initialize(config);
+		CheckCycles(scheduler, 103u, 11u);
+	}
+
+	void TestBudgetCycles()
+	{
+		//~ no time at all, serial runs one row before the budget check stops it
+		DynamicMeshSchedulerConfig config{};
+		config.RowCount			  = 37u;
+		config.RowFraction		  = 0.3f;
+		config.BudgetMicroseconds = 0.0f;
+
+		DynamicMeshScheduler scheduler;
+		scheduler.Initialize(config);
+		CheckCycles(scheduler, 37u, 1u);
+	}
+
+	void TestParallelCycles(JobSystem& jobs)
+	{
+		//~ batches of grain * (workers + 1) rows between budget checks, the budget ends a frame after one batch
+		DynamicMeshSchedulerConfig config{};
+		config.RowCount			  = 211u;
+		config.RowFraction		  = 1.0f;
+		config.BudgetMicroseconds = 0.0f;
+		config.ParallelGrain	  = 3u;
+
+		DynamicMeshScheduler scheduler;
+		scheduler.SetJobSystem(&jobs);
+		scheduler.Initialize(config);
+		CheckCycles(scheduler, 211u, 3u * (jobs.GetWorkerCount() + 1u));
+	}
+
+	void TestCloseRowsFirst()
+	{
+		DynamicMeshSchedulerConfig config{};
+		config.RowCount			  = 10u;
+		config.RowFraction		  = 0.2f;
+		config.BudgetMicroseconds = 1e9f;
+
+		DynamicMeshScheduler scheduler;
+		scheduler.Initialize(config);
+
+		//~ all equally stale, the two closest rows go first
+		std::vector<float> distances(10u, 100.0f);
+		distances[7] = 0.0f;
+		distances[2] = 1.0f;
+
+		scheduler.Update(distances, [](std::uint32_t) {});
+		CHECK((scheduler.GetUpdatedRows() == std::vector<std::uint32_t>{ 7u, 2u }));
+	}
+
+	void TestDirtyRanges()
+	{
+		DynamicMeshSchedulerConfig config{};
+		config.RowCount = 20u;
+
+		DynamicMeshScheduler scheduler;
+		scheduler.Initialize(config);
+
+		scheduler.MarkDirty(2u, 3u);
+		scheduler.MarkDirty(5u);
+		scheduler.MarkDirty(9u, 2u);
+		scheduler.MarkDirty(18u, 10u); // clipped to the last rows
+		scheduler.MarkDirty(25u);	   // past the end, ignored
+
+		std::vector<DirtyRowRange> ranges;
+		scheduler.CollectDirtyRanges(ranges);
+		CHECK(ranges.size() == 3u);
+		CHECK(ranges[0].FirstRow == 2u && ranges[0].RowCount == 4u);
+		CHECK(ranges[1].FirstRow == 9u && ranges[1].RowCount == 2u);
+		CHECK(ranges[2].FirstRow == 18u && ranges[2].RowCount == 2u);
+
+		//~ collecting clears them
+		scheduler.CollectDirtyRanges(ranges);
+		CHECK(ranges.empty());
+	}
+} // namespace
+
+int main()
+{
+	TestQuotaCycles();
+	TestBudgetCycles();
+	TestCloseRowsFirst();
+	TestDirtyRanges();
+
+	JobSystem jobs;
+	jobs.Initialize(3u);
+	TestParallelCycles(jobs);
+	jobs.Shutdown();
+
+	return tests::Finish("dynamic mesh scheduler");
+}
@@ -0,0 +1,297 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/frustum_culler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace framework;
+using namespace DirectX;
+
+namespace
+{
+	XMFLOAT4X4 Multiply(const XMFLOAT4X4& a, const XMFLOAT4X4& b)
+	{
+		XMFLOAT4X4 result{};
+		for (int r = 0; r < 4; ++r)
+			for (int c = 0; c < 4; ++c)
+				for (int k = 0; k < 4; ++k)
+					result.m[r][c] += a.m[r][k] * b.m[k][c];
+		return result;
+	}
+
+	//~ camera at eye turned by yaw around y, d3d left handed perspective, row vector layout
+	XMFLOAT4X4 MakeViewProjection(const XMFLOAT3& eye, const float yaw, const float nearZ, const float farZ)
+	{
+		const float c = std::cos(yaw), s = std::sin(yaw);
+
+		XMFLOAT4X4 view{};
+		view.m[0][0] = c;  view.m[0][2] = s;
+		view.m[1][1] = 1.0f;
+		view.m[2][0] = -s; view.m[2][2] = c;
+		view.m[3][0] = -(eye.x * c - eye.z * s);
+		view.m[3][1] = -eye.y;
+		view.m[3][2] = -(eye.x * s + eye.z * c);
+		view.m[3][3] = 1.0f;
+
+		const float yScale = 1.0f / std::tan(0.5f * 1.0f);
+		const float xScale = yScale / (16.0f / 9.0f);
+		const float range  = farZ / (farZ - nearZ);
+
+		XMFLOAT4X4 projection{};
+		projection.m[0][0] = xScale;
+		projection.m[1][1] = yScale;
+		projection.m[2][2] = range;
+		projection.m[2][3] = 1.0f;
+		projection.m[3][2] = -nearZ * range;
+
+		return Multiply(view, projection);
+	}
+
+	//~ clip space reference on the eight corners. Returns how far inside the box reaches for the
+	//~ plane it is worst against: negative means every corner is behind one plane, so culled.
+	float ReferenceMargin(const XMFLOAT4X4& vp, const XMFLOAT3& center, const XMFLOAT3& extents)
+	{
+		float worst = INFINITY;
+		float planeBest[6] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			const float p[4] =
+			{
+				center.x + ((corner & 1) ? extents.x : -extents.x),
+				center.y + ((corner & 2) ? extents.y : -extents.y),
+				center.z + ((corner & 4) ? extents.z : -extents.z),
+				1.0f
+			};
+
+			float clip[4]{};
+			for (int c = 0; c < 4; ++c)
+				for (int k = 0; k < 4; ++k)
+					clip[c] += p[k] * vp.m[k][c];
+
+			const float planes[6] =
+			{
+				clip[3] + clip[0], clip[3] - clip[0],
+				clip[3] + clip[1], clip[3] - clip[1],
+				clip[2],		   clip[3] - clip[2],
+			};
+			for (int i = 0; i < 6; ++i) planeBest[i] = std::max(planeBest[i], planes[i]);
+		}
+
+		for (const float best : planeBest) worst = std::min(worst, best);
+		return worst;
+	}
+
+	void TestMatchesCornerReference()
+	{
+		std::mt19937 rng{ 99u };
+		std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+		std::uniform_real_distribution<float> size(0.05f, 8.0f);
+		std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+
+		for (int frustum = 0; frustum < 8; ++frustum)
+		{
+			const XMFLOAT4X4 vp = MakeViewProjection({ position(rng) * 0.2f, 3.0f, position(rng) * 0.2f }, angle(rng), 0.5f, 150.0f);
+
+			FrustumCuller culler;
+			culler.SetViewProjection(vp);
+
+			constexpr std::uint32_t count = 5003u;
+			std::vector<bool> expected(count);
+			std::vector<bool> clear(count); // not within float noise of a plane
+
+			culler.Reserve(count);
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				const XMFLOAT3 center { position(rng), position(rng) * 0.1f, position(rng) };
+				const XMFLOAT3 extents{ size(rng), size(rng), size(rng) };
+				culler.AddWorld(i, center, extents);
+
+				const float margin = ReferenceMargin(vp, center, extents);
+				expected[i] = margin >= 0.0f;
+				clear[i]	= std::fabs(margin) > 1e-3f;
+			}
+
+			culler.Cull();
+			const auto& visible = culler.GetVisible();
+
+			//~ survivors keep the order they were added in
+			bool bOrdered = true;
+			for (size_t k = 1; k < visible.size(); ++k) bOrdered &= visible[k - 1] < visible[k];
+			CHECK(bOrdered);
+
+			std::vector<bool> got(count);
+			for (const std::uint32_t id : visible) got[id] = true;
+
+			std::uint32_t mismatches = 0u, inside = 0u;
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				if (clear[i] && got[i] != expected[i]) ++mismatches;
+				inside += expected[i] ? 1u : 0u;
+			}
+			CHECK(mismatches == 0u);
+			CHECK(inside > 0u && inside < count);
+			CHECK(culler.GetCount() == count);
+		}
+	}
+
+	void TestTailAndEmpty()
+	{
+		//~ counts that do not fill the last simd group, and an empty cull
+		FrustumCuller culler;
+		culler.SetViewProjection(MakeViewProjection({ 0.0f, 0.0f, 0.0f }, 0.0f, 0.5f, 100.0f));
+		CHECK(culler.Cull() == 0u);
+
+		for (std::uint32_t count = 1u; count <= 9u; ++count)
+		{
+			culler.Clear();
+			for (std::uint32_t i = 0; i < count; ++i)
+				culler.AddWorld(100u + i, { 0.0f, 0.0f, 10.0f + static_cast<float>(i) }, { 0.5f, 0.5f, 0.5f });
+
+			CHECK(culler.Cull() == count);
+			CHECK(culler.GetVisible().size() == count);
+			CHECK(culler.GetVisible().back() == 100u + count - 1u);
+		}
+
+		//~ behind the camera and past the far plane
+		culler.Clear();
+		culler.AddWorld(1u, { 0.0f, 0.0f, -10.0f }, { 1.0f, 1.0f, 1.0f });
+		culler.AddWorld(2u, { 0.0f, 0.0f, 500.0f }, { 1.0f, 1.0f, 1.0f });
+		culler.AddWorld(3u, { 0.0f, 0.0f,  50.0f }, { 1.0f, 1.0f, 1.0f });
+		CHECK(culler.Cull() == 1u && culler.GetVisible()[0] == 3u);
+
+		//~ boxes added after a cull without a Clear line up with their ids
+		culler.AddWorld(4u, { 0.0f, 0.0f, 20.0f }, { 1.0f, 1.0f, 1.0f });
+		culler.AddWorld(5u, { 0.0f, 0.0f, -20.0f }, { 1.0f, 1.0f, 1.0f });
+		CHECK(culler.GetCount() == 5u);
+		CHECK(culler.Cull() == 2u);
+		CHECK(culler.GetVisible().size() == 2u && culler.GetVisible()[0] == 3u && culler.GetVisible()[1] == 4u);
+
+		XMFLOAT3 center, extents;
+		culler.GetWorldBounds(3u, center, extents);
+		CHECK(center.z == 20.0f && extents.x == 1.0f);
+	}
+
+	void TestTransformedBounds()
+	{
+		//~ world box of a rotated, scaled, moved local box encloses every transformed corner
+		const float c = std::cos(0.7f), s = std::sin(0.7f);
+
+		XMFLOAT4X4 world{}; // row vector layout: scale 2, rotate around z, move
+		world.m[0][0] =  2.0f * c; world.m[0][1] = 2.0f * s;
+		world.m[1][0] = -2.0f * s; world.m[1][1] = 2.0f * c;
+		world.m[2][2] =  2.0f;
+		world.m[3][0] = 5.0f; world.m[3][1] = -3.0f; world.m[3][2] = 20.0f; world.m[3][3] = 1.0f;
+
+		XMFLOAT4X4 transposed{};
+		for (int r = 0; r < 4; ++r)
+			for (int k = 0; k < 4; ++k)
+				transposed.m[r][k] = world.m[k][r];
+
+		const XMFLOAT3 center{ 1.0f, 0.5f, -1.0f }, extents{ 1.0f, 2.0f, 0.5f };
+
+		FrustumCuller culler;
+		culler.Add(7u, center, extents, transposed);
+
+		XMFLOAT3 worldCenter, worldExtents;
+		culler.GetWorldBounds(0u, worldCenter, worldExtents);
+
+		constexpr float epsilon = 1e-4f;
+		bool bEnclosed = true, bTouches[3] = {};
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			const float p[3] =
+			{
+				center.x + ((corner & 1) ? extents.x : -extents.x),
+				center.y + ((corner & 2) ? extents.y : -extents.y),
+				center.z + ((corner & 4) ? extents.z : -extents.z),
+			};
+
+			const float w[3] =
+			{
+				p[0] * world.m[0][0] + p[1] * world.m[1][0] + p[2] * world.m[2][0] + world.m[3][0],
+				p[0] * world.m[0][1] + p[1] * world.m[1][1] + p[2] * world.m[2][1] + world.m[3][1],
+				p[0] * world.m[0][2] + p[1] * world.m[1][2] + p[2] * world.m[2][2] + world.m[3][2],
+			};
+
+			const float wc[3] = { worldCenter.x, worldCenter.y, worldCenter.z };
+			const float we[3] = { worldExtents.x, worldExtents.y, worldExtents.z };
+			for (int a = 0; a < 3; ++a)
+			{
+				const float reach = std::fabs(w[a] - wc[a]);
+				bEnclosed &= reach <= we[a] + epsilon;
+				bTouches[a] |= std::fabs(reach - we[a]) <= epsilon;
+			}
+		}
+
+		//~ enclosing and tight: some corner reaches each face
+		CHECK(bEnclosed);
+		CHECK(bTouches[0] && bTouches[1] && bTouches[2]);
+	}
+
+	void BenchmarkCull()
+	{
+		constexpr std::uint32_t count = 1'000'000u;
+
+		FrustumCuller culler;
+		culler.SetViewProjection(MakeViewProjection({ 0.0f, 5.0f, -50.0f }, 0.3f, 0.5f, 300.0f));
+		culler.Reserve(count);
+
+		std::mt19937 rng{ 42u };
+		std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+		std::uniform_real_distribution<float> size(0.1f, 2.0f);
+
+		for (std::uint32_t i = 0; i < count; ++i)
+			culler.AddWorld(i, { position(rng), position(rng) * 0.1f, position(rng) }, { size(rng), size(rng), size(rng) });
+
+		std::uint32_t visible = 0u;
+		const float micro = tests::TimeMicro([&] { visible = culler.Cull(); });
+		std::printf("frustum cull: %u / %u visible in %.1f us\n", visible, count, micro);
+	}
+} // namespace
+
+int main()
+{
+	TestMatchesCornerReference();
+	TestTailAndEmpty();
+	TestTransformedBounds();
+	BenchmarkCull();
+	return tests::Finish("frustum culler");
+}
@@ -0,0 +1,242 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	void TestParallelForCoversOnce(JobSystem& jobs)
+	{
+		std::vector<std::atomic<std::uint32_t>> hits(100003u);
+		jobs.ParallelFor(static_cast<std::uint32_t>(hits.size()), 97u, [&](const std::uint32_t begin, const std::uint32_t end)
+		{
+			for (std::uint32_t i = begin; i < end; ++i) hits[i].fetch_add(1u, std::memory_order_relaxed);
+		});
+
+		bool bOnce = true;
+		for (const auto& hit : hits) bOnce = bOnce && hit.load() == 1u;
+		CHECK(bOnce);
+	}
+
+	void TestNestedParallelFor(JobSystem& jobs)
+	{
+		std::atomic<std::uint64_t> sum{ 0u };
+		jobs.ParallelFor(64u, 1u, [&](const std::uint32_t begin, const std::uint32_t end)
+		{
+			for (std::uint32_t outer = begin; outer < end; ++outer)
+			{
+				jobs.ParallelFor(1000u, 10u, [&](const std::uint32_t b, const std::uint32_t e)
+				{
+					std::uint64_t local = 0u;
+					for (std::uint32_t i = b; i < e; ++i) local += i;
+					sum.fetch_add(local, std::memory_order_relaxed);
+				});
+			}
+		});
+		CHECK(sum.load() == 64ull * (999ull * 1000ull / 2ull));
+	}
+
+	void TestRunAfter(JobSystem& jobs)
+	{
+		std::atomic<std::uint32_t> first{ 0u };
+		std::atomic<bool> bOrdered{ true };
+
+		JobCounter dependency, done;
+		for (int i = 0; i < 32; ++i)
+		{
+			jobs.Run([&] { first.fetch_add(1u); }, &dependency);
+		}
+		for (int i = 0; i < 8; ++i)
+		{
+			jobs.RunAfter(dependency, [&] { if (first.load() != 32u) bOrdered = false; }, &done);
+		}
+
+		jobs.Wait(done);
+		CHECK(bOrdered.load());
+		CHECK(dependency.IsDone() && done.IsDone());
+	}
+
+	void TestWaitRethrows(JobSystem& jobs)
+	{
+		std::atomic<std::uint32_t> ran{ 0u };
+		JobCounter counter;
+		for (int i = 0; i < 16; ++i)
+		{
+			jobs.Run([&, i]
+			{
+				ran.fetch_add(1u);
+				if (i % 4 == 0) throw std::runtime_error("job " + std::to_string(i));
+			}, &counter);
+		}
+
+		bool bThrown = false;
+		try { jobs.Wait(counter); }
+		catch (const std::runtime_error&) { bThrown = true; }
+
+		//~ one error surfaces, the other jobs of the group still ran
+		CHECK(bThrown);
+		CHECK(ran.load() == 16u);
+
+		//~ the error was taken, the counter is clean for the next group
+		jobs.Run([&] { ran.fetch_add(1u); }, &counter);
+		bThrown = false;
+		try { jobs.Wait(counter); }
+		catch (...) { bThrown = true; }
+		CHECK(!bThrown && ran.load() == 17u);
+	}
+
+	void TestDetachedError(JobSystem& jobs)
+	{
+		std::atomic<bool> bDone{ false };
+		jobs.Run([&] { bDone = true; throw std::logic_error("detached"); });
+		while (!bDone.load()) {}
+		//~ the worker records the error right after the flag, give it time to land
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+		//~ an unrelated Wait stays scoped to its own counter
+		JobCounter counter;
+		jobs.Run([] {}, &counter);
+
+		bool bThrown = false;
+		try { jobs.Wait(counter); }
+		catch (...) { bThrown = true; }
+		CHECK(!bThrown);
+
+		//~ the job without a counter reports through RethrowDetached, exactly once
+		bThrown = false;
+		try { jobs.RethrowDetached(); }
+		catch (const std::logic_error&) { bThrown = true; }
+		CHECK(bThrown);
+
+		bThrown = false;
+		try { jobs.RethrowDetached(); }
+		catch (...) { bThrown = true; }
+		CHECK(!bThrown);
+	}
+
+	void TestParallelForRethrows(JobSystem& jobs)
+	{
+		bool bThrown = false;
+		try
+		{
+			jobs.ParallelFor(1000u, 10u, [](const std::uint32_t begin, const std::uint32_t)
+			{
+				if (begin == 500u) throw std::out_of_range("chunk");
+			});
+		}
+		catch (const std::out_of_range&) { bThrown = true; }
+		CHECK(bThrown);
+	}
+
+	void TestRunOnWorker(JobSystem& jobs)
+	{
+		const std::thread::id main = std::this_thread::get_id();
+		std::atomic<std::uint32_t> onMain{ 0u };
+
+		//~ every worker is held up, the main thread is the only one free while it waits
+		std::atomic<bool> bGo{ false };
+		std::atomic<std::uint32_t> started{ 0u };
+		JobCounter blockers;
+		for (std::uint32_t i = 0; i < jobs.GetWorkerCount(); ++i)
+		{
+			jobs.RunOnWorker([&] { started.fetch_add(1u); while (!bGo.load()) std::this_thread::yield(); }, &blockers);
+		}
+		while (started.load() < jobs.GetWorkerCount()) std::this_thread::yield();
+
+		JobCounter counter;
+		jobs.RunOnWorker([&] { if (std::this_thread::get_id() == main) onMain.fetch_add(1u); }, &counter);
+
+		std::thread release([&] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); bGo = true; });
+		jobs.Wait(counter);
+		jobs.Wait(blockers);
+		release.join();
+		CHECK(onMain.load() == 0u);
+
+		//~ a worker only job still running does not hold up the main thread's own ParallelFor
+		std::atomic<bool> bRelease{ false };
+		std::atomic<std::uint32_t> chunks{ 0u };
+		JobCounter simulation;
+		jobs.RunOnWorker([&] { while (!bRelease.load()) std::this_thread::yield(); }, &simulation);
+		jobs.ParallelFor(64u, 1u, [&](const std::uint32_t, const std::uint32_t) { chunks.fetch_add(1u); });
+		CHECK(chunks.load() == 64u && !simulation.IsDone());
+
+		bRelease = true;
+		jobs.Wait(simulation);
+		CHECK(simulation.IsDone());
+	}
+
+	void TestWithoutWorkers()
+	{
+		JobSystem jobs;
+
+		//~ not initialized, everything runs inline on the caller
+		std::uint32_t count = 0u;
+		JobCounter counter;
+		jobs.Run([&] { ++count; }, &counter);
+		jobs.RunOnWorker([&] { ++count; }, &counter);
+		jobs.ParallelFor(10u, 1u, [&](const std::uint32_t begin, const std::uint32_t end) { count += end - begin; });
+		jobs.Wait(counter);
+		CHECK(count == 12u && counter.IsDone());
+	}
+} // namespace
+
+int main()
+{
+	JobSystem jobs;
+	jobs.Initialize(3u);
+	CHECK(jobs.IsInitialized() && jobs.GetWorkerCount() == 3u);
+
+	TestParallelForCoversOnce(jobs);
+	TestNestedParallelFor(jobs);
+	TestRunAfter(jobs);
+	TestWaitRethrows(jobs);
+	TestDetachedError(jobs);
+	TestParallelForRethrows(jobs);
+	TestRunOnWorker(jobs);
+	jobs.Shutdown();
+
+	TestWithoutWorkers();
+	return tests::Finish("job system");
+}
@@ -0,0 +1,277 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/light_cluster_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace framework;
+using namespace DirectX;
+
+namespace
+{
+	constexpr float NearZ{ 0.5f };
+	constexpr float FarZ { 120.0f };
+	constexpr float ProjX{ 1.2f };
+	constexpr float ProjY{ 2.1f };
+	const XMFLOAT3	Eye	 { 10.0f, 2.0f, -5.0f };
+
+	struct TestLight
+	{
+		XMFLOAT3 Position;
+		XMFLOAT3 Direction;
+		float	 Range;
+		float	 Power; // 0 for a point light
+	};
+
+	void SetCamera(LightClusterGrid& grid)
+	{
+		//~ camera at Eye looking down +z, only _11 and _22 of the projection are read
+		XMFLOAT4X4 view{};
+		view.m[0][0] = view.m[1][1] = view.m[2][2] = view.m[3][3] = 1.0f;
+		view.m[3][0] = -Eye.x; view.m[3][1] = -Eye.y; view.m[3][2] = -Eye.z;
+
+		XMFLOAT4X4 projection{};
+		projection.m[0][0] = ProjX;
+		projection.m[1][1] = ProjY;
+
+		grid.SetView(view, projection, NearZ, FarZ);
+	}
+
+	std::vector<TestLight> MakeLights(const std::uint32_t count, const std::uint32_t seed)
+	{
+		std::mt19937 rng{ seed };
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> distance(NearZ, 80.0f);
+		std::uniform_real_distribution<float> range(0.5f, 6.0f);
+		std::uniform_real_distribution<float> power(2.0f, 64.0f);
+
+		std::vector<TestLight> lights(count);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			//~ a little outside the frustum too, those still light the edge clusters
+			const float z = distance(rng);
+			auto& light = lights[i];
+			light.Position = { Eye.x + 1.2f * unit(rng) * z / ProjX, Eye.y + 1.2f * unit(rng) * z / ProjY, Eye.z + z };
+			light.Range	   = range(rng);
+			light.Power	   = (i % 3u) ? power(rng) : 0.0f;
+
+			const XMFLOAT3 d{ unit(rng), unit(rng), unit(rng) };
+			const float length = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z) + 1e-6f;
+			light.Direction = { d.x / length, d.y / length, d.z / length };
+		}
+		return lights;
+	}
+
+	void Fill(LightClusterGrid& grid, const std::vector<TestLight>& lights)
+	{
+		grid.Clear();
+		grid.Reserve(static_cast<std::uint32_t>(lights.size()));
+		for (const auto& light : lights)
+		{
+			if (light.Power > 0.0f) grid.AddSpot (light.Position, light.Direction, light.Range, light.Power);
+			else					grid.AddPoint(light.Position, light.Range);
+		}
+	}
+
+	//~ what the pixel shader computes: in range and spot factor above the cutoff, with a little
+	//~ slack so float noise at the exact edge does not count as lit
+	bool IsLit(const TestLight& light, const XMFLOAT3& world)
+	{
+		const float dx = world.x - light.Position.x, dy = world.y - light.Position.y, dz = world.z - light.Position.z;
+		const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (distance >= light.Range * 0.999f) return false;
+		if (light.Power <= 0.0f) return true;
+		if (distance <= 1e-4f) return false;
+
+		const float cosine = (dx * light.Direction.x + dy * light.Direction.y + dz * light.Direction.z) / distance;
+		return std::pow(std::max(cosine, 0.0f), light.Power) > LightClusterGrid::SpotCutoff * 1.01f;
+	}
+
+	//~ the shader's cluster lookup, false when the sample sits on a cluster edge
+	bool FindCluster(const LightClusterGrid& grid, const float ndcX, const float ndcY, const float z, std::uint32_t& cluster)
+	{
+		const float fx = (ndcX + 1.0f) * 0.5f * static_cast<float>(grid.GetCountX());
+		const float fy = (1.0f - ndcY) * 0.5f * static_cast<float>(grid.GetCountY());
+		const float fz = std::log(z) * grid.GetDepthScale() + grid.GetDepthBias();
+
+		for (const float f : { fx, fy, fz })
+		{
+			const float fraction = f - std::floor(f);
+			if (fraction < 1e-3f || fraction > 1.0f - 1e-3f) return false;
+		}
+
+		const auto i = std::min(static_cast<std::uint32_t>(fx), grid.GetCountX() - 1u);
+		const auto j = std::min(static_cast<std::uint32_t>(fy), grid.GetCountY() - 1u);
+		const auto k = std::min(static_cast<std::uint32_t>(std::max(fz, 0.0f)), grid.GetCountZ() - 1u);
+		cluster = (k * grid.GetCountY() + j) * grid.GetCountX() + i;
+		return true;
+	}
+
+	void TestNoLitSampleMissing(JobSystem& jobs)
+	{
+		const auto lights = MakeLights(1200u, 5u);
+
+		LightClusterGrid grid;
+		grid.SetJobSystem(&jobs);
+		SetCamera(grid);
+		Fill(grid, lights);
+		grid.Assign();
+
+		const auto& ranges	= grid.GetRanges();
+		const auto& indices = grid.GetIndices();
+
+		//~ every cluster list is in add order and never overflows with this many lights
+		bool bSorted = true, bFull = false;
+		for (const auto& range : ranges)
+		{
+			bFull |= range.Count >= LightClusterGrid::MaxLightsPerCluster;
+			for (std::uint32_t n = 1; n < range.Count; ++n)
+				bSorted &= indices[range.Offset + n - 1u] < indices[range.Offset + n];
+		}
+		CHECK(bSorted);
+		CHECK(!bFull);
+
+		std::mt19937 rng{ 17u };
+		std::uniform_real_distribution<float> ndc(-0.999f, 0.999f);
+		std::uniform_real_distribution<float> depth(std::log(NearZ * 1.01f), std::log(FarZ * 0.99f));
+
+		std::uint32_t missing = 0u, lit = 0u, samples = 0u;
+		while (samples < 50'000u)
+		{
+			const float x = ndc(rng), y = ndc(rng), z = std::exp(depth(rng));
+
+			std::uint32_t cluster;
+			if (!FindCluster(grid, x, y, z, cluster)) continue;
+			++samples;
+
+			const XMFLOAT3 world{ Eye.x + x * z / ProjX, Eye.y + y * z / ProjY, Eye.z + z };
+			const auto& range = ranges[cluster];
+			const auto begin = indices.begin() + range.Offset;
+			const auto end	 = begin + range.Count;
+
+			for (std::uint32_t id = 0; id < lights.size(); ++id)
+			{
+				if (!IsLit(lights[id], world)) continue;
+
+				++lit;
+				if (!std::binary_search(begin, end, id)) ++missing;
+			}
+		}
+
+		CHECK(missing == 0u);
+		CHECK(lit > 1000u); // the scene actually lights something
+		CHECK(indices.size() < static_cast<size_t>(lights.size()) * grid.GetClusterCount() / 8u); // and still culls
+	}
+
+	void TestSerialMatchesParallel(JobSystem& jobs)
+	{
+		const auto lights = MakeLights(2000u, 11u);
+
+		LightClusterGrid serial, parallel;
+		parallel.SetJobSystem(&jobs);
+
+		for (auto* grid : { &serial, &parallel })
+		{
+			grid->SetGridSize(12u, 7u, 20u);
+			SetCamera(*grid);
+			Fill(*grid, lights);
+		}
+
+		CHECK(serial.Assign() == parallel.Assign());
+		CHECK(serial.GetIndices() == parallel.GetIndices());
+
+		bool bSameRanges = serial.GetRanges().size() == parallel.GetRanges().size();
+		for (size_t c = 0; bSameRanges && c < serial.GetRanges().size(); ++c)
+		{
+			bSameRanges = serial.GetRanges()[c].Offset == parallel.GetRanges()[c].Offset
+					   && serial.GetRanges()[c].Count  == parallel.GetRanges()[c].Count;
+		}
+		CHECK(bSameRanges);
+	}
+
+	void TestEmptyAndOutside()
+	{
+		LightClusterGrid grid;
+		SetCamera(grid);
+		CHECK(grid.Assign() == 0u);
+
+		//~ behind the camera and past the far plane touch nothing
+		grid.AddPoint({ Eye.x, Eye.y, Eye.z - 10.0f }, 5.0f);
+		grid.AddPoint({ Eye.x, Eye.y, Eye.z + FarZ + 10.0f }, 5.0f);
+		CHECK(grid.Assign() == 0u);
+
+		//~ a spot right in front of the camera pointing away from it covers only its own cone
+		grid.Clear();
+		grid.AddSpot({ Eye.x, Eye.y, Eye.z + 5.0f }, { 0.0f, 0.0f, 1.0f }, 20.0f, 64.0f);
+		const std::uint32_t spot = grid.Assign();
+		grid.Clear();
+		grid.AddPoint({ Eye.x, Eye.y, Eye.z + 5.0f }, 20.0f);
+		CHECK(spot > 0u && spot < grid.Assign());
+	}
+
+	void BenchmarkAssign(JobSystem& jobs)
+	{
+		constexpr std::uint32_t count = 4096u;
+
+		LightClusterGrid grid;
+		grid.SetJobSystem(&jobs);
+		SetCamera(grid);
+		Fill(grid, MakeLights(count, 42u));
+
+		std::uint32_t indices = 0u;
+		const float micro = tests::TimeMicro([&] { indices = grid.Assign(); });
+		std::printf("light clusters: %u lights, %u indices in %.1f us\n", count, indices, micro);
+	}
+} // namespace
+
+int main()
+{
+	JobSystem jobs;
+	jobs.Initialize(3u);
+
+	TestNoLitSampleMissing(jobs);
+	TestSerialMatchesParallel(jobs);
+	TestEmptyAndOutside();
+	BenchmarkAssign(jobs);
+
+	jobs.Shutdown();
+	return tests::Finish("light cluster grid");
+}
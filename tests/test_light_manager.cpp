@@ -0,0 +1,236 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/light_manager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+
+namespace
+{
+	bool SameLight(const LightCPU& a, const LightCPU& b)
+	{
+		return std::memcmp(&a, &b, sizeof(LightCPU)) == 0;
+	}
+
+	//~ what a pass holds after a fill from scratch: a copy of the manager has never seen this pass
+	PassConstantsCPU FullFill(const LightManager& lights, const XMFLOAT3& eye)
+	{
+		LightManager fresh = lights;
+		PassConstantsCPU pass{};
+		pass.EyePositionW = eye;
+		fresh.FillPassConstants(pass);
+		return pass;
+	}
+
+	bool SameSlots(const PassConstantsCPU& a, const PassConstantsCPU& b)
+	{
+		if (a.NumDirLights != b.NumDirLights || a.NumPointLights != b.NumPointLights || a.NumSpotLights != b.NumSpotLights)
+			return false;
+
+		for (std::uint32_t slot = 0; slot < PassConstantsCPU::MaxLights; ++slot)
+			if (!SameLight(a.Lights[slot], b.Lights[slot])) return false;
+		return true;
+	}
+
+	//~ quarter steps survive the json text round trip exactly
+	float Quarter(std::mt19937& rng, const int lo, const int hi)
+	{
+		return static_cast<float>(std::uniform_int_distribution<int>(lo * 4, hi * 4)(rng)) * 0.25f;
+	}
+
+	LightCPU RandomLight(std::mt19937& rng)
+	{
+		LightCPU light{};
+		light.Strength	   = { Quarter(rng, 0, 4), Quarter(rng, 0, 4), Quarter(rng, 0, 4) };
+		light.Direction	   = { Quarter(rng, -1, 1), -1.0f, Quarter(rng, -1, 1) };
+		light.Position	   = { Quarter(rng, -50, 50), Quarter(rng, 0, 10), Quarter(rng, -50, 50) };
+		light.FalloffStart = Quarter(rng, 0, 2);
+		light.FalloffEnd   = light.FalloffStart + Quarter(rng, 1, 20);
+		light.SpotPower	   = Quarter(rng, 1, 64);
+		return light;
+	}
+
+	std::uint32_t Add(LightManager& lights, std::mt19937& rng)
+	{
+		const LightCPU l = RandomLight(rng);
+		switch (rng() % 6u)
+		{
+			case 0:  return lights.AddDirectional(l.Direction, l.Strength);
+			case 1:
+			case 2:
+			case 3:  return lights.AddPoint(l.Position, l.Strength, l.FalloffStart, l.FalloffEnd);
+			default: return lights.AddSpot(l.Position, l.Direction, l.Strength, l.FalloffStart, l.FalloffEnd, l.SpotPower);
+		}
+	}
+
+	void TestIncrementalMatchesFullFill()
+	{
+		std::mt19937 rng{ 2024u };
+		LightManager lights;
+		PassConstantsCPU pass{};
+		XMFLOAT3 eye{ 0.0f, 2.0f, 0.0f };
+
+		std::uint32_t mismatches = 0u, crowded = 0u;
+		for (std::uint32_t step = 0; step < 20'000u; ++step)
+		{
+			//~ the count wanders around the slot cap so both the plain and the ranked path run
+			const std::uint32_t count = lights.TotalLightCount();
+			const std::uint32_t roll  = rng() % 100u;
+
+			if (roll < 25u && count < 40u) Add(lights, rng);
+			else if (roll < 40u && count)  lights.Remove(rng() % count);
+			else if (roll < 65u && count)
+			{
+				const std::uint32_t index = rng() % count;
+				LightCPU light = lights.Get(index);
+				light.Position.x += Quarter(rng, -2, 2);
+				light.Strength.y  = Quarter(rng, 0, 4);
+				lights.Set(index, light);
+			}
+			else if (roll < 80u)		 eye = { Quarter(rng, -50, 50), 2.0f, Quarter(rng, -50, 50) };
+			else if (roll < 81u)		 lights.Clear();
+			//~ the rest changes nothing and the fill has to keep the pass as it is
+
+			pass.EyePositionW = eye;
+			lights.FillPassConstants(pass);
+
+			mismatches += SameSlots(pass, FullFill(lights, eye)) ? 0u : 1u;
+			crowded	   += lights.TotalLightCount() > LightManager::MaxLights ? 1u : 0u;
+		}
+
+		CHECK(mismatches == 0u);
+		CHECK(crowded > 1000u && crowded < 19'000u);
+	}
+
+	void TestRankingAndOrder()
+	{
+		LightManager lights;
+		const XMFLOAT3 strength{ 1.0f, 1.0f, 1.0f };
+
+		//~ 2 directionals, 20 points along x, 4 spots next to the eye
+		lights.AddDirectional({ 0.0f, -1.0f, 0.0f }, strength);
+		for (int i = 0; i < 20; ++i)
+			lights.AddPoint({ static_cast<float>(i) * 10.0f, 0.0f, 0.0f }, strength, 1.0f, 5.0f);
+		lights.AddDirectional({ 1.0f, -1.0f, 0.0f }, { 0.5f, 0.5f, 0.5f });
+		for (int i = 0; i < 4; ++i)
+			lights.AddSpot({ 0.0f, 1.0f, static_cast<float>(i) }, { 0.0f, -1.0f, 0.0f }, strength, 1.0f, 5.0f, 8.0f);
+
+		PassConstantsCPU pass{};
+		lights.FillPassConstants(pass);
+
+		//~ directionals always in, then the ten points closest to the eye at the origin
+		CHECK(pass.NumDirLights == 2u && pass.NumSpotLights == 4u && pass.NumPointLights == 10u);
+		CHECK(pass.Lights[0].Direction.x == 0.0f && pass.Lights[1].Direction.x == 1.0f);
+		for (std::uint32_t p = 0; p < 10u; ++p)
+			CHECK(pass.Lights[2u + p].Position.x == static_cast<float>(p) * 10.0f);
+		for (std::uint32_t s = 0; s < 4u; ++s)
+			CHECK(pass.Lights[12u + s].SpotPower == 8.0f && pass.Lights[12u + s].Position.z == static_cast<float>(s));
+
+		//~ at the far end the spots fall out and the fourteen points nearest the eye take their slots
+		pass.EyePositionW = { 190.0f, 0.0f, 0.0f };
+		lights.FillPassConstants(pass);
+		CHECK(pass.NumPointLights == 14u && pass.NumSpotLights == 0u && pass.Lights[2].Position.x == 60.0f);
+
+		//~ removing moves the last light into the hole, GatherLocal lists points then spots
+		lights.Remove(0u);
+		CHECK(lights.TotalLightCount() == 25u && lights.GetType(0u) == ELightType::Spotlight);
+
+		std::vector<LightCPU> local;
+		CHECK(lights.GatherLocal(local) == 20u);
+		CHECK(local.size() == 24u && local.back().SpotPower == 8.0f);
+	}
+
+	void TestVersions()
+	{
+		LightManager lights;
+		const std::uint64_t empty = lights.GetVersion();
+
+		const std::uint32_t index = lights.AddPoint({ 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, 1.0f, 5.0f);
+		CHECK(lights.GetVersion() > empty);
+
+		PassConstantsCPU pass{};
+		lights.FillPassConstants(pass);
+		CHECK(pass.NumPointLights == 1u && pass.NumDirLights == 0u);
+
+		//~ Set bumps the version and the next fill picks the change up
+		const std::uint64_t before = lights.GetVersion();
+		LightCPU light = lights.Get(index);
+		light.FalloffEnd = 9.0f;
+		lights.Set(index, light);
+		CHECK(lights.GetVersion() > before);
+
+		lights.FillPassConstants(pass);
+		CHECK(pass.Lights[0].FalloffEnd == 9.0f);
+
+		//~ emptied slots are cleared
+		lights.Clear();
+		lights.FillPassConstants(pass);
+		CHECK(pass.NumPointLights == 0u && SameLight(pass.Lights[0], LightCPU{}));
+	}
+
+	void TestJsonRoundTrip()
+	{
+		std::mt19937 rng{ 7u };
+		LightManager lights;
+		for (int i = 0; i < 30; ++i) Add(lights, rng);
+
+		LightManager loaded;
+		loaded.LoadJsonData(lights.GetJsonData());
+		CHECK(loaded.TotalLightCount() == lights.TotalLightCount());
+
+		//~ lights come back grouped by type, which the pass order already is
+		const XMFLOAT3 eye{ 3.0f, 2.0f, -4.0f };
+		CHECK(SameSlots(FullFill(lights, eye), FullFill(loaded, eye)));
+
+		std::vector<LightCPU> before, after;
+		CHECK(lights.GatherLocal(before) == loaded.GatherLocal(after));
+		CHECK(std::ranges::equal(before, after, SameLight));
+	}
+} // namespace
+
+int main()
+{
+	TestIncrementalMatchesFullFill();
+	TestRankingAndOrder();
+	TestVersions();
+	TestJsonRoundTrip();
+	return tests::Finish("light manager");
+}
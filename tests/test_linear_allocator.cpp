@@ -0,0 +1,242 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/linear_allocator.h"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	void TestAlignmentAndFrameBytes()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(4096u);
+
+		CHECK(core.Allocate(10u, 256u) == 0u);
+		CHECK(core.Allocate(10u, 256u) == 256u);
+		CHECK(core.Allocate(1u, 1u) == 266u);
+		CHECK(core.Allocate(4u, 16u) == 272u);
+
+		//~ alignment padding counts against the frame, 0 is treated as 1
+		CHECK(core.GetFrameBytes() == 276u);
+		CHECK(core.GetUsed() == 276u);
+		CHECK(core.Allocate(3u, 0u) == 276u);
+
+		CHECK(core.Allocate(0u, 1u) == LinearAllocatorCore::InvalidOffset);
+		CHECK(core.GetUsed() == 279u);
+	}
+
+	void TestFullRingFailsWithoutSideEffects()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(1024u);
+
+		CHECK(core.Allocate(2048u, 1u) == LinearAllocatorCore::InvalidOffset);
+		CHECK(core.Allocate(1000u, 1u) == 0u);
+		core.FinishFrame(1u);
+
+		//~ the frame in flight holds the ring, a failed request leaves the bookkeeping alone
+		CHECK(core.Allocate(100u, 1u) == LinearAllocatorCore::InvalidOffset);
+		CHECK(core.GetUsed() == 1000u);
+		CHECK(core.GetFrameBytes() == 0u);
+		CHECK(core.GetFramesInFlight() == 1u);
+
+		core.Reclaim(1u);
+		CHECK(core.Allocate(1024u, 1u) == 0u);
+	}
+
+	void TestReclaimByFence()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(4096u);
+
+		for (std::uint64_t fence = 1u; fence <= 3u; ++fence)
+		{
+			CHECK(core.Allocate(256u, 256u) != LinearAllocatorCore::InvalidOffset);
+			core.FinishFrame(fence);
+		}
+		CHECK(core.GetFramesInFlight() == 3u);
+		CHECK(core.GetUsed() == 768u);
+
+		//~ a fence that has not moved frees nothing, frames come back oldest first
+		core.Reclaim(0u);
+		CHECK(core.GetUsed() == 768u);
+		core.Reclaim(2u);
+		CHECK(core.GetFramesInFlight() == 1u);
+		CHECK(core.GetUsed() == 256u);
+		core.Reclaim(3u);
+		CHECK(core.GetFramesInFlight() == 0u);
+		CHECK(core.GetUsed() == 0u);
+
+		//~ the peak remembers the worst frame after everything came back
+		CHECK(core.GetPeak() == 768u);
+	}
+
+	void TestEmptyFrameRetiresNothing()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(1024u);
+
+		core.FinishFrame(1u);
+		CHECK(core.GetFramesInFlight() == 0u);
+
+		CHECK(core.Allocate(64u, 1u) == 0u);
+		core.FinishFrame(2u);
+		core.FinishFrame(3u);
+		CHECK(core.GetFramesInFlight() == 1u);
+
+		core.Reclaim(2u);
+		CHECK(core.GetUsed() == 0u);
+	}
+
+	void TestDrainedResetIsNotAWrap()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(1024u);
+
+		//~ every frame completes before the next one starts, the head goes back to the front each time
+		for (std::uint64_t fence = 1u; fence <= 8u; ++fence)
+		{
+			CHECK(core.Allocate(300u, 1u) == 0u);
+			CHECK(core.Allocate(300u, 1u) == 300u);
+			core.FinishFrame(fence);
+			core.Reclaim(fence);
+			CHECK(core.GetUsed() == 0u);
+		}
+		CHECK(core.GetWraps() == 0u);
+	}
+
+	void TestRealWrapCounts()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(1024u);
+
+		CHECK(core.Allocate(400u, 1u) == 0u);
+		core.FinishFrame(1u);
+		CHECK(core.Allocate(400u, 1u) == 400u);
+		core.FinishFrame(2u);
+		core.Reclaim(1u);
+
+		//~ does not fit behind the head, frame 2 is still alive, so it goes around to the front
+		CHECK(core.Allocate(300u, 1u) == 0u);
+		CHECK(core.GetWraps() == 1u);
+		CHECK(core.GetUsed() == 400u + 224u + 300u);
+
+		//~ no room in front of the tail either
+		CHECK(core.Allocate(200u, 1u) == LinearAllocatorCore::InvalidOffset);
+		CHECK(core.GetWraps() == 1u);
+	}
+
+	void TestFlushEndCounts()
+	{
+		LinearAllocatorCore core;
+		core.Initialize(1024u);
+
+		CHECK(core.Allocate(512u, 1u) == 0u);
+		core.FinishFrame(1u);
+		CHECK(core.Allocate(512u, 1u) == 512u);
+		CHECK(core.GetWraps() == 1u);
+
+		core.FinishFrame(2u);
+		core.Reclaim(1u);
+		CHECK(core.Allocate(256u, 1u) == 0u);
+		CHECK(core.GetWraps() == 1u);
+	}
+
+	void TestLiveRangesNeverOverlap()
+	{
+		struct Range { std::uint64_t Begin, End, Fence; };
+
+		LinearAllocatorCore core;
+		core.Initialize(4096u);
+
+		std::mt19937 rng{ 5u };
+		std::uniform_int_distribution<std::uint64_t> size(1u, 700u);
+		std::uniform_int_distribution<int> count(1, 6);
+
+		std::deque<Range> live;
+		std::uint64_t overlaps = 0u, misaligned = 0u, failed = 0u;
+
+		for (std::uint64_t fence = 1u; fence <= 5000u; ++fence)
+		{
+			const int allocations = count(rng);
+			for (int i = 0; i < allocations; ++i)
+			{
+				const std::uint64_t bytes  = size(rng);
+				const std::uint64_t offset = core.Allocate(bytes, 64u);
+				if (offset == LinearAllocatorCore::InvalidOffset) { ++failed; continue; }
+
+				misaligned += offset % 64u == 0u && offset + bytes <= 4096u ? 0u : 1u;
+				for (const Range& range : live)
+				{
+					overlaps += offset < range.End && range.Begin < offset + bytes ? 1u : 0u;
+				}
+				live.push_back({ offset, offset + bytes, fence });
+			}
+			core.FinishFrame(fence);
+
+			//~ fake fence two frames behind
+			if (fence > 2u)
+			{
+				core.Reclaim(fence - 2u);
+				while (!live.empty() && live.front().Fence <= fence - 2u) live.pop_front();
+			}
+		}
+
+		CHECK(overlaps == 0u);
+		CHECK(misaligned == 0u);
+		CHECK(failed > 0u);
+		CHECK(core.GetWraps() > 100u);
+		CHECK(core.GetPeak() <= core.GetCapacity());
+	}
+} // namespace
+
+int main()
+{
+	TestAlignmentAndFrameBytes();
+	TestFullRingFailsWithoutSideEffects();
+	TestReclaimByFence();
+	TestEmptyFrameRetiresNothing();
+	TestDrainedResetIsNotAWrap();
+	TestRealWrapCounts();
+	TestFlushEndCounts();
+	TestLiveRangesNeverOverlap();
+	return tests::Finish("linear allocator");
+}
@@ -0,0 +1,284 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/light_cluster_grid.h"
+#include "framework/render_manager/components/light_manager.h"
+#include "framework/render_manager/components/object_light_lists.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace framework;
+using namespace DirectX;
+
+namespace
+{
+	struct Scene
+	{
+		std::vector<LightCPU> Lights; // points first, then spots
+		std::uint32_t		  Points{ 0u };
+		std::vector<XMFLOAT3> Centers;
+		std::vector<XMFLOAT3> Extents;
+	};
+
+	Scene MakeScene(const std::uint32_t lights, const std::uint32_t boxes, const std::uint32_t seed)
+	{
+		std::mt19937 rng{ seed };
+		std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> strength(0.1f, 3.0f);
+		std::uniform_real_distribution<float> range(2.0f, 12.0f);
+		std::uniform_real_distribution<float> power(2.0f, 64.0f);
+		std::uniform_real_distribution<float> size(0.2f, 4.0f);
+
+		Scene scene;
+		scene.Points = lights * 2u / 3u;
+
+		for (std::uint32_t i = 0; i < lights; ++i)
+		{
+			LightCPU light{};
+			light.Position	   = { position(rng), position(rng) * 0.1f, position(rng) };
+			light.Strength	   = { strength(rng), strength(rng), strength(rng) };
+			light.FalloffEnd   = range(rng);
+			light.FalloffStart = light.FalloffEnd * 0.25f;
+
+			if (i >= scene.Points)
+			{
+				const XMFLOAT3 d{ unit(rng), unit(rng) - 0.5f, unit(rng) };
+				const float length = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z) + 1e-6f;
+				light.Direction = { d.x / length, d.y / length, d.z / length };
+				light.SpotPower = power(rng);
+			}
+			scene.Lights.push_back(light);
+		}
+
+		for (std::uint32_t i = 0; i < boxes; ++i)
+		{
+			scene.Centers.push_back({ position(rng), position(rng) * 0.1f, position(rng) });
+			scene.Extents.push_back({ size(rng), size(rng), size(rng) });
+		}
+		return scene;
+	}
+
+	void Fill(ObjectLightLists& lists, const Scene& scene)
+	{
+		lists.SetLights(scene.Lights, scene.Points);
+		lists.ClearObjects();
+		for (size_t i = 0; i < scene.Centers.size(); ++i) lists.AddObject(scene.Centers[i], scene.Extents[i]);
+		lists.Build();
+	}
+
+	float BoxDistance(const LightCPU& light, const XMFLOAT3& c, const XMFLOAT3& e)
+	{
+		const float dx = std::max(std::fabs(light.Position.x - c.x) - e.x, 0.0f);
+		const float dy = std::max(std::fabs(light.Position.y - c.y) - e.y, 0.0f);
+		const float dz = std::max(std::fabs(light.Position.z - c.z) - e.z, 0.0f);
+		return std::sqrt(dx * dx + dy * dy + dz * dz);
+	}
+
+	//~ the shader's range and spot test, with slack so float noise at the exact edge is not lit
+	bool IsLit(const LightCPU& light, const bool bSpot, const XMFLOAT3& p)
+	{
+		const float dx = p.x - light.Position.x, dy = p.y - light.Position.y, dz = p.z - light.Position.z;
+		const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (distance >= light.FalloffEnd * 0.999f) return false;
+		if (!bSpot) return true;
+		if (distance <= 1e-4f) return false;
+
+		const float cosine = (dx * light.Direction.x + dy * light.Direction.y + dz * light.Direction.z) / distance;
+		return std::pow(std::max(cosine, 0.0f), light.SpotPower) > LightClusterGrid::SpotCutoff * 1.01f;
+	}
+
+	//~ score of a point light the way the lists rank them: luminance times the linear falloff to the box
+	float PointScore(const LightCPU& light, const XMFLOAT3& c, const XMFLOAT3& e)
+	{
+		const float luminance = 0.2126f * light.Strength.x + 0.7152f * light.Strength.y + 0.0722f * light.Strength.z;
+		const float distance  = BoxDistance(light, c, e);
+		const float falloff   = std::clamp((light.FalloffEnd - distance) / (light.FalloffEnd - light.FalloffStart), 0.0f, 1.0f);
+		return luminance * std::max(falloff, 1e-6f);
+	}
+
+	void TestAgainstBruteForce(JobSystem& jobs)
+	{
+		const Scene scene = MakeScene(1200u, 2000u, 3u);
+
+		ObjectLightLists lists;
+		lists.SetJobSystem(&jobs);
+		Fill(lists, scene);
+		CHECK(lists.GetObjectCount() == 2000u && lists.GetLightCount() == 1200u);
+
+		std::mt19937 rng{ 8u };
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		std::uint32_t notTouching = 0u, missed = 0u, unsorted = 0u, outranked = 0u, duplicates = 0u;
+		std::uint32_t full = 0u, partial = 0u, picked = 0u, rankedByPoint = 0u;
+
+		for (std::uint32_t object = 0; object < lists.GetObjectCount(); ++object)
+		{
+			const auto& list = lists.Get(object);
+			const XMFLOAT3& c = scene.Centers[object];
+			const XMFLOAT3& e = scene.Extents[object];
+			const auto begin  = std::begin(list.Indices);
+			const auto end	  = begin + list.Count;
+
+			picked += list.Count;
+			CHECK(list.Count <= ObjectLightList::MaxLights);
+
+			//~ every picked light reaches the box, once
+			for (auto it = begin; it != end; ++it)
+			{
+				notTouching += BoxDistance(scene.Lights[*it], c, e) <= scene.Lights[*it].FalloffEnd * 1.0001f ? 0u : 1u;
+				duplicates	+= std::count(begin, end, *it) == 1 ? 0u : 1u;
+			}
+
+			if (list.Count < ObjectLightList::MaxLights)
+			{
+				//~ not full: nothing that lights any point of the box was left out
+				++partial;
+				for (int sample = 0; sample < 24; ++sample)
+				{
+					const XMFLOAT3 p{ c.x + unit(rng) * e.x, c.y + unit(rng) * e.y, c.z + unit(rng) * e.z };
+					for (std::uint32_t light = 0; light < scene.Lights.size(); ++light)
+					{
+						if (!IsLit(scene.Lights[light], light >= scene.Points, p)) continue;
+						missed += std::find(begin, end, light) == end ? 1u : 0u;
+					}
+				}
+				continue;
+			}
+
+			//~ full: picked points come brightest first and no point light left out beats the last pick
+			++full;
+			float previous = INFINITY;
+			for (auto it = begin; it != end; ++it)
+			{
+				if (*it >= scene.Points) continue; // a spot's score also has the cone in it
+				const float score = PointScore(scene.Lights[*it], c, e);
+				unsorted += score <= previous * 1.0001f ? 0u : 1u;
+				previous = score;
+			}
+
+			const std::uint32_t last = list.Indices[list.Count - 1u];
+			if (last >= scene.Points) continue;
+
+			++rankedByPoint;
+			const float weakest = PointScore(scene.Lights[last], c, e);
+			for (std::uint32_t light = 0; light < scene.Points; ++light)
+			{
+				if (std::find(begin, end, light) != end) continue;
+				if (BoxDistance(scene.Lights[light], c, e) > scene.Lights[light].FalloffEnd) continue;
+				outranked += PointScore(scene.Lights[light], c, e) > weakest * 1.0001f ? 1u : 0u;
+			}
+		}
+
+		CHECK(notTouching == 0u);
+		CHECK(duplicates == 0u);
+		CHECK(missed == 0u);
+		CHECK(unsorted == 0u);
+		CHECK(outranked == 0u);
+
+		//~ the scene has to exercise both kinds of list
+		CHECK(full > 20u && partial > 20u && rankedByPoint > 10u);
+		CHECK(picked > 2000u);
+	}
+
+	void TestSerialMatchesParallel(JobSystem& jobs)
+	{
+		const Scene scene = MakeScene(1200u, 2000u, 21u);
+
+		ObjectLightLists serial, parallel;
+		parallel.SetJobSystem(&jobs);
+		Fill(serial, scene);
+		Fill(parallel, scene);
+
+		bool bSame = serial.GetObjectCount() == parallel.GetObjectCount();
+		for (std::uint32_t i = 0; bSame && i < serial.GetObjectCount(); ++i)
+		{
+			const auto& a = serial.Get(i);
+			const auto& b = parallel.Get(i);
+			bSame = a.Count == b.Count && std::equal(a.Indices, a.Indices + a.Count, b.Indices);
+		}
+		CHECK(bSame);
+	}
+
+	void TestEmpty()
+	{
+		ObjectLightLists lists;
+		lists.SetLights({}, 0u);
+		lists.AddObject({ 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+		CHECK(lists.Build() == 0u && lists.Get(0u).Count == 0u);
+
+		//~ a light right on the box, then the objects cleared
+		const LightCPU light{ { 1.0f, 1.0f, 1.0f }, 1.0f, { 0.0f, 0.0f, 0.0f }, 5.0f, { 0.0f, 0.0f, 0.0f }, 0.0f };
+		lists.SetLights({ &light, 1u }, 1u);
+		CHECK(lists.Build() == 1u && lists.Get(0u).Indices[0] == 0u);
+
+		lists.ClearObjects();
+		CHECK(lists.Build() == 0u && lists.GetObjectCount() == 0u);
+	}
+
+	void BenchmarkBuild(JobSystem& jobs)
+	{
+		const Scene scene = MakeScene(1200u, 2000u, 42u);
+
+		ObjectLightLists lists;
+		lists.SetJobSystem(&jobs);
+		lists.SetLights(scene.Lights, scene.Points);
+		for (size_t i = 0; i < scene.Centers.size(); ++i) lists.AddObject(scene.Centers[i], scene.Extents[i]);
+
+		std::uint32_t picked = 0u;
+		const float micro = tests::TimeMicro([&] { picked = lists.Build(); });
+		std::printf("object light lists: %u objects, %u lights, %u picked in %.1f us\n",
+			lists.GetObjectCount(), lists.GetLightCount(), picked, micro);
+	}
+} // namespace
+
+int main()
+{
+	JobSystem jobs;
+	jobs.Initialize(3u);
+
+	TestAgainstBruteForce(jobs);
+	TestSerialMatchesParallel(jobs);
+	TestEmpty();
+	BenchmarkBuild(jobs);
+
+	jobs.Shutdown();
+	return tests::Finish("object light lists");
+}
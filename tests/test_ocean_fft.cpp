@@ -0,0 +1,249 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/ocean_fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	using Complex  = OceanFFT::Complex;
+	using ComplexD = std::complex<double>;
+
+	constexpr double kPi = 3.14159265358979323846;
+
+	//~ same tables Initialize builds
+	void BuildTables(const std::uint32_t n, std::vector<std::uint32_t>& bitReverse, std::vector<Complex>& twiddles)
+	{
+		std::uint32_t log2N = 0u;
+		while ((1u << log2N) < n) ++log2N;
+
+		bitReverse.resize(n);
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			std::uint32_t r = 0u;
+			for (std::uint32_t b = 0; b < log2N; ++b)
+				r |= ((i >> b) & 1u) << (log2N - 1u - b);
+			bitReverse[i] = r;
+		}
+
+		twiddles.resize(n / 2u);
+		for (std::uint32_t i = 0; i < n / 2u; ++i)
+		{
+			const double a = 2.0 * kPi * i / n;
+			twiddles[i] = Complex(static_cast<float>(std::cos(a)), static_cast<float>(std::sin(a)));
+		}
+	}
+
+	//~ out[x] = sum_k in[k] e^{+2pi i k x / n}, unnormalised like InverseFFT
+	std::vector<ComplexD> NaiveInverse(const std::vector<ComplexD>& in)
+	{
+		const size_t n = in.size();
+		std::vector<ComplexD> out(n);
+		for (size_t x = 0; x < n; ++x)
+		{
+			ComplexD sum(0.0, 0.0);
+			for (size_t k = 0; k < n; ++k)
+				sum += in[k] * std::polar(1.0, 2.0 * kPi * static_cast<double>((k * x) % n) / n);
+			out[x] = sum;
+		}
+		return out;
+	}
+
+	//~ one row and one strided column of a random n x n grid against the O(N^2) sum
+	void TestInverseMatchesDft(const std::uint32_t n)
+	{
+		std::vector<std::uint32_t> bitReverse;
+		std::vector<Complex> twiddles;
+		BuildTables(n, bitReverse, twiddles);
+
+		std::mt19937 rng(n);
+		std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+		std::vector<Complex> grid(static_cast<size_t>(n) * n);
+		for (Complex& c : grid) c = Complex(value(rng), value(rng));
+
+		const std::uint32_t line = n / 3u;
+		std::vector<ComplexD> row(n), column(n);
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			row[i]	  = ComplexD(grid[static_cast<size_t>(line) * n + i]);
+			column[i] = ComplexD(grid[static_cast<size_t>(i) * n + line]);
+		}
+		const std::vector<ComplexD> rowRef	  = NaiveInverse(row);
+		const std::vector<ComplexD> columnRef = NaiveInverse(column);
+
+		//~ the row and the column cross, so each transforms its own copy
+		std::vector<Complex> rows = grid;
+		std::vector<Complex> cols = grid;
+		std::vector<Complex> scratch(n);
+		OceanFFT::InverseFFT(rows.data() + static_cast<size_t>(line) * n, n, 1u, bitReverse, twiddles, scratch);
+		OceanFFT::InverseFFT(cols.data() + line, n, n, bitReverse, twiddles, scratch);
+
+		//~ float butterflies against a double sum of n unit terms
+		const double tolerance = 1e-5 * n;
+		double rowError = 0.0, columnError = 0.0;
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			rowError	= std::max(rowError, std::abs(ComplexD(rows[static_cast<size_t>(line) * n + i]) - rowRef[i]));
+			columnError = std::max(columnError, std::abs(ComplexD(cols[static_cast<size_t>(i) * n + line]) - columnRef[i]));
+		}
+		CHECK(rowError < tolerance);
+		CHECK(columnError < tolerance);
+	}
+
+	OceanFFTConfig MakeConfig(const std::uint32_t size)
+	{
+		OceanFFTConfig config{};
+		config.Size		   = size;
+		config.PatchLength = 40.0f;
+		config.WindSpeed   = 12.0f;
+		config.Seed		   = 7u;
+		return config;
+	}
+
+	//~ heights and displacements after Update(t) against the direct sum over the centred spectrum
+	void TestHeightsMatchDft(const std::uint32_t n)
+	{
+		OceanFFT ocean;
+		ocean.Initialize(MakeConfig(n));
+
+		const float time = 1.7f;
+		ocean.Update(time);
+
+		const int half = static_cast<int>(n / 2u);
+		const size_t cells = static_cast<size_t>(n) * n;
+
+		std::vector<ComplexD> h(cells), dx(cells), dz(cells);
+		for (std::uint32_t m = 0; m < n; ++m)
+		{
+			for (std::uint32_t i = 0; i < n; ++i)
+			{
+				const size_t idx = static_cast<size_t>(m) * n + i;
+				const double kx	 = static_cast<int>(i) - half;
+				const double kz	 = static_cast<int>(m) - half;
+				const double k	 = std::sqrt(kx * kx + kz * kz);
+
+				h[idx] = ComplexD(ocean.GetSpectrum(idx, time));
+				//~ D(k) = -i k/|k| h(k)
+				dx[idx] = k > 0.0 ? ComplexD(0.0, -kx / k) * h[idx] : ComplexD(0.0, 0.0);
+				dz[idx] = k > 0.0 ? ComplexD(0.0, -kz / k) * h[idx] : ComplexD(0.0, 0.0);
+			}
+		}
+
+		//~ twiddle table indexed by (k * x) mod n keeps the reference exact in double
+		std::vector<ComplexD> basis(n);
+		for (std::uint32_t j = 0; j < n; ++j) basis[j] = std::polar(1.0, 2.0 * kPi * j / n);
+
+		const std::vector<float>& heights = ocean.GetHeights();
+		const std::vector<float>& dispX	  = ocean.GetDisplacementX();
+		const std::vector<float>& dispZ	  = ocean.GetDisplacementZ();
+
+		double peak = 0.0, heightError = 0.0, dispError = 0.0;
+		for (std::uint32_t z = 0; z < n; ++z)
+		{
+			for (std::uint32_t x = 0; x < n; ++x)
+			{
+				ComplexD sumH(0.0, 0.0), sumX(0.0, 0.0), sumZ(0.0, 0.0);
+				for (std::uint32_t m = 0; m < n; ++m)
+				{
+					for (std::uint32_t i = 0; i < n; ++i)
+					{
+						const int phase = ((static_cast<int>(i) - half) * static_cast<int>(x) + (static_cast<int>(m) - half) * static_cast<int>(z)) % static_cast<int>(n);
+						const ComplexD e = basis[static_cast<size_t>(phase < 0 ? phase + static_cast<int>(n) : phase)];
+						const size_t idx = static_cast<size_t>(m) * n + i;
+						sumH += h [idx] * e;
+						sumX += dx[idx] * e;
+						sumZ += dz[idx] * e;
+					}
+				}
+
+				const size_t idx = static_cast<size_t>(z) * n + x;
+				peak		= std::max(peak, std::abs(sumH.real()));
+				heightError = std::max(heightError, std::abs(heights[idx] - sumH.real()));
+				dispError	= std::max({ dispError, std::abs(dispX[idx] - sumX.real()), std::abs(dispZ[idx] - sumZ.real()) });
+			}
+		}
+
+		CHECK(peak > 0.0);
+		CHECK(heightError < 1e-3 * peak);
+		CHECK(dispError < 1e-3 * peak);
+	}
+
+	//~ the job split only changes which thread runs a line, the math per line is the same
+	void TestParallelMatchesSerial(JobSystem& jobs, const std::uint32_t n)
+	{
+		OceanFFT serial;
+		serial.Initialize(MakeConfig(n));
+
+		OceanFFT parallel;
+		parallel.SetJobSystem(&jobs);
+		parallel.Initialize(MakeConfig(n));
+
+		for (const float time : { 0.0f, 0.5f, 3.25f })
+		{
+			serial.Update(time);
+			parallel.Update(time);
+
+			CHECK(serial.GetHeights()		== parallel.GetHeights());
+			CHECK(serial.GetDisplacementX() == parallel.GetDisplacementX());
+			CHECK(serial.GetDisplacementZ() == parallel.GetDisplacementZ());
+		}
+	}
+} // namespace
+
+int main()
+{
+	JobSystem jobs;
+	jobs.Initialize(3u);
+
+	for (const std::uint32_t n : { 16u, 64u })
+	{
+		TestInverseMatchesDft(n);
+		TestHeightsMatchDft(n);
+		TestParallelMatchesSerial(jobs, n);
+	}
+
+	jobs.Shutdown();
+	return tests::Finish("ocean fft");
+}
@@ -0,0 +1,214 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/render_manager/components/slot_map.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace framework;
+
+namespace
+{
+	//~ the way RenderItemRegistry uses the core: one dense payload array mirroring every move
+	struct Owner
+	{
+		SlotMapCore				   Slots;
+		std::vector<std::uint32_t> Values;
+
+		SlotHandle Add(const std::uint32_t value)
+		{
+			const SlotHandle handle = Slots.Add();
+			Values.push_back(value);
+			return handle;
+		}
+
+		bool Remove(const SlotHandle handle)
+		{
+			std::uint32_t removed, moved;
+			if (!Slots.Remove(handle, removed, moved)) return false;
+
+			Values[removed] = Values[moved];
+			Values.pop_back();
+			return true;
+		}
+
+		const std::uint32_t* Get(const SlotHandle handle) const
+		{
+			const std::uint32_t dense = Slots.GetDense(handle);
+			return dense != SlotHandle::InvalidIndex ? &Values[dense] : nullptr;
+		}
+	};
+
+	//~ dense -> handle -> dense goes around, and the payload count follows the core
+	bool Consistent(const Owner& owner)
+	{
+		if (owner.Values.size() != owner.Slots.GetCount()) return false;
+
+		for (std::uint32_t dense = 0; dense < owner.Slots.GetCount(); ++dense)
+		{
+			const SlotHandle handle = owner.Slots.GetHandle(dense);
+			if (!owner.Slots.IsAlive(handle) || owner.Slots.GetDense(handle) != dense) return false;
+		}
+		return true;
+	}
+
+	void TestAddRemoveReAdd()
+	{
+		Owner owner;
+		const SlotHandle a = owner.Add(10u);
+		const SlotHandle b = owner.Add(20u);
+		const SlotHandle c = owner.Add(30u);
+
+		CHECK(owner.Get(a) && *owner.Get(a) == 10u);
+		CHECK(owner.Get(b) && *owner.Get(b) == 20u);
+		CHECK(owner.Get(c) && *owner.Get(c) == 30u);
+
+		CHECK(owner.Remove(b));
+		CHECK(!owner.Remove(b));
+		CHECK(owner.Slots.GetCount() == 2u);
+		CHECK(owner.Get(b) == nullptr);
+
+		//~ the freed slot comes back, under a new generation
+		const SlotHandle d = owner.Add(40u);
+		CHECK(d.Index == b.Index);
+		CHECK(d.Generation != b.Generation);
+		CHECK(owner.Slots.GetSlotCount() == 3u);
+		CHECK(*owner.Get(d) == 40u);
+
+		//~ a stale handle to a reused slot resolves to nothing, not to the newcomer
+		CHECK(!owner.Slots.IsAlive(b));
+		CHECK(owner.Get(b) == nullptr);
+		CHECK(owner.Slots.GetDense(b) == SlotHandle::InvalidIndex);
+		CHECK(Consistent(owner));
+
+		//~ Clear stales everything, old handles keep failing after the slots come back
+		owner.Slots.Clear();
+		owner.Values.clear();
+		CHECK(owner.Get(a) == nullptr && owner.Get(d) == nullptr);
+		const SlotHandle e = owner.Add(50u);
+		CHECK(owner.Get(a) == nullptr && owner.Get(c) == nullptr && owner.Get(d) == nullptr);
+		CHECK(*owner.Get(e) == 50u);
+		CHECK(Consistent(owner));
+
+		CHECK(!SlotHandle{}.IsValid());
+		CHECK(owner.Get(SlotHandle{}) == nullptr);
+		CHECK(!owner.Slots.GetHandle(owner.Slots.GetCount()).IsValid());
+	}
+
+	void TestSwapRemoveKeepsHandles()
+	{
+		Owner owner;
+		std::vector<SlotHandle> handles;
+		for (std::uint32_t i = 0; i < 6u; ++i) handles.push_back(owner.Add(i));
+
+		//~ removing the first entry moves the last one into dense index 0
+		CHECK(owner.Remove(handles[0]));
+		CHECK(owner.Slots.GetDense(handles[5]) == 0u);
+		CHECK(owner.Values[0] == 5u);
+		CHECK(owner.Slots.GetHandle(0u) == handles[5]);
+
+		//~ the last entry itself leaves nothing to move
+		CHECK(owner.Remove(handles[5]));
+		CHECK(owner.Values.size() == 4u);
+
+		//~ unrelated removes never change what a live handle resolves to
+		for (std::uint32_t i = 1; i < 5u; ++i)
+			CHECK(owner.Get(handles[i]) && *owner.Get(handles[i]) == i);
+
+		//~ iterating the dense array sees every live value once
+		std::vector<std::uint32_t> seen = owner.Values;
+		std::sort(seen.begin(), seen.end());
+		CHECK((seen == std::vector<std::uint32_t>{ 1u, 2u, 3u, 4u }));
+		CHECK(Consistent(owner));
+	}
+
+	//~ random churn against a plain list of what should be alive
+	void TestRandomChurn()
+	{
+		struct Entry { SlotHandle Handle; std::uint32_t Value; };
+
+		Owner owner;
+		std::vector<Entry> alive;
+		std::vector<SlotHandle> dead;
+
+		std::mt19937 rng{ 41u };
+		std::uint32_t next = 0u;
+		bool bConsistent = true, bResolved = true, bStale = true;
+
+		for (int step = 0; step < 20000; ++step)
+		{
+			const bool bAdd = alive.empty() || std::uniform_int_distribution<int>(0, 99)(rng) < 55;
+			if (bAdd)
+			{
+				alive.push_back({ owner.Add(next), next });
+				++next;
+			}
+			else
+			{
+				const size_t pick = std::uniform_int_distribution<size_t>(0u, alive.size() - 1u)(rng);
+				bConsistent &= owner.Remove(alive[pick].Handle);
+				dead.push_back(alive[pick].Handle);
+				alive[pick] = alive.back();
+				alive.pop_back();
+			}
+
+			if (step % 97 != 0) continue;
+
+			bConsistent &= Consistent(owner) && owner.Slots.GetCount() == alive.size();
+			for (const Entry& entry : alive)
+				bResolved &= owner.Get(entry.Handle) && *owner.Get(entry.Handle) == entry.Value;
+			for (const SlotHandle& handle : dead)
+				bStale &= owner.Get(handle) == nullptr;
+		}
+
+		CHECK(bConsistent);
+		CHECK(bResolved);
+		CHECK(bStale);
+
+		//~ slots were recycled rather than grown for every add
+		CHECK(owner.Slots.GetSlotCount() < next);
+	}
+} // namespace
+
+int main()
+{
+	TestAddRemoveReAdd();
+	TestSwapRemoveKeepsHandles();
+	TestRandomChurn();
+	return tests::Finish("slot map");
+}
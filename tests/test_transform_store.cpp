@@ -0,0 +1,471 @@
+//
+// Created by Niffoxic (Aka Harsh Dubey) on 1/16/2026.
+//
+// -----------------------------------------------------------------------------
+// Project   : DirectX12
+// Purpose   : Academic and self-learning computer graphics project.
+// Codebase  : DirectX 12 implementation based on the Luna Graphics Programming
+//             textbook. This repository includes practical scene-style
+//             implementations as well as answers and solutions to the
+//             end-of-chapter questions for learning and reference purposes.
+// License   : MIT License
+// -----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 Niffoxic
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// -----------------------------------------------------------------------------
+#include "test_common.h"
+
+#include "framework/jobs/job_system.h"
+#include "framework/render_manager/components/object_constant_table.h"
+#include "framework/render_manager/components/transform_store.h"
+
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace framework;
+using namespace DirectX;
+
+namespace
+{
+	constexpr std::uint32_t Stride = ObjectConstantTable::SlotSize;
+
+	//~ stands in for one frame's region of the constant table
+	struct FrameRegion
+	{
+		std::vector<std::uint8_t> Bytes;
+
+		explicit FrameRegion(const std::uint32_t slots) : Bytes(static_cast<size_t>(slots) * Stride, 0xCDu) {}
+
+		bool Holds(const TransformStore& store, const std::uint32_t slot) const
+		{
+			return std::memcmp(&Bytes[static_cast<size_t>(slot) * Stride], &store.GetWorldTransposed(slot), sizeof(XMFLOAT4X4)) == 0;
+		}
+
+		bool Untouched(const std::uint32_t slot) const
+		{
+			for (size_t i = 0; i < Stride; ++i)
+				if (Bytes[static_cast<size_t>(slot) * Stride + i] != 0xCDu) return false;
+			return true;
+		}
+
+		void Reset() { std::fill(Bytes.begin(), Bytes.end(), std::uint8_t{ 0xCDu }); }
+	};
+
+	struct Pose
+	{
+		XMFLOAT3 Position, Rotation, Scale;
+	};
+
+	Pose RandomPose(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+		std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+
+		return {
+			{ position(rng), position(rng), position(rng) },
+			{ angle(rng), angle(rng), angle(rng) },
+			{ scale(rng), scale(rng), scale(rng) } };
+	}
+
+	//~ what the scenes built per item before the store, transposed for hlsl
+	XMFLOAT4X4 ReferenceLocal(const Pose& pose)
+	{
+		const XMMATRIX local =
+			XMMatrixScaling(pose.Scale.x, pose.Scale.y, pose.Scale.z) *
+			XMMatrixRotationRollPitchYaw(pose.Rotation.x, pose.Rotation.y, pose.Rotation.z) *
+			XMMatrixTranslation(pose.Position.x, pose.Position.y, pose.Position.z);
+
+		XMFLOAT4X4 out;
+		XMStoreFloat4x4(&out, XMMatrixTranspose(local));
+		return out;
+	}
+
+	float MaxDifference(const XMFLOAT4X4& a, const XMFLOAT4X4& b)
+	{
+		float diff = 0.0f;
+		for (int r = 0; r < 4; ++r)
+			for (int c = 0; c < 4; ++c)
+				diff = std::max(diff, std::fabs(a.m[r][c] - b.m[r][c]));
+		return diff;
+	}
+
+	//~ a count that leaves the last group of four half empty, written at the constant table stride
+	void TestGroupsMatchDirectXMath()
+	{
+		constexpr std::uint32_t objects = 13u;
+
+		TransformStore store;
+		store.Initialize(1u);
+
+		std::mt19937 rng{ 34u };
+		std::vector<Pose> poses;
+		for (std::uint32_t i = 0; i < objects; ++i)
+		{
+			poses.push_back(RandomPose(rng));
+			const std::uint32_t index = store.Add();
+			store.Set(index, poses[i].Position, poses[i].Rotation, poses[i].Scale);
+		}
+
+		//~ one spare group past the end, padding lanes must never be written
+		FrameRegion region(objects + 4u);
+		CHECK(store.Flush(region.Bytes.data(), Stride) == objects);
+		CHECK(store.GetRebuiltCount() == objects);
+
+		for (std::uint32_t i = 0; i < objects; ++i)
+		{
+			XMFLOAT4X4 written;
+			std::memcpy(&written, &region.Bytes[static_cast<size_t>(i) * Stride], sizeof(XMFLOAT4X4));
+
+			//~ positions reach 50, so the bound is relative to that
+			CHECK(MaxDifference(written, ReferenceLocal(poses[i])) < 1e-4f);
+			CHECK(region.Holds(store, i));
+
+			//~ the rest of the slot belongs to whatever follows the matrix
+			bool bTailUntouched = true;
+			for (size_t b = sizeof(XMFLOAT4X4); b < Stride; ++b)
+				bTailUntouched &= region.Bytes[static_cast<size_t>(i) * Stride + b] == 0xCDu;
+			CHECK(bTailUntouched);
+		}
+
+		for (std::uint32_t i = objects; i < objects + 4u; ++i)
+			CHECK(region.Untouched(i));
+
+		//~ editing one lane rebuilds its group but only the edited object counts as changed
+		poses[9] = RandomPose(rng);
+		store.Set(9u, poses[9].Position, poses[9].Rotation, poses[9].Scale);
+		region.Reset();
+		CHECK(store.Flush(region.Bytes.data(), Stride) == 1u);
+		CHECK(region.Holds(store, 9u));
+		CHECK(region.Untouched(8u));
+		CHECK(MaxDifference(store.GetWorldTransposed(9u), ReferenceLocal(poses[9])) < 1e-4f);
+	}
+
+	//~ a chain deep enough to need many levels, the rest hangs off random earlier nodes. indices
+	//~ are shuffled so parents often sit behind their children in memory
+	struct Hierarchy
+	{
+		std::vector<Pose>		   Poses;
+		std::vector<std::uint32_t> Parents;
+	};
+
+	Hierarchy MakeHierarchy(const std::uint32_t count, const std::uint32_t chain, const std::uint32_t seed)
+	{
+		std::mt19937 rng{ seed };
+		std::uniform_real_distribution<float> position(-5.0f, 5.0f);
+		std::uniform_real_distribution<float> angle(-0.5f, 0.5f);
+		std::uniform_real_distribution<float> scale(0.9f, 1.1f);
+
+		Hierarchy tree;
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			tree.Poses.push_back({
+				{ position(rng), position(rng), position(rng) },
+				{ angle(rng), angle(rng), angle(rng) },
+				{ scale(rng), scale(rng), scale(rng) } });
+		}
+
+		std::vector<std::uint32_t> shuffled(count);
+		for (std::uint32_t i = 0; i < count; ++i) shuffled[i] = i;
+		std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+		tree.Parents.assign(count, TransformStore::InvalidIndex);
+		for (std::uint32_t k = 1; k < count; ++k)
+		{
+			const std::uint32_t parent = k < chain ? k - 1u : std::uniform_int_distribution<std::uint32_t>(0u, k - 1u)(rng);
+			tree.Parents[shuffled[k]] = shuffled[parent];
+		}
+		return tree;
+	}
+
+	void Load(TransformStore& store, const Hierarchy& tree)
+	{
+		const auto count = static_cast<std::uint32_t>(tree.Poses.size());
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			store.Add();
+			store.Set(i, tree.Poses[i].Position, tree.Poses[i].Rotation, tree.Poses[i].Scale);
+		}
+		for (std::uint32_t i = 0; i < count; ++i)
+			CHECK(store.SetParent(i, tree.Parents[i]));
+	}
+
+	//~ world = local * parent world, one node at a time by walking up the parents
+	XMFLOAT4X4 ReferenceWorld(const Hierarchy& tree, const std::uint32_t index)
+	{
+		XMFLOAT4X4 localT = ReferenceLocal(tree.Poses[index]);
+		XMMATRIX world = XMMatrixTranspose(XMLoadFloat4x4(&localT));
+
+		for (std::uint32_t p = tree.Parents[index]; p != TransformStore::InvalidIndex; p = tree.Parents[p])
+		{
+			const XMFLOAT4X4 parentT = ReferenceLocal(tree.Poses[p]);
+			world = world * XMMatrixTranspose(XMLoadFloat4x4(&parentT));
+		}
+
+		XMFLOAT4X4 out;
+		XMStoreFloat4x4(&out, XMMatrixTranspose(world));
+		return out;
+	}
+
+	std::uint32_t SubtreeSize(const Hierarchy& tree, const std::uint32_t root)
+	{
+		std::uint32_t size = 0u;
+		for (std::uint32_t i = 0; i < tree.Parents.size(); ++i)
+		{
+			for (std::uint32_t p = i; p != TransformStore::InvalidIndex; p = tree.Parents[p])
+			{
+				if (p == root) { ++size; break; }
+			}
+		}
+		return size;
+	}
+
+	void TestDeepHierarchyMatchesReference()
+	{
+		constexpr std::uint32_t objects = 600u;
+
+		const Hierarchy tree = MakeHierarchy(objects, 80u, 35u);
+
+		TransformStore store;
+		store.Initialize(1u);
+		Load(store, tree);
+
+		FrameRegion region(objects);
+		CHECK(store.Flush(region.Bytes.data(), Stride) == objects);
+		CHECK(store.GetLevelCount() >= 80u);
+
+		float worst = 0.0f;
+		for (std::uint32_t i = 0; i < objects; ++i)
+		{
+			const XMFLOAT4X4 expected = ReferenceWorld(tree, i);
+			const XMFLOAT4X4& actual  = store.GetWorldTransposed(i);
+
+			//~ error grows with depth and with the distance from the origin
+			for (int r = 0; r < 4; ++r)
+				for (int c = 0; c < 4; ++c)
+					worst = std::max(worst, std::fabs(actual.m[r][c] - expected.m[r][c]) / (1.0f + std::fabs(expected.m[r][c])));
+		}
+		CHECK(worst < 1e-4f);
+	}
+
+	//~ above ParallelThreshold the store runs on the pool, the result must not depend on it
+	void TestParallelMatchesSerial(JobSystem& jobs)
+	{
+		constexpr std::uint32_t objects	   = 3000u;
+		constexpr std::uint32_t frameCount = 3u;
+		static_assert(objects >= TransformStore::ParallelThreshold);
+
+		const Hierarchy tree = MakeHierarchy(objects, 64u, 2048u);
+
+		TransformStore serial, parallel;
+		serial.Initialize(frameCount);
+		parallel.Initialize(frameCount);
+		parallel.SetJobSystem(&jobs);
+		Load(serial, tree);
+		Load(parallel, tree);
+
+		FrameRegion serialRegion(objects), parallelRegion(objects);
+
+		std::mt19937 rng{ 99u };
+		std::uniform_int_distribution<std::uint32_t> pick(0u, objects - 1u);
+
+		for (std::uint32_t frame = 0; frame < 8u; ++frame)
+		{
+			//~ a few random edits per frame, some of them high up the chain
+			for (int e = 0; e < 5; ++e)
+			{
+				const std::uint32_t index = pick(rng);
+				const Pose pose{ { frame * 0.5f, 1.f, 2.f }, { 0.1f * e, 0.2f, 0.3f }, { 1.f, 1.05f, 0.95f } };
+				serial	.Set(index, pose.Position, pose.Rotation, pose.Scale);
+				parallel.Set(index, pose.Position, pose.Rotation, pose.Scale);
+			}
+
+			serialRegion.Reset();
+			parallelRegion.Reset();
+			const std::uint32_t serialWritten	= serial  .Flush(serialRegion.Bytes.data(), Stride);
+			const std::uint32_t parallelWritten = parallel.Flush(parallelRegion.Bytes.data(), Stride);
+
+			CHECK(serialWritten == parallelWritten);
+			CHECK(serial.GetRebuiltCount()	  == parallel.GetRebuiltCount());
+			CHECK(serial.GetPropagatedCount() == parallel.GetPropagatedCount());
+			CHECK(serialRegion.Bytes == parallelRegion.Bytes);
+		}
+
+		bool bIdentical = true;
+		for (std::uint32_t i = 0; i < objects; ++i)
+			bIdentical &= std::memcmp(&serial.GetWorldTransposed(i), &parallel.GetWorldTransposed(i), sizeof(XMFLOAT4X4)) == 0;
+		CHECK(bIdentical);
+	}
+
+	//~ moving a node dirties its whole subtree for frameCount flushes, nothing else
+	void TestSubtreeCountdown()
+	{
+		constexpr std::uint32_t objects	   = 400u;
+		constexpr std::uint32_t frameCount = 2u;
+
+		const Hierarchy tree = MakeHierarchy(objects, 30u, 7u);
+
+		TransformStore store;
+		store.Initialize(frameCount);
+		Load(store, tree);
+
+		FrameRegion region(objects);
+		for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+			CHECK(store.Flush(region.Bytes.data(), Stride) == objects);
+		CHECK(store.Flush(region.Bytes.data(), Stride) == 0u);
+
+		//~ the node with the largest subtree that is not the whole tree
+		std::uint32_t root = 0u, size = 0u;
+		for (std::uint32_t i = 0; i < objects; ++i)
+		{
+			const std::uint32_t s = SubtreeSize(tree, i);
+			if (s < objects && s > size) { root = i; size = s; }
+		}
+		CHECK(size > 1u);
+
+		store.Set(root, { 9.f, 9.f, 9.f }, tree.Poses[root].Rotation, tree.Poses[root].Scale);
+		for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			CHECK(store.Flush(region.Bytes.data(), Stride) == size);
+			CHECK(store.GetPropagatedCount() == (frame == 0u ? size : 0u));
+			CHECK(store.GetWrittenCount() == size);
+			CHECK(store.GetSkippedCount() == objects - size);
+		}
+		CHECK(store.Flush(region.Bytes.data(), Stride) == 0u);
+		CHECK(store.GetSkippedCount() == objects);
+	}
+
+	//~ a change reaches every frame in flight copy once, then the slot is skipped
+	void TestDirtyCountdown()
+	{
+		constexpr std::uint32_t frameCount = 3u;
+		constexpr std::uint32_t objects	   = 10u;
+
+		TransformStore store;
+		store.Initialize(frameCount);
+		for (std::uint32_t i = 0; i < objects; ++i) store.Add();
+
+		FrameRegion region(objects);
+		for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			CHECK(store.Flush(region.Bytes.data(), Stride) == objects);
+			CHECK(store.GetWrittenCount() == objects);
+			CHECK(store.GetSkippedCount() == 0u);
+		}
+
+		region.Reset();
+		CHECK(store.Flush(region.Bytes.data(), Stride) == 0u);
+		CHECK(store.GetSkippedCount() == objects);
+		CHECK(region.Untouched(0u));
+
+		store.Set(4u, { 1.f, 2.f, 3.f }, { 0.f, 0.5f, 0.f }, { 2.f, 2.f, 2.f });
+		for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			region.Reset();
+			CHECK(store.Flush(region.Bytes.data(), Stride) == 1u);
+			CHECK(store.GetWrittenCount() == 1u);
+			CHECK(store.GetSkippedCount() == objects - 1u);
+			CHECK(region.Holds(store, 4u));
+			CHECK(region.Untouched(3u));
+			CHECK(region.Untouched(5u));
+		}
+
+		region.Reset();
+		CHECK(store.Flush(region.Bytes.data(), Stride) == 0u);
+		CHECK(region.Untouched(4u));
+
+		//~ a change midway restarts the countdown instead of adding to it
+		store.Set(7u, { 1.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+		CHECK(store.Flush(region.Bytes.data(), Stride) == 1u);
+		store.Set(7u, { 2.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+		std::uint32_t written = 0u;
+		for (std::uint32_t frame = 0; frame < frameCount + 2u; ++frame)
+			written += store.Flush(region.Bytes.data(), Stride);
+		CHECK(written == frameCount);
+	}
+
+	void TestRemovedSlotsAreReused()
+	{
+		constexpr std::uint32_t frameCount = 2u;
+
+		TransformStore store;
+		store.Initialize(frameCount);
+		for (std::uint32_t i = 0; i < 8u; ++i) store.Add();
+		CHECK(store.SetParent(5u, 3u));
+		CHECK(store.SetParent(6u, 5u));
+
+		FrameRegion region(8u);
+		store.Set(3u, { 5.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+		for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+			store.Flush(region.Bytes.data(), Stride);
+
+		//~ the children of a removed node keep their locals as roots
+		store.Remove(3u);
+		store.Remove(1u);
+		store.Remove(1u);
+		CHECK(store.GetParent(5u) == TransformStore::InvalidIndex);
+		CHECK(store.GetParent(6u) == 5u);
+
+		const std::uint32_t a = store.Add();
+		const std::uint32_t b = store.Add();
+		CHECK((a == 1u && b == 3u) || (a == 3u && b == 1u));
+		CHECK(store.GetCount() == 8u);
+		CHECK(store.Add() == 8u);
+		CHECK(store.GetCount() == 9u);
+
+		//~ a reused slot comes back as identity and goes through the whole countdown again
+		FrameRegion grown(9u);
+		for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			grown.Reset();
+			store.Flush(grown.Bytes.data(), Stride);
+			CHECK(grown.Holds(store, 3u));
+			CHECK(grown.Holds(store, 5u));
+			CHECK(grown.Untouched(0u));
+		}
+		CHECK(store.GetWorldTransposed(3u).m[0][3] == 0.0f);
+		CHECK(store.GetWorldTransposed(3u).m[0][0] == 1.0f);
+
+		grown.Reset();
+		CHECK(store.Flush(grown.Bytes.data(), Stride) == 0u);
+	}
+} // namespace
+
+int main()
+{
+	TestGroupsMatchDirectXMath();
+	TestDeepHierarchyMatchesReference();
+	TestSubtreeCountdown();
+	TestDirtyCountdown();
+	TestRemovedSlotsAreReused();
+
+	JobSystem jobs;
+	jobs.Initialize(3u);
+	TestParallelMatchesSerial(jobs);
+	jobs.Shutdown();
+
+	return tests::Finish("transform store");
+}